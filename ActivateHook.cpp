@@ -82,7 +82,7 @@ namespace FalseEdgeVR
             bool isPlayer = (player && activator == player);
     bool isGrabbed = IsObjectGrabbedByHiggs(activatee);
  
-            _MESSAGE("ActivateHook: Weapon activation - FormID: %08X, IsPlayer: %s, IsGrabbed: %s",
+            LOG_INFO("ActivateHook: Weapon activation - FormID: %08X, IsPlayer: %s, IsGrabbed: %s",
        activatee->formID,
    isPlayer ? "YES" : "NO",
         isGrabbed ? "YES" : "NO");
@@ -91,7 +91,7 @@ namespace FalseEdgeVR
   // Check if we should block this activation
         if (ShouldBlockActivation(activatee, activator))
         {
-            _MESSAGE("ActivateHook: BLOCKED player from activating grabbed weapon (FormID: %08X)",
+            LOG_INFO("ActivateHook: BLOCKED player from activating grabbed weapon (FormID: %08X)",
      activatee ? activatee->formID : 0);
     return false;  // Block activation
       }
@@ -124,14 +124,14 @@ namespace FalseEdgeVR
     
     void SetupActivateHook()
     {
-        _MESSAGE("SetupActivateHook: Initializing Activate Hook...");
+        LOG_INFO("SetupActivateHook: Initializing Activate Hook...");
         
         uintptr_t funcAddr = OriginalActivateFunc.GetUIntPtr();
-        _MESSAGE("SetupActivateHook: Activate function address: 0x%llX", funcAddr);
+        LOG_INFO("SetupActivateHook: Activate function address: 0x%llX", funcAddr);
    
         // Log first bytes for debugging
         unsigned char* funcStart = (unsigned char*)funcAddr;
-        _MESSAGE("SetupActivateHook: First 16 bytes: %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X",
+        LOG_INFO("SetupActivateHook: First 16 bytes: %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X %02X",
      funcStart[0], funcStart[1], funcStart[2], funcStart[3],
      funcStart[4], funcStart[5], funcStart[6], funcStart[7],
             funcStart[8], funcStart[9], funcStart[10], funcStart[11],
@@ -208,12 +208,12 @@ prologSize += 2;
      }
         }
         
-    _MESSAGE("SetupActivateHook: Detected prolog size: %d bytes", prologSize);
+    LOG_INFO("SetupActivateHook: Detected prolog size: %d bytes", prologSize);
         
    // Ensure minimum size for our jump
         if (prologSize < 5)
         {
-    _MESSAGE("SetupActivateHook: WARNING - Prolog too small, using 14 bytes");
+    LOG_WARN("SetupActivateHook: WARNING - Prolog too small, using 14 bytes");
   prologSize = 14;
         }
       
@@ -221,7 +221,7 @@ prologSize += 2;
     void* trampMem = g_localTrampoline.Allocate(prologSize + 14);
         if (!trampMem)
  {
-  _MESSAGE("SetupActivateHook: ERROR - Failed to allocate trampoline memory!");
+  LOG_ERROR("SetupActivateHook: ERROR - Failed to allocate trampoline memory!");
    return;
  }
         
@@ -245,12 +245,12 @@ prologSize += 2;
         // Update OriginalActivate to point to trampoline
         OriginalActivate = (_TESObjectREFR_Activate)trampMem;
       
-        _MESSAGE("SetupActivateHook: Trampoline at 0x%llX, jumps back to 0x%llX", (uintptr_t)trampMem, jumpBack);
-        _MESSAGE("SetupActivateHook: Copied %d bytes to trampoline", prologSize);
+        LOG_INFO("SetupActivateHook: Trampoline at 0x%llX, jumps back to 0x%llX", (uintptr_t)trampMem, jumpBack);
+        LOG_INFO("SetupActivateHook: Copied %d bytes to trampoline", prologSize);
         
         // Write jump at original function to our hook
      g_branchTrampoline.Write5Branch(funcAddr, (uintptr_t)ActivateHook);
 
-        _MESSAGE("SetupActivateHook: Hook installed successfully!");
+        LOG_INFO("SetupActivateHook: Hook installed successfully!");
     }
 }
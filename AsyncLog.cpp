@@ -0,0 +1,269 @@
+#include "AsyncLog.h"
+#include "BoundedMPSCQueue.h"
+#include "Engine.h"
+#include <windows.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace FalseEdgeVR
+{
+    // ~250 bytes per record; 1024 of them ride out a burst of a few hundred lines
+    static BoundedMPSCQueue<AsyncLogRecord, 1024> s_logRecords;
+    static std::atomic<uint32_t> s_droppedRecords{ 0 };
+    static std::atomic<bool> s_writerStarted{ false };
+    static std::thread s_writer;
+
+    // Writer sleep/wake. The writer sets s_writerWaiting before its last look at the ring;
+    // a producer that then finds the flag set clears it and signals. Only the first push
+    // after the writer went idle pays for the signal - every other push is one fence and
+    // a load.
+    static std::mutex s_wakeMutex;
+    static std::condition_variable s_wake;
+    static std::atomic<bool> s_writerWaiting{ false };
+    static std::atomic<bool> s_stopWriter{ false };
+
+    static std::mutex s_logFileMutex;
+
+    LogFileLock::LogFileLock()
+    {
+        s_logFileMutex.lock();
+    }
+
+    LogFileLock::~LogFileLock()
+    {
+        s_logFileMutex.unlock();
+    }
+
+    static void WakeWriter()
+    {
+        std::lock_guard<std::mutex> lock(s_wakeMutex);
+        s_wake.notify_one();
+    }
+
+    bool PushAsyncLogRecord(const AsyncLogRecord& record)
+    {
+        if (!s_logRecords.TryPush(record))
+        {
+            s_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // Pairs with the writer's fence: either it sees this record or this sees it waiting
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (s_writerWaiting.load(std::memory_order_relaxed) && s_writerWaiting.exchange(false))
+            WakeWriter();
+        return true;
+    }
+
+    uint32_t GetAsyncLogDropCount()
+    {
+        return s_droppedRecords.load(std::memory_order_relaxed);
+    }
+
+    // Appends text to out, keeping it NUL-terminated within capacity
+    static void Append(char* out, size_t capacity, size_t& length, const char* text, size_t textLength)
+    {
+        if (length + 1 >= capacity)
+            return;
+        if (textLength > capacity - 1 - length)
+            textLength = capacity - 1 - length;
+        memcpy(out + length, text, textLength);
+        length += textLength;
+        out[length] = '\0';
+    }
+
+    // printf-style formatting from captured arguments: each conversion is rebuilt with a
+    // length modifier matching how the argument was stored, then formatted on its own
+    static void FormatRecord(const AsyncLogRecord& record, char* out, size_t capacity)
+    {
+        size_t length = 0;
+        out[0] = '\0';
+
+        const char* cursor = record.format;
+        int nextArg = 0;
+
+        while (*cursor)
+        {
+            const char* percent = strchr(cursor, '%');
+            if (!percent)
+            {
+                Append(out, capacity, length, cursor, strlen(cursor));
+                break;
+            }
+
+            Append(out, capacity, length, cursor, percent - cursor);
+            cursor = percent + 1;
+
+            if (*cursor == '%')
+            {
+                Append(out, capacity, length, "%", 1);
+                cursor++;
+                continue;
+            }
+
+            // Flags, width and precision are kept; length modifiers are replaced
+            char spec[32];
+            size_t specLength = 0;
+            spec[specLength++] = '%';
+            while (*cursor && strchr("-+ #0123456789.", *cursor) && specLength < sizeof(spec) - 4)
+                spec[specLength++] = *cursor++;
+            while (*cursor && strchr("hlLjztI", *cursor))
+            {
+                // MSVC I64/I32
+                if (*cursor == 'I' && ((cursor[1] == '6' && cursor[2] == '4') || (cursor[1] == '3' && cursor[2] == '2')))
+                    cursor += 2;
+                cursor++;
+            }
+
+            char conversion = *cursor;
+            if (!conversion)
+                break;
+            cursor++;
+
+            if (nextArg >= record.argCount)
+            {
+                Append(out, capacity, length, "<?>", 3);
+                continue;
+            }
+
+            int arg = nextArg++;
+            uint64_t value = record.args[arg];
+            char piece[256];
+            int written = 0;
+
+            switch (conversion)
+            {
+            case 'd': case 'i':
+                spec[specLength++] = 'l'; spec[specLength++] = 'l'; spec[specLength++] = conversion; spec[specLength] = '\0';
+                written = snprintf(piece, sizeof(piece), spec, (long long)(int64_t)value);
+                break;
+            case 'u': case 'x': case 'X': case 'o':
+                spec[specLength++] = 'l'; spec[specLength++] = 'l'; spec[specLength++] = conversion; spec[specLength] = '\0';
+                written = snprintf(piece, sizeof(piece), spec, (unsigned long long)value);
+                break;
+            case 'c':
+                spec[specLength++] = 'c'; spec[specLength] = '\0';
+                written = snprintf(piece, sizeof(piece), spec, (int)value);
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            {
+                double asDouble;
+                if (record.argTypes[arg] == AsyncLogArgType::Double)
+                    memcpy(&asDouble, &value, sizeof(double));
+                else
+                    asDouble = (double)(int64_t)value;
+                spec[specLength++] = conversion; spec[specLength] = '\0';
+                written = snprintf(piece, sizeof(piece), spec, asDouble);
+                break;
+            }
+            case 's':
+                spec[specLength++] = 's'; spec[specLength] = '\0';
+                written = snprintf(piece, sizeof(piece), spec,
+                    record.argTypes[arg] == AsyncLogArgType::String ? record.strings + value : "<?>");
+                break;
+            case 'p':
+                spec[specLength++] = 'p'; spec[specLength] = '\0';
+                written = snprintf(piece, sizeof(piece), spec, (void*)(uintptr_t)value);
+                break;
+            default:
+                // Unknown conversion - print it as written
+                Append(out, capacity, length, percent, cursor - percent);
+                continue;
+            }
+
+            if (written > 0)
+                Append(out, capacity, length, piece, (size_t)written < sizeof(piece) ? (size_t)written : sizeof(piece) - 1);
+        }
+    }
+
+    static void WriteRecord(const AsyncLogRecord& record, char* line, size_t capacity)
+    {
+        FormatRecord(record, line, capacity);
+        LogFileLock lock;
+        _MESSAGE("%s", line);
+    }
+
+    static void WriterLoop()
+    {
+        char line[1024];
+        uint32_t reportedDrops = 0;
+        AsyncLogRecord record;
+
+        for (;;)
+        {
+            while (s_logRecords.TryPop(record))
+                WriteRecord(record, line, sizeof(line));
+
+            uint32_t drops = s_droppedRecords.load(std::memory_order_relaxed);
+            if (drops != reportedDrops)
+            {
+                LogFileLock lock;
+                _MESSAGE("AsyncLog: %u log records dropped (ring full), %u total", drops - reportedDrops, drops);
+                reportedDrops = drops;
+            }
+
+            if (s_stopWriter.load(std::memory_order_acquire))
+                break;
+
+            // Idle - announce it, take one last look, then sleep until a push or StopAsyncLog
+            std::unique_lock<std::mutex> lock(s_wakeMutex);
+            s_writerWaiting.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (s_logRecords.TryPop(record))
+            {
+                s_writerWaiting.store(false);
+                lock.unlock();
+                WriteRecord(record, line, sizeof(line));
+                continue;
+            }
+            s_wake.wait(lock, [] {
+                return !s_writerWaiting.load() || s_stopWriter.load(std::memory_order_acquire);
+            });
+            s_writerWaiting.store(false);
+        }
+    }
+
+    void StartAsyncLog()
+    {
+        if (s_writerStarted.exchange(true))
+            return;
+
+        s_stopWriter.store(false);
+        s_writer = std::thread(WriterLoop);
+
+        LogFileLock lock;
+        _MESSAGE("AsyncLog: Writer thread started");
+    }
+
+    void StopAsyncLog()
+    {
+        if (!s_writerStarted.exchange(false))
+            return;
+
+        s_stopWriter.store(true, std::memory_order_release);
+        WakeWriter();
+        if (s_writer.joinable())
+            s_writer.join();
+    }
+
+    // DLL unload: flush and stop a writer that is still running. On process exit Windows has
+    // already ended the thread (possibly inside s_wakeMutex) before statics are destroyed, so a
+    // dead writer is only detached - destroying a joinable std::thread would terminate.
+    struct AsyncLogShutdown
+    {
+        ~AsyncLogShutdown()
+        {
+            if (!s_writer.joinable())
+                return;
+
+            if (WaitForSingleObject((HANDLE)s_writer.native_handle(), 0) == WAIT_TIMEOUT)
+                StopAsyncLog();
+            else
+                s_writer.detach();
+        }
+    };
+    static AsyncLogShutdown s_shutdown;
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+// ============================================
+// AsyncLog - non-blocking logging for the physics step and event sinks
+// ============================================
+// ASYNC_MESSAGE(fmt, ...) takes the same arguments as _MESSAGE, but the calling thread
+// does no formatting and no file I/O. It copies the format pointer and the raw argument
+// values (plus short copies of any strings) into a fixed-size record and pushes that
+// onto a lock-free ring. A background thread formats the records in order and writes
+// them with _MESSAGE. It sleeps while the ring is empty; the first push after that
+// wakes it.
+//
+// The format string must be a literal (only its pointer is kept). Strings are copied,
+// so temporaries are fine, but long ones are cut short. If the ring is full the record
+// is dropped and counted - the worker reports the count in the log - rather than
+// making the caller wait.
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace FalseEdgeVR
+{
+    enum class AsyncLogArgType : uint8_t
+    {
+        Signed,
+        Unsigned,
+        Double,
+        String,         // value = offset into AsyncLogRecord::strings
+        Pointer,
+    };
+
+    struct AsyncLogRecord
+    {
+        static const int kMaxArgs = 12;
+        static const int kStringBytes = 128;
+
+        const char* format;
+        uint8_t argCount;
+        uint8_t stringBytesUsed;
+        AsyncLogArgType argTypes[kMaxArgs];
+        uint64_t args[kMaxArgs];
+        char strings[kStringBytes];       // NUL-terminated copies of %s arguments
+    };
+
+    // Starts the writer thread (records queued before this are kept)
+    void StartAsyncLog();
+
+    // Writes out what is still queued, then stops and joins the writer thread
+    void StopAsyncLog();
+
+    // Held around every _MESSAGE. IDebugLog isn't thread-safe, and the writer thread writes
+    // while setup, load and menu code log synchronously (LOG_* takes this lock).
+    class LogFileLock
+    {
+    public:
+        LogFileLock();
+        ~LogFileLock();
+
+        LogFileLock(const LogFileLock&) = delete;
+        LogFileLock& operator=(const LogFileLock&) = delete;
+    };
+
+    // Any thread. False if the ring was full and the record was dropped.
+    bool PushAsyncLogRecord(const AsyncLogRecord& record);
+
+    // Records dropped since startup
+    uint32_t GetAsyncLogDropCount();
+
+    namespace AsyncLogDetail
+    {
+        inline void CaptureString(AsyncLogRecord& record, const char* value)
+        {
+            if (!value)
+                value = "(null)";
+
+            int offset = record.stringBytesUsed;
+            int space = AsyncLogRecord::kStringBytes - offset;
+            if (space <= 0)
+            {
+                // Out of string space - point at the final NUL (prints as empty)
+                offset = AsyncLogRecord::kStringBytes - 1;
+                space = 0;
+            }
+            else
+            {
+                size_t length = std::strlen(value);
+                if (length >= (size_t)space)
+                    length = space - 1;
+                std::memcpy(record.strings + offset, value, length);
+                record.strings[offset + length] = '\0';
+                record.stringBytesUsed = (uint8_t)(offset + length + 1);
+            }
+
+            record.argTypes[record.argCount] = AsyncLogArgType::String;
+            record.args[record.argCount] = (uint64_t)offset;
+        }
+
+        template <typename T>
+        inline void Capture(AsyncLogRecord& record, const T& value)
+        {
+            if constexpr (std::is_same<T, const char*>::value || std::is_same<T, char*>::value)
+            {
+                CaptureString(record, value);
+            }
+            else if constexpr (std::is_array<T>::value)
+            {
+                // char buffers and string literals
+                CaptureString(record, value);
+            }
+            else if constexpr (std::is_pointer<T>::value)
+            {
+                record.argTypes[record.argCount] = AsyncLogArgType::Pointer;
+                record.args[record.argCount] = (uint64_t)(uintptr_t)value;
+            }
+            else if constexpr (std::is_floating_point<T>::value)
+            {
+                double asDouble = (double)value;
+                record.argTypes[record.argCount] = AsyncLogArgType::Double;
+                std::memcpy(&record.args[record.argCount], &asDouble, sizeof(double));
+            }
+            else if constexpr (std::is_enum<T>::value)
+            {
+                record.argTypes[record.argCount] = AsyncLogArgType::Signed;
+                record.args[record.argCount] = (uint64_t)(int64_t)value;
+            }
+            else if constexpr (std::is_signed<T>::value)
+            {
+                record.argTypes[record.argCount] = AsyncLogArgType::Signed;
+                record.args[record.argCount] = (uint64_t)(int64_t)value;
+            }
+            else
+            {
+                static_assert(std::is_integral<T>::value, "ASYNC_MESSAGE: unsupported argument type");
+                record.argTypes[record.argCount] = AsyncLogArgType::Unsigned;
+                record.args[record.argCount] = (uint64_t)value;
+            }
+            record.argCount++;
+        }
+    }
+
+    template <typename... Args>
+    inline void AsyncMessage(const char* format, const Args&... args)
+    {
+        static_assert(sizeof...(Args) <= AsyncLogRecord::kMaxArgs, "ASYNC_MESSAGE: too many arguments");
+
+        AsyncLogRecord record;
+        record.format = format;
+        record.argCount = 0;
+        record.stringBytesUsed = 0;
+        int expand[] = { 0, (AsyncLogDetail::Capture(record, args), 0)... };
+        (void)expand;
+
+        PushAsyncLogRecord(record);
+    }
+}
+
+#define ASYNC_MESSAGE(fmt, ...) FalseEdgeVR::AsyncMessage(fmt, ##__VA_ARGS__)
@@ -0,0 +1,149 @@
+#pragma once
+
+// ============================================
+// BladeMotion - filtered blade velocity
+// ============================================
+// Turns each hand's blade poses into velocity with a One-Euro filter (Casiez et
+// al. 2012): a low-pass whose cutoff rises with the speed of the blade. At rest
+// the cutoff is low and controller jitter is smoothed out; during a swing it
+// opens up so the estimate does not lag behind the blade.
+//
+// The filter runs on the raw one-step difference, which is the velocity at the
+// middle of the last step. Its smoothed derivative (the acceleration) moves the
+// estimate forward that half step. Like CollisionMath.h this header has no SKSE
+// dependency.
+
+#include "CollisionMath.h"
+
+namespace FalseEdgeVR
+{
+namespace CollisionMath
+{
+    constexpr float kPi = 3.14159265358979f;
+
+    struct BladePose
+    {
+        Vec3 base;
+        Vec3 tip;
+        float time = 0.0f;      // Seconds, monotonic per tracker
+    };
+
+    // ============================================
+    // One-Euro Filter
+    // ============================================
+
+    struct OneEuroParams
+    {
+        float minCutoff = 5.0f;         // Hz - cutoff at rest (lower = smoother, more lag)
+        float beta = 0.1f;              // Cutoff increase per unit/sec of the raw signal's magnitude
+        float derivativeCutoff = 10.0f; // Hz - cutoff for the derivative estimate itself
+    };
+
+    // Smoothing factor of a first-order low-pass at the given cutoff for one step of dt
+    inline float LowPassAlpha(float cutoff, float dt)
+    {
+        float tau = 1.0f / (2.0f * kPi * cutoff);
+        return 1.0f / (1.0f + tau / dt);
+    }
+
+    class OneEuroFilterVec3
+    {
+    public:
+        void Reset()
+        {
+            m_initialized = false;
+            m_value = Vec3();
+            m_derivative = Vec3();
+        }
+
+        // Feed one raw sample taken dt seconds after the previous one; returns the filtered value
+        const Vec3& Filter(const Vec3& raw, float dt, const OneEuroParams& params)
+        {
+            if (!m_initialized || dt <= 0.0f)
+            {
+                if (!m_initialized)
+                {
+                    m_value = raw;
+                    m_derivative = Vec3();
+                    m_initialized = true;
+                }
+                return m_value;
+            }
+
+            // Derivative of the raw signal, smoothed at a fixed cutoff
+            Vec3 rawDerivative = (raw - m_value) * (1.0f / dt);
+            m_derivative = m_derivative + (rawDerivative - m_derivative) * LowPassAlpha(params.derivativeCutoff, dt);
+
+            // Faster blade -> higher cutoff -> less lag
+            float cutoff = params.minCutoff + params.beta * Length(raw);
+            m_value = m_value + (raw - m_value) * LowPassAlpha(cutoff, dt);
+            return m_value;
+        }
+
+        bool IsInitialized() const { return m_initialized; }
+        const Vec3& Value() const { return m_value; }
+        const Vec3& Derivative() const { return m_derivative; }
+
+    private:
+        Vec3 m_value;
+        Vec3 m_derivative;
+        bool m_initialized = false;
+    };
+
+    // ============================================
+    // Blade Motion Estimator
+    // ============================================
+
+    // Per-hand previous pose plus filtered base/tip velocity
+    struct alignas(64) BladeMotionEstimator
+    {
+        BladePose previous;
+        bool hasPrevious = false;
+        OneEuroFilterVec3 tipFilter;
+        OneEuroFilterVec3 baseFilter;
+
+        Vec3 tipVelocity;
+        Vec3 baseVelocity;
+
+        void Reset()
+        {
+            hasPrevious = false;
+            tipFilter.Reset();
+            baseFilter.Reset();
+            tipVelocity = baseVelocity = Vec3();
+        }
+
+        // Record this step's pose and update the estimates.
+        // With filtering disabled the velocity is the raw one-step difference.
+        void AddPose(const BladePose& pose, const OneEuroParams& params, bool filtered)
+        {
+            BladePose last = previous;
+            bool hadPrevious = hasPrevious;
+            previous = pose;
+            hasPrevious = true;
+            if (!hadPrevious)
+                return;
+
+            float dt = pose.time - last.time;
+            if (dt <= 0.0f)
+                return;
+
+            float invDt = 1.0f / dt;
+            Vec3 rawTipVelocity = (pose.tip - last.tip) * invDt;
+            Vec3 rawBaseVelocity = (pose.base - last.base) * invDt;
+
+            if (!filtered)
+            {
+                tipVelocity = rawTipVelocity;
+                baseVelocity = rawBaseVelocity;
+                return;
+            }
+
+            // The raw difference is half a step old - lead it by the filtered acceleration
+            float lead = 0.5f * dt;
+            tipVelocity = tipFilter.Filter(rawTipVelocity, dt, params) + tipFilter.Derivative() * lead;
+            baseVelocity = baseFilter.Filter(rawBaseVelocity, dt, params) + baseFilter.Derivative() * lead;
+        }
+    };
+}
+}
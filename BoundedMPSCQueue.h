@@ -0,0 +1,92 @@
+#pragma once
+
+// ============================================
+// BoundedMPSCQueue - fixed-size lock-free multi-producer, single-consumer queue
+// ============================================
+// Ring of cells, each with a sequence number saying whose turn it is (Vyukov's bounded
+// queue). Producers claim a cell with one CAS on the enqueue position and publish it by
+// bumping the cell's sequence; the single consumer reads cells in order and hands them
+// back. Never blocks and never allocates: a full queue makes TryPush return false.
+//
+// T should be a small POD - it is copied in and out.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace FalseEdgeVR
+{
+    template <typename T, size_t Capacity>
+    class BoundedMPSCQueue
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        BoundedMPSCQueue()
+        {
+            for (size_t i = 0; i < Capacity; i++)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // Any thread. False if the queue is full (the item is not queued).
+        bool TryPush(const T& item)
+        {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            Cell* cell;
+            for (;;)
+            {
+                cell = &m_cells[pos & (Capacity - 1)];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                std::intptr_t diff = (std::intptr_t)sequence - (std::intptr_t)pos;
+
+                if (diff == 0)
+                {
+                    // Cell is free for this position - claim it
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    // Consumer hasn't freed this cell yet - full
+                    return false;
+                }
+                else
+                {
+                    // Another producer took it - retry at the current position
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->data = item;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer thread only. False if nothing is ready.
+        bool TryPop(T& out)
+        {
+            Cell* cell = &m_cells[m_dequeuePos & (Capacity - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            if (sequence != m_dequeuePos + 1)
+                return false;
+
+            out = cell->data;
+            cell->sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+            m_dequeuePos++;
+            return true;
+        }
+
+        static constexpr size_t GetCapacity() { return Capacity; }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        Cell m_cells[Capacity];
+        alignas(64) std::atomic<size_t> m_enqueuePos{ 0 };
+        alignas(64) size_t m_dequeuePos = 0;
+    };
+}
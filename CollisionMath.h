@@ -0,0 +1,735 @@
+#pragma once
+
+// ============================================
+// CollisionMath - headless geometry kernels
+// ============================================
+// Pure math used by WeaponGeometryTracker and ShieldCollisionTracker every physics
+// step. This header must not include any SKSE / Skyrim headers so it can be built
+// and benchmarked on its own (see CMakeLists.txt and bench/).
+//
+// The plugin converts NiPoint3 <-> Vec3 at the call sites; Vec3 has the same
+// layout as NiPoint3 (three packed floats).
+
+#include <cmath>
+#include <cfloat>
+
+namespace FalseEdgeVR
+{
+namespace CollisionMath
+{
+    struct Vec3
+    {
+        float x, y, z;
+
+        constexpr Vec3() : x(0.0f), y(0.0f), z(0.0f) {}
+        constexpr Vec3(float inX, float inY, float inZ) : x(inX), y(inY), z(inZ) {}
+    };
+
+    inline Vec3 operator+(const Vec3& a, const Vec3& b) { return Vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+    inline Vec3 operator-(const Vec3& a, const Vec3& b) { return Vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+    inline Vec3 operator*(const Vec3& a, float s) { return Vec3(a.x * s, a.y * s, a.z * s); }
+    inline Vec3 operator*(float s, const Vec3& a) { return Vec3(a.x * s, a.y * s, a.z * s); }
+
+    inline float Dot(const Vec3& a, const Vec3& b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    inline Vec3 Cross(const Vec3& a, const Vec3& b)
+    {
+        return Vec3(a.y * b.z - a.z * b.y,
+                    a.z * b.x - a.x * b.z,
+                    a.x * b.y - a.y * b.x);
+    }
+
+    inline float LengthSquared(const Vec3& v)
+    {
+        return Dot(v, v);
+    }
+
+    inline float Length(const Vec3& v)
+    {
+        return std::sqrt(LengthSquared(v));
+    }
+
+    // Returns (0,0,1) for degenerate vectors (matches the old ShieldCollisionTracker::Normalize)
+    inline Vec3 Normalize(const Vec3& v)
+    {
+        float len = Length(v);
+        if (len < 0.0001f)
+            return Vec3(0.0f, 0.0f, 1.0f);
+        return v * (1.0f / len);
+    }
+
+    inline float Clamp(float value, float min, float max)
+    {
+        if (value < min) return min;
+        if (value > max) return max;
+        return value;
+    }
+
+    inline Vec3 PointAlongSegment(const Vec3& start, const Vec3& end, float t)
+    {
+        return Vec3(start.x + t * (end.x - start.x),
+                    start.y + t * (end.y - start.y),
+                    start.z + t * (end.z - start.z));
+    }
+
+    // ============================================
+    // Segment vs Segment
+    // ============================================
+
+    // Closest points between segments [p1,q1] and [p2,q2] (Ericson, RTCD 5.1.9).
+    // outParam1/outParam2 are the 0-1 parameters along each segment.
+    // Returns the distance between the closest points.
+    inline float ClosestDistanceBetweenSegments(
+        const Vec3& p1, const Vec3& q1,
+        const Vec3& p2, const Vec3& q2,
+        float& outParam1, float& outParam2,
+        Vec3& outClosestPoint1, Vec3& outClosestPoint2)
+    {
+        const float epsilon = 0.0001f;
+
+        Vec3 d1 = q1 - p1;
+        Vec3 d2 = q2 - p2;
+        Vec3 r = p1 - p2;
+
+        float a = Dot(d1, d1);
+        float e = Dot(d2, d2);
+        float f = Dot(d2, r);
+
+        float s, t;
+
+        if (a <= epsilon && e <= epsilon)
+        {
+            // Both segments degenerate to points
+            s = t = 0.0f;
+        }
+        else if (a <= epsilon)
+        {
+            s = 0.0f;
+            t = Clamp(f / e, 0.0f, 1.0f);
+        }
+        else
+        {
+            float c = Dot(d1, r);
+            if (e <= epsilon)
+            {
+                t = 0.0f;
+                s = Clamp(-c / a, 0.0f, 1.0f);
+            }
+            else
+            {
+                float b = Dot(d1, d2);
+                float denom = a * e - b * b;
+
+                // Parallel segments: pick s = 0 and let the t clamp sort it out
+                s = (denom != 0.0f) ? Clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+
+                t = (b * s + f) / e;
+
+                if (t < 0.0f)
+                {
+                    t = 0.0f;
+                    s = Clamp(-c / a, 0.0f, 1.0f);
+                }
+                else if (t > 1.0f)
+                {
+                    t = 1.0f;
+                    s = Clamp((b - c) / a, 0.0f, 1.0f);
+                }
+            }
+        }
+
+        outParam1 = s;
+        outParam2 = t;
+
+        outClosestPoint1 = PointAlongSegment(p1, q1, s);
+        outClosestPoint2 = PointAlongSegment(p2, q2, t);
+
+        return Length(outClosestPoint1 - outClosestPoint2);
+    }
+
+    // ============================================
+    // Capsules
+    // ============================================
+
+    // Segment swept by a sphere - a blade with thickness
+    struct Capsule
+    {
+        Vec3 start;
+        Vec3 end;
+        float radius;
+    };
+
+    // Signed gap between two capsule surfaces (negative when they overlap).
+    // outAxisA/outAxisB are the closest points on each capsule's axis (outParamA/outParamB their
+    // 0-1 parameters); the surface contact points lie radius further along axisB - axisA.
+    inline float CapsuleGap(const Capsule& a, const Capsule& b,
+        float& outParamA, float& outParamB, Vec3& outAxisA, Vec3& outAxisB)
+    {
+        float axisDistance = ClosestDistanceBetweenSegments(a.start, a.end, b.start, b.end,
+            outParamA, outParamB, outAxisA, outAxisB);
+        return axisDistance - a.radius - b.radius;
+    }
+
+    // ============================================
+    // Plane / Disc
+    // ============================================
+
+    // Project point onto the plane through planePoint with unit normal planeNormal
+    inline Vec3 ProjectPointOntoPlane(const Vec3& point, const Vec3& planePoint, const Vec3& planeNormal)
+    {
+        float dist = Dot(point - planePoint, planeNormal);
+        return point - planeNormal * dist;
+    }
+
+    // Closest point on a disc (center, unit normal, radius) to an arbitrary point
+    inline Vec3 ClampPointToDisc(const Vec3& point, const Vec3& center, const Vec3& normal, float radius)
+    {
+        Vec3 projected = ProjectPointOntoPlane(point, center, normal);
+        Vec3 toProjected = projected - center;
+
+        float distFromCenter = Length(toProjected);
+        if (distFromCenter <= radius)
+            return projected;  // Point is within disc
+
+        // Clamp to edge of disc
+        return center + Normalize(toProjected) * radius;
+    }
+
+    // Closest distance from segment [segStart,segEnd] to a solid disc (center, unit normal, radius).
+    //
+    // Writing P(t) = segStart + t * (segEnd - segStart), split P(t) - center into its height
+    // above the plane h(t) (linear in t) and its in-plane offset u(t) (linear in t). Then
+    //   dist^2(t) = h(t)^2 + max(0, |u(t)| - radius)^2
+    // which is convex in t (distance to a convex set along a line). So:
+    //   - if the segment crosses the plane inside the disc, the answer is 0 at the crossing (closed form)
+    //   - if the derivative does not change sign on [0,1], the minimum is at an endpoint
+    //   - otherwise the single stationary point is found with a bracketed Newton iteration.
+    //     Over the disc face the derivative is linear so Newton lands in one step; near the
+    //     rim it converges quadratically (the exact rim solution is a quartic).
+    inline float ClosestDistanceSegmentToDisc(
+        const Vec3& segStart, const Vec3& segEnd,
+        const Vec3& discCenter, const Vec3& discNormal, float discRadius,
+        float& outSegmentParam, Vec3& outSegmentPoint, Vec3& outDiscPoint)
+    {
+        Vec3 segDir = segEnd - segStart;
+        Vec3 rel = segStart - discCenter;
+
+        float h0 = Dot(rel, discNormal);        // Height of segStart above the disc plane
+        float dh = Dot(segDir, discNormal);     // Height change along the segment
+        Vec3 u0 = rel - discNormal * h0;        // In-plane offset of segStart from the center
+        Vec3 du = segDir - discNormal * dh;     // In-plane direction of the segment
+
+        // Closest disc point for a given in-plane offset
+        auto discPointFor = [&](const Vec3& u) -> Vec3 {
+            float len = Length(u);
+            return (len <= discRadius) ? discCenter + u : discCenter + u * (discRadius / len);
+        };
+
+        auto finish = [&](float t) -> float {
+            outSegmentParam = t;
+            outSegmentPoint = segStart + segDir * t;
+            outDiscPoint = discPointFor(u0 + du * t);
+            return Length(outSegmentPoint - outDiscPoint);
+        };
+
+        // Segment passes through the disc plane - exact hit if the crossing is inside the radius
+        float h1 = h0 + dh;
+        if ((h0 <= 0.0f && h1 >= 0.0f) || (h0 >= 0.0f && h1 <= 0.0f))
+        {
+            float t = (dh != 0.0f) ? Clamp(-h0 / dh, 0.0f, 1.0f) : 0.0f;
+            Vec3 u = u0 + du * t;
+            if (LengthSquared(u) <= discRadius * discRadius)
+                return finish(t);
+        }
+
+        // Half-derivative of dist^2(t)
+        auto slope = [&](float t) -> float {
+            Vec3 u = u0 + du * t;
+            float len = Length(u);
+            float rim = (len > discRadius) ? (1.0f - discRadius / len) : 0.0f;
+            return (h0 + dh * t) * dh + rim * Dot(u, du);
+        };
+
+        // Half second derivative of dist^2(t)
+        auto curvature = [&](float t) -> float {
+            Vec3 u = u0 + du * t;
+            float lenSq = LengthSquared(u);
+            float result = dh * dh;
+            if (lenSq > discRadius * discRadius)
+            {
+                float len = std::sqrt(lenSq);
+                float ud = Dot(u, du);
+                float radial = (ud * ud) / lenSq;
+                result += radial + (1.0f - discRadius / len) * (LengthSquared(du) - radial);
+            }
+            return result;
+        };
+
+        if (slope(0.0f) >= 0.0f)
+            return finish(0.0f);
+        if (slope(1.0f) <= 0.0f)
+            return finish(1.0f);
+
+        // Stationary point is strictly inside (0,1); start from the plane crossing when there is one
+        float lo = 0.0f;
+        float hi = 1.0f;
+        float t = (dh != 0.0f) ? Clamp(-h0 / dh, 0.0f, 1.0f) : 0.5f;
+        if (t <= lo || t >= hi)
+            t = 0.5f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            float d = slope(t);
+            if (d == 0.0f)
+                break;
+            if (d > 0.0f)
+                hi = t;
+            else
+                lo = t;
+
+            float dd = curvature(t);
+            float step = (dd > 0.0f) ? d / dd : 1.0f;
+            if (std::fabs(step) < 1.0e-6f)
+                break;  // Converged to float precision
+
+            float next = t - step;
+            if (!(next > lo && next < hi))
+                next = 0.5f * (lo + hi);  // Newton left the bracket - bisect instead
+            t = next;
+        }
+
+        return finish(t);
+    }
+
+    // ============================================
+    // Planar Ellipse (Shield Face)
+    // ============================================
+
+    // Flat ellipse: center, unit normal, two perpendicular unit in-plane axes and the semi-axis along each
+    struct PlanarEllipse
+    {
+        Vec3 center;
+        Vec3 normal;
+        Vec3 axisU;
+        Vec3 axisV;
+        float radiusU;
+        float radiusV;
+
+        float BoundingRadius() const { return (radiusU > radiusV) ? radiusU : radiusV; }
+    };
+
+    // Whether a point, projected onto the ellipse's plane, falls inside it
+    inline bool PointInEllipse(const PlanarEllipse& ellipse, const Vec3& point)
+    {
+        Vec3 offset = point - ellipse.center;
+        float u = Dot(offset, ellipse.axisU) / ellipse.radiusU;
+        float v = Dot(offset, ellipse.axisV) / ellipse.radiusV;
+        return u * u + v * v <= 1.0f;
+    }
+
+    // Closest point of the solid ellipse to a point, in the ellipse's plane: the projection if it
+    // falls inside, otherwise the nearest rim point. The rim point comes from a fixed three rounds
+    // of the evolute (curvature-center) iteration, which converges to well under 0.01 units for
+    // shield-sized ellipses of any aspect, with no trig.
+    inline Vec3 ClosestPointOnEllipse(const PlanarEllipse& ellipse, const Vec3& point)
+    {
+        Vec3 offset = point - ellipse.center;
+        float u = Dot(offset, ellipse.axisU);
+        float v = Dot(offset, ellipse.axisV);
+        float a = ellipse.radiusU;
+        float b = ellipse.radiusV;
+
+        if ((u / a) * (u / a) + (v / b) * (v / b) > 1.0f)
+        {
+            // Work in the first quadrant, restore signs at the end
+            float pu = std::fabs(u);
+            float pv = std::fabs(v);
+            float tu = 0.70710678f;
+            float tv = 0.70710678f;
+            float focal = a * a - b * b;
+            for (int i = 0; i < 3; i++)
+            {
+                float x = a * tu;
+                float y = b * tv;
+                float eu = focal * tu * tu * tu / a;
+                float ev = -focal * tv * tv * tv / b;
+                float ru = x - eu, rv = y - ev;
+                float qu = pu - eu, qv = pv - ev;
+                float r = std::sqrt(ru * ru + rv * rv);
+                float q = std::sqrt(qu * qu + qv * qv);
+                float scale = (q > 0.0001f) ? r / q : 0.0f;
+                tu = Clamp((qu * scale + eu) / a, 0.0f, 1.0f);
+                tv = Clamp((qv * scale + ev) / b, 0.0f, 1.0f);
+                float t = std::sqrt(tu * tu + tv * tv);
+                tu /= t;
+                tv /= t;
+            }
+            u = (u < 0.0f) ? -a * tu : a * tu;
+            v = (v < 0.0f) ? -b * tv : b * tv;
+        }
+        return ellipse.center + ellipse.axisU * u + ellipse.axisV * v;
+    }
+
+    // Closest distance from a segment to a solid planar ellipse.
+    // A near-circular face is the disc case, solved exactly. Otherwise the bounding disc is solved
+    // first; the ellipse lies inside it, so if the disc contact is inside the ellipse it is the
+    // answer. If not, the contact sits on the part of the disc the ellipse doesn't cover, and
+    // alternating projections between the segment and the rim (both convex, so this converges
+    // to the closest pair) walk it onto the ellipse. The projections work in the ellipse's own
+    // coordinates and take one warm-started evolute round each, so the cost stays bounded at
+    // kEllipseRounds rounds on top of the disc solve.
+    constexpr int kEllipseRounds = 2;
+
+    inline float ClosestDistanceSegmentToEllipse(
+        const Vec3& segStart, const Vec3& segEnd, const PlanarEllipse& ellipse,
+        float& outSegmentParam, Vec3& outSegmentPoint, Vec3& outEllipsePoint)
+    {
+        float a = ellipse.radiusU;
+        float b = ellipse.radiusV;
+        float larger = (a > b) ? a : b;
+        float distance = ClosestDistanceSegmentToDisc(segStart, segEnd,
+            ellipse.center, ellipse.normal, larger,
+            outSegmentParam, outSegmentPoint, outEllipsePoint);
+
+        if (std::fabs(a - b) <= 0.01f * larger || PointInEllipse(ellipse, outEllipsePoint))
+            return distance;
+
+        // Segment in ellipse coordinates: u, v in the plane, h along the normal
+        Vec3 rel = segStart - ellipse.center;
+        Vec3 dir = segEnd - segStart;
+        float u0 = Dot(rel, ellipse.axisU), v0 = Dot(rel, ellipse.axisV), h0 = Dot(rel, ellipse.normal);
+        float du = Dot(dir, ellipse.axisU), dv = Dot(dir, ellipse.axisV), dh = Dot(dir, ellipse.normal);
+        float lengthSq = du * du + dv * dv + dh * dh;
+        float invLengthSq = (lengthSq > 0.0001f) ? 1.0f / lengthSq : 0.0f;
+
+        // Rim point as unit (tu, tv) in the first quadrant: (a * tu, b * tv). Start at the disc contact's angle.
+        float s = outSegmentParam;
+        float tu = std::fabs(u0 + du * s) / a;
+        float tv = std::fabs(v0 + dv * s) / b;
+        float t = std::sqrt(tu * tu + tv * tv);
+        tu = (t > 0.0001f) ? tu / t : 0.70710678f;
+        tv = (t > 0.0001f) ? tv / t : 0.70710678f;
+
+        // Nearest ellipse point to the segment point at s (warm-started from the previous one)
+        float focal = a * a - b * b;
+        float x = 0.0f, y = 0.0f;
+        auto projectToEllipse = [&]() {
+            float pu = u0 + du * s;
+            float pv = v0 + dv * s;
+            float qu = std::fabs(pu), qv = std::fabs(pv);
+            if ((qu / a) * (qu / a) + (qv / b) * (qv / b) <= 1.0f)
+            {
+                // Over the face - the closest ellipse point is straight below
+                x = pu;
+                y = pv;
+                return;
+            }
+
+            // One evolute (curvature-center) round towards the rim point nearest (qu, qv)
+            float eu = focal * tu * tu * tu / a;
+            float ev = -focal * tv * tv * tv / b;
+            float ru = a * tu - eu, rv = b * tv - ev;
+            float wu = qu - eu, wv = qv - ev;
+            float r = std::sqrt(ru * ru + rv * rv);
+            float w = std::sqrt(wu * wu + wv * wv);
+            float scale = (w > 0.0001f) ? r / w : 0.0f;
+            tu = Clamp((wu * scale + eu) / a, 0.0f, 1.0f);
+            tv = Clamp((wv * scale + ev) / b, 0.0f, 1.0f);
+            float len = std::sqrt(tu * tu + tv * tv);
+            tu = (len > 0.0001f) ? tu / len : 0.70710678f;
+            tv = (len > 0.0001f) ? tv / len : 0.70710678f;
+            x = (pu < 0.0f) ? -a * tu : a * tu;
+            y = (pv < 0.0f) ? -b * tv : b * tv;
+        };
+
+        for (int i = 0; i < kEllipseRounds; i++)
+        {
+            projectToEllipse();
+
+            // Segment point closest to that ellipse point
+            s = Clamp(((x - u0) * du + (y - v0) * dv - h0 * dh) * invLengthSq, 0.0f, 1.0f);
+        }
+        projectToEllipse();
+
+        outSegmentParam = s;
+        outSegmentPoint = PointAlongSegment(segStart, segEnd, s);
+        outEllipsePoint = ellipse.center + ellipse.axisU * x + ellipse.axisV * y;
+        return Length(outSegmentPoint - outEllipsePoint);
+    }
+
+    // ============================================
+    // Time To Collision
+    // ============================================
+
+    // Estimates beyond this are treated as "not approaching"
+    constexpr float kMaxTimeToCollision = 2.0f;
+
+    // Linear time until distance closes to collisionThreshold at closingVelocity.
+    // Returns -1 if separating, already within the threshold, or further than kMaxTimeToCollision away.
+    inline float EstimateTimeToCollision(float distance, float closingVelocity, float collisionThreshold)
+    {
+        if (closingVelocity <= 0.0f || distance <= collisionThreshold)
+            return -1.0f;
+
+        float timeToCollision = (distance - collisionThreshold) / closingVelocity;
+
+        if (timeToCollision > kMaxTimeToCollision)
+            return -1.0f;
+
+        return timeToCollision;
+    }
+
+    // ============================================
+    // Conservative advancement
+    // ============================================
+
+    // How far any point of a segment can have moved between two poses. With the endpoints
+    // moving linearly over the step (as in the swept tests), every point along the segment
+    // interpolates between them, so the endpoints bound the whole segment at every instant.
+    inline float MaxSegmentDisplacement(const Vec3& prevStart, const Vec3& prevEnd, const Vec3& start, const Vec3& end)
+    {
+        float startMoved = Length(start - prevStart);
+        float endMoved = Length(end - prevEnd);
+        return (startMoved > endMoved) ? startMoved : endMoved;
+    }
+
+    // Upper bound on next step's displacement for something that moved lastDisplacement
+    // this step and accelerates by at most maxAcceleration
+    inline float MaxNextStepDisplacement(float lastDisplacement, float maxAcceleration, float deltaTime)
+    {
+        return lastDisplacement + maxAcceleration * deltaTime * deltaTime;
+    }
+
+    // ============================================
+    // Broadphase (bounding spheres)
+    // ============================================
+
+    struct BoundingSphere
+    {
+        Vec3 center;
+        float radius;
+    };
+
+    // Sphere around a capsule, grown by `motion` - how far any point of it can move
+    // within the time window the narrowphase looks at
+    inline BoundingSphere CapsuleBounds(const Capsule& capsule, float motion)
+    {
+        return { (capsule.start + capsule.end) * 0.5f,
+                 Length(capsule.end - capsule.start) * 0.5f + capsule.radius + motion };
+    }
+
+    // Sphere around a disc, grown by `motion`
+    inline BoundingSphere DiscBounds(const Vec3& center, float radius, float motion)
+    {
+        return { center, radius + motion };
+    }
+
+    // Lower bound on the distance between anything inside a and anything inside b
+    // (negative when the spheres overlap)
+    inline float BoundingSphereGap(const BoundingSphere& a, const BoundingSphere& b)
+    {
+        return Length(a.center - b.center) - a.radius - b.radius;
+    }
+
+    // ============================================
+    // Swept (continuous) collision
+    // ============================================
+
+    // A segment whose endpoints move linearly: start(t) = start + startVelocity * t
+    struct SweptSegment
+    {
+        Vec3 start;
+        Vec3 end;
+        Vec3 startVelocity;
+        Vec3 endVelocity;
+
+        Vec3 StartAt(float t) const { return start + startVelocity * t; }
+        Vec3 EndAt(float t) const { return end + endVelocity * t; }
+    };
+
+    struct TimeOfImpactResult
+    {
+        float time = -1.0f;         // Seconds from the start of the sweep, -1 if no impact
+        float distance = FLT_MAX;   // Separation at 'time' (<= contactDistance + tolerance on impact)
+        float param1 = 0.0f;        // Parameter (0-1) along the first segment at impact
+        float param2 = 0.0f;        // Parameter (0-1) along the second segment (or 0 for a disc)
+        Vec3 point1;                // Closest point on the first segment at impact
+        Vec3 point2;                // Closest point on the second segment / disc at impact
+        int iterations = 0;
+        bool exhausted = false;     // Iteration budget ran out first: no impact found, but none ruled out
+    };
+
+    // Sweeps stop once the gap to contactDistance is below this (world units)
+    constexpr float kTimeOfImpactTolerance = 0.1f;
+    constexpr int kTimeOfImpactMaxIterations = 32;
+
+    // Every point of a swept segment moves with a velocity interpolated between its endpoint
+    // velocities, so the largest relative speed between any two points is reached at one of
+    // the four endpoint pairings (|vA(s) - vB(t)| is convex over the unit square).
+    inline float MaxRelativeSpeed(const SweptSegment& a, const SweptSegment& b)
+    {
+        float maxSq = LengthSquared(a.startVelocity - b.startVelocity);
+        float sq = LengthSquared(a.startVelocity - b.endVelocity);
+        if (sq > maxSq) maxSq = sq;
+        sq = LengthSquared(a.endVelocity - b.startVelocity);
+        if (sq > maxSq) maxSq = sq;
+        sq = LengthSquared(a.endVelocity - b.endVelocity);
+        if (sq > maxSq) maxSq = sq;
+        return std::sqrt(maxSq);
+    }
+
+    inline float MaxSpeed(const SweptSegment& a)
+    {
+        float startSq = LengthSquared(a.startVelocity);
+        float endSq = LengthSquared(a.endVelocity);
+        return std::sqrt(startSq > endSq ? startSq : endSq);
+    }
+
+    // Conservative advancement: the separation can shrink no faster than maxSpeed, so it is
+    // always safe to advance time by (distance - contactDistance) / maxSpeed. Repeating this
+    // converges on the first time the separation reaches contactDistance without stepping
+    // over a crossing. When the speed bound is loose for a pair (segments sliding past each
+    // other) the steps shrink and the budget can run out first; the sweep then reports
+    // out.exhausted rather than guessing, and the caller falls back to its discrete estimate.
+    template <typename DistanceAt>
+    inline bool ConservativeAdvance(DistanceAt&& distanceAt, float maxSpeed, float contactDistance,
+        float maxTime, TimeOfImpactResult& out)
+    {
+        out = TimeOfImpactResult();
+
+        float t = 0.0f;
+        for (int i = 0; i < kTimeOfImpactMaxIterations; i++)
+        {
+            out.iterations = i + 1;
+
+            float distance = distanceAt(t, out);
+            float gap = distance - contactDistance;
+            if (gap <= kTimeOfImpactTolerance)
+            {
+                out.time = t;
+                out.distance = distance;
+                return true;
+            }
+
+            if (maxSpeed <= 0.0f)
+                return false;   // Nothing moves - the gap can never close
+
+            t += gap / maxSpeed;
+            if (t > maxTime)
+                return false;
+        }
+
+        // Nothing touches before t, but the rest of [t, maxTime] is unknown
+        out.exhausted = true;
+        return false;
+    }
+
+    // First time within [0, maxTime] at which two moving segments come within contactDistance.
+    // Returns false if they never do (out.time = -1), or if out.exhausted is set.
+    inline bool SweptSegmentsTimeOfImpact(const SweptSegment& a, const SweptSegment& b,
+        float contactDistance, float maxTime, TimeOfImpactResult& out)
+    {
+        return ConservativeAdvance(
+            [&](float t, TimeOfImpactResult& result) {
+                return ClosestDistanceBetweenSegments(
+                    a.StartAt(t), a.EndAt(t), b.StartAt(t), b.EndAt(t),
+                    result.param1, result.param2, result.point1, result.point2);
+            },
+            MaxRelativeSpeed(a, b), contactDistance, maxTime, out);
+    }
+
+    // First time within [0, maxTime] at which a moving segment comes within contactDistance
+    // of a stationary disc. Returns false if it never does (out.time = -1).
+    inline bool SweptSegmentDiscTimeOfImpact(const SweptSegment& segment,
+        const Vec3& discCenter, const Vec3& discNormal, float discRadius,
+        float contactDistance, float maxTime, TimeOfImpactResult& out)
+    {
+        return ConservativeAdvance(
+            [&](float t, TimeOfImpactResult& result) {
+                result.param2 = 0.0f;
+                return ClosestDistanceSegmentToDisc(
+                    segment.StartAt(t), segment.EndAt(t), discCenter, discNormal, discRadius,
+                    result.param1, result.point1, result.point2);
+            },
+            MaxSpeed(segment), contactDistance, maxTime, out);
+    }
+
+    // As SweptSegmentDiscTimeOfImpact, against a stationary planar ellipse
+    inline bool SweptSegmentEllipseTimeOfImpact(const SweptSegment& segment, const PlanarEllipse& ellipse,
+        float contactDistance, float maxTime, TimeOfImpactResult& out)
+    {
+        return ConservativeAdvance(
+            [&](float t, TimeOfImpactResult& result) {
+                result.param2 = 0.0f;
+                return ClosestDistanceSegmentToEllipse(
+                    segment.StartAt(t), segment.EndAt(t), ellipse,
+                    result.param1, result.point1, result.point2);
+            },
+            MaxSpeed(segment), contactDistance, maxTime, out);
+    }
+
+    // ============================================
+    // X-Pose (crossed blades)
+    // ============================================
+
+    struct XPoseResult
+    {
+        Vec3 leftDir;               // Normalized left blade direction (base -> tip)
+        Vec3 rightDir;              // Normalized right blade direction (base -> tip)
+        float bladeAngle = 0.0f;    // Angle between blades in degrees
+        float leftForwardDot = 0.0f;
+        float rightForwardDot = 0.0f;
+        bool leftPointingUp = false;
+        bool rightPointingUp = false;
+        bool isCrossing = false;
+        bool facingForward = false;
+        bool isXPose = false;
+    };
+
+    // Classify two blades as an X-pose relative to the player's heading (radians, rot.z).
+    // Criteria:
+    //   1. Blades are crossing (30-150 degrees apart - not parallel, not same direction)
+    //   2. Both blades point somewhat upward (dir.z > 0.3)
+    //   3. Neither blade points backward (forward dot > -0.5)
+    // Returns false (and isXPose = false) if either blade is too short to have a direction.
+    inline bool EvaluateXPose(
+        const Vec3& leftBase, const Vec3& leftTip,
+        const Vec3& rightBase, const Vec3& rightTip,
+        float playerHeading, XPoseResult& out)
+    {
+        out = XPoseResult();
+
+        Vec3 leftDir = leftTip - leftBase;
+        Vec3 rightDir = rightTip - rightBase;
+
+        float leftLen = Length(leftDir);
+        float rightLen = Length(rightDir);
+        if (leftLen < 0.001f || rightLen < 0.001f)
+            return false;
+
+        out.leftDir = leftDir * (1.0f / leftLen);
+        out.rightDir = rightDir * (1.0f / rightLen);
+
+        // Skyrim: Y is forward at heading 0
+        Vec3 playerForward(std::sin(playerHeading), std::cos(playerHeading), 0.0f);
+
+        float bladeDot = Dot(out.leftDir, out.rightDir);
+        out.bladeAngle = std::acos(Clamp(bladeDot, -1.0f, 1.0f)) * (180.0f / 3.14159f);
+
+        out.leftForwardDot = out.leftDir.x * playerForward.x + out.leftDir.y * playerForward.y;
+        out.rightForwardDot = out.rightDir.x * playerForward.x + out.rightDir.y * playerForward.y;
+
+        out.leftPointingUp = out.leftDir.z > 0.3f;
+        out.rightPointingUp = out.rightDir.z > 0.3f;
+
+        out.isCrossing = (out.bladeAngle > 30.0f && out.bladeAngle < 150.0f);
+        out.facingForward = (out.leftForwardDot > -0.5f) && (out.rightForwardDot > -0.5f);
+        out.isXPose = out.isCrossing && out.leftPointingUp && out.rightPointingUp && out.facingForward;
+
+        return true;
+    }
+}
+}
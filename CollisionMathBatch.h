@@ -0,0 +1,284 @@
+#pragma once
+
+// ============================================
+// CollisionMathBatch - SoA segment-pair queries
+// ============================================
+// Evaluates ClosestDistanceBetweenSegments for many segment pairs at once
+// (player blades vs grabbed objects, NPC weapons, shield rim segments...).
+// Pairs are stored structure-of-arrays and processed 8 lanes at a time with
+// AVX2, 4 lanes with SSE2, or one at a time otherwise. Like CollisionMath.h
+// this header has no SKSE dependency.
+//
+// The kernel is the branch-free form of CollisionMath::ClosestDistanceBetweenSegments
+// (same epsilon, same clamping order) so batch and scalar results agree.
+
+#include "CollisionMath.h"
+
+#include <cstddef>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define COLLISIONMATH_BATCH_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define COLLISIONMATH_BATCH_SSE2 1
+#endif
+
+namespace FalseEdgeVR
+{
+namespace CollisionMath
+{
+    // Lane width the batch kernel is padded to (widest instruction set we may use)
+    constexpr size_t kBatchLaneWidth = 8;
+
+    // ============================================
+    // Segment Pair Batch (structure of arrays)
+    // ============================================
+
+    // Fixed-capacity batch - no allocation, safe to keep as a member and refill every frame.
+    // Capacity must be a multiple of kBatchLaneWidth; the kernel reads whole vectors and
+    // ignores lanes past Size().
+    template <size_t Capacity>
+    struct SegmentPairBatch
+    {
+        static_assert(Capacity % kBatchLaneWidth == 0, "SegmentPairBatch capacity must be a multiple of 8");
+
+        // Segment A [p1,q1]
+        alignas(32) float p1x[Capacity], p1y[Capacity], p1z[Capacity];
+        alignas(32) float q1x[Capacity], q1y[Capacity], q1z[Capacity];
+        // Segment B [p2,q2]
+        alignas(32) float p2x[Capacity], p2y[Capacity], p2z[Capacity];
+        alignas(32) float q2x[Capacity], q2y[Capacity], q2z[Capacity];
+
+        // Results, filled by ClosestDistanceBetweenSegmentsBatch
+        alignas(32) float distance[Capacity];
+        alignas(32) float param1[Capacity];     // 0-1 along segment A
+        alignas(32) float param2[Capacity];     // 0-1 along segment B
+
+        size_t count = 0;
+
+        SegmentPairBatch()
+        {
+            // Zeroed padding lanes are degenerate point pairs - no NaNs from stale data
+            for (size_t i = 0; i < Capacity; i++)
+            {
+                p1x[i] = p1y[i] = p1z[i] = q1x[i] = q1y[i] = q1z[i] = 0.0f;
+                p2x[i] = p2y[i] = p2z[i] = q2x[i] = q2y[i] = q2z[i] = 0.0f;
+            }
+        }
+
+        void Clear() { count = 0; }
+        size_t Size() const { return count; }
+        static constexpr size_t MaxSize() { return Capacity; }
+
+        // Returns false if the batch is full
+        bool Add(const Vec3& p1, const Vec3& q1, const Vec3& p2, const Vec3& q2)
+        {
+            if (count >= Capacity)
+                return false;
+
+            p1x[count] = p1.x; p1y[count] = p1.y; p1z[count] = p1.z;
+            q1x[count] = q1.x; q1y[count] = q1.y; q1z[count] = q1.z;
+            p2x[count] = p2.x; p2y[count] = p2.y; p2z[count] = p2.z;
+            q2x[count] = q2.x; q2y[count] = q2.y; q2z[count] = q2.z;
+            count++;
+            return true;
+        }
+    };
+
+    namespace BatchDetail
+    {
+        // ============================================
+        // Lane types
+        // ============================================
+        // Each wraps one register and exposes just what the kernel needs.
+        // Comparisons return a lane of all-ones/all-zeros masks for Select().
+
+        struct ScalarLanes
+        {
+            static constexpr size_t kWidth = 1;
+            float v;
+
+            static ScalarLanes Load(const float* p) { return { *p }; }
+            static ScalarLanes Set(float x) { return { x }; }
+            void Store(float* p) const { *p = v; }
+
+            friend ScalarLanes operator+(ScalarLanes a, ScalarLanes b) { return { a.v + b.v }; }
+            friend ScalarLanes operator-(ScalarLanes a, ScalarLanes b) { return { a.v - b.v }; }
+            friend ScalarLanes operator*(ScalarLanes a, ScalarLanes b) { return { a.v * b.v }; }
+            friend ScalarLanes operator/(ScalarLanes a, ScalarLanes b) { return { a.v / b.v }; }
+
+            static ScalarLanes Min(ScalarLanes a, ScalarLanes b) { return { a.v < b.v ? a.v : b.v }; }
+            static ScalarLanes Max(ScalarLanes a, ScalarLanes b) { return { a.v > b.v ? a.v : b.v }; }
+            static ScalarLanes Sqrt(ScalarLanes a) { return { std::sqrt(a.v) }; }
+
+            // Masks are plain bools in the scalar case
+            struct Mask { bool m; };
+            static Mask LessEqual(ScalarLanes a, ScalarLanes b) { return { a.v <= b.v }; }
+            static Mask Less(ScalarLanes a, ScalarLanes b) { return { a.v < b.v }; }
+            static Mask Greater(ScalarLanes a, ScalarLanes b) { return { a.v > b.v }; }
+            static Mask NotEqual(ScalarLanes a, ScalarLanes b) { return { a.v != b.v }; }
+            static ScalarLanes Select(Mask m, ScalarLanes ifTrue, ScalarLanes ifFalse) { return m.m ? ifTrue : ifFalse; }
+        };
+
+#if COLLISIONMATH_BATCH_SSE2
+        struct SseLanes
+        {
+            static constexpr size_t kWidth = 4;
+            __m128 v;
+
+            static SseLanes Load(const float* p) { return { _mm_load_ps(p) }; }
+            static SseLanes Set(float x) { return { _mm_set1_ps(x) }; }
+            void Store(float* p) const { _mm_store_ps(p, v); }
+
+            friend SseLanes operator+(SseLanes a, SseLanes b) { return { _mm_add_ps(a.v, b.v) }; }
+            friend SseLanes operator-(SseLanes a, SseLanes b) { return { _mm_sub_ps(a.v, b.v) }; }
+            friend SseLanes operator*(SseLanes a, SseLanes b) { return { _mm_mul_ps(a.v, b.v) }; }
+            friend SseLanes operator/(SseLanes a, SseLanes b) { return { _mm_div_ps(a.v, b.v) }; }
+
+            static SseLanes Min(SseLanes a, SseLanes b) { return { _mm_min_ps(a.v, b.v) }; }
+            static SseLanes Max(SseLanes a, SseLanes b) { return { _mm_max_ps(a.v, b.v) }; }
+            static SseLanes Sqrt(SseLanes a) { return { _mm_sqrt_ps(a.v) }; }
+
+            struct Mask { __m128 m; };
+            static Mask LessEqual(SseLanes a, SseLanes b) { return { _mm_cmple_ps(a.v, b.v) }; }
+            static Mask Less(SseLanes a, SseLanes b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+            static Mask Greater(SseLanes a, SseLanes b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+            static Mask NotEqual(SseLanes a, SseLanes b) { return { _mm_cmpneq_ps(a.v, b.v) }; }
+            static SseLanes Select(Mask m, SseLanes ifTrue, SseLanes ifFalse)
+            {
+                // SSE2 has no blendv
+                return { _mm_or_ps(_mm_and_ps(m.m, ifTrue.v), _mm_andnot_ps(m.m, ifFalse.v)) };
+            }
+        };
+#endif
+
+#if COLLISIONMATH_BATCH_AVX2
+        struct AvxLanes
+        {
+            static constexpr size_t kWidth = 8;
+            __m256 v;
+
+            static AvxLanes Load(const float* p) { return { _mm256_load_ps(p) }; }
+            static AvxLanes Set(float x) { return { _mm256_set1_ps(x) }; }
+            void Store(float* p) const { _mm256_store_ps(p, v); }
+
+            friend AvxLanes operator+(AvxLanes a, AvxLanes b) { return { _mm256_add_ps(a.v, b.v) }; }
+            friend AvxLanes operator-(AvxLanes a, AvxLanes b) { return { _mm256_sub_ps(a.v, b.v) }; }
+            friend AvxLanes operator*(AvxLanes a, AvxLanes b) { return { _mm256_mul_ps(a.v, b.v) }; }
+            friend AvxLanes operator/(AvxLanes a, AvxLanes b) { return { _mm256_div_ps(a.v, b.v) }; }
+
+            static AvxLanes Min(AvxLanes a, AvxLanes b) { return { _mm256_min_ps(a.v, b.v) }; }
+            static AvxLanes Max(AvxLanes a, AvxLanes b) { return { _mm256_max_ps(a.v, b.v) }; }
+            static AvxLanes Sqrt(AvxLanes a) { return { _mm256_sqrt_ps(a.v) }; }
+
+            struct Mask { __m256 m; };
+            static Mask LessEqual(AvxLanes a, AvxLanes b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+            static Mask Less(AvxLanes a, AvxLanes b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+            static Mask Greater(AvxLanes a, AvxLanes b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+            static Mask NotEqual(AvxLanes a, AvxLanes b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ) }; }
+            static AvxLanes Select(Mask m, AvxLanes ifTrue, AvxLanes ifFalse)
+            {
+                return { _mm256_blendv_ps(ifFalse.v, ifTrue.v, m.m) };
+            }
+        };
+#endif
+
+        // ============================================
+        // Kernel
+        // ============================================
+
+        // Processes lanes [begin, end) of the batch, kWidth at a time. end - begin must be a
+        // multiple of L::kWidth and begin must be aligned to it.
+        template <typename L, size_t Capacity>
+        inline void SegmentPairKernel(SegmentPairBatch<Capacity>& batch, size_t begin, size_t end)
+        {
+            const L zero = L::Set(0.0f);
+            const L one = L::Set(1.0f);
+            const L epsilon = L::Set(0.0001f);
+
+            for (size_t i = begin; i < end; i += L::kWidth)
+            {
+                L p1x = L::Load(batch.p1x + i), p1y = L::Load(batch.p1y + i), p1z = L::Load(batch.p1z + i);
+                L p2x = L::Load(batch.p2x + i), p2y = L::Load(batch.p2y + i), p2z = L::Load(batch.p2z + i);
+
+                L d1x = L::Load(batch.q1x + i) - p1x, d1y = L::Load(batch.q1y + i) - p1y, d1z = L::Load(batch.q1z + i) - p1z;
+                L d2x = L::Load(batch.q2x + i) - p2x, d2y = L::Load(batch.q2y + i) - p2y, d2z = L::Load(batch.q2z + i) - p2z;
+                L rx = p1x - p2x, ry = p1y - p2y, rz = p1z - p2z;
+
+                L a = d1x * d1x + d1y * d1y + d1z * d1z;
+                L e = d2x * d2x + d2y * d2y + d2z * d2z;
+                L f = d2x * rx + d2y * ry + d2z * rz;
+                L c = d1x * rx + d1y * ry + d1z * rz;
+                L b = d1x * d2x + d1y * d2y + d1z * d2z;
+
+                auto aDegenerate = L::LessEqual(a, epsilon);
+                auto eDegenerate = L::LessEqual(e, epsilon);
+
+                // Safe divisors - degenerate lanes are overwritten below
+                L safeA = L::Max(a, epsilon);
+                L safeE = L::Max(e, epsilon);
+
+                L denom = a * e - b * b;
+                auto denomNonZero = L::NotEqual(denom, zero);
+                L safeDenom = L::Select(denomNonZero, denom, one);
+
+                // General case
+                L s = L::Select(denomNonZero, L::Min(L::Max((b * f - c * e) / safeDenom, zero), one), zero);
+                L t = (b * s + f) / safeE;
+
+                L sIfTLow = L::Min(L::Max((zero - c) / safeA, zero), one);
+                L sIfTHigh = L::Min(L::Max((b - c) / safeA, zero), one);
+                s = L::Select(L::Less(t, zero), sIfTLow, L::Select(L::Greater(t, one), sIfTHigh, s));
+                t = L::Min(L::Max(t, zero), one);
+
+                // Segment B is a point
+                s = L::Select(eDegenerate, sIfTLow, s);
+                t = L::Select(eDegenerate, zero, t);
+
+                // Segment A is a point (or both are)
+                L tIfADegenerate = L::Select(eDegenerate, zero, L::Min(L::Max(f / safeE, zero), one));
+                s = L::Select(aDegenerate, zero, s);
+                t = L::Select(aDegenerate, tIfADegenerate, t);
+
+                // Distance between closest points
+                L dx = (p1x + d1x * s) - (p2x + d2x * t);
+                L dy = (p1y + d1y * s) - (p2y + d2y * t);
+                L dz = (p1z + d1z * s) - (p2z + d2z * t);
+
+                L::Sqrt(dx * dx + dy * dy + dz * dz).Store(batch.distance + i);
+                s.Store(batch.param1 + i);
+                t.Store(batch.param2 + i);
+            }
+        }
+    }
+
+    // Name of the instruction set the batch kernel was compiled for
+    inline const char* BatchInstructionSet()
+    {
+#if COLLISIONMATH_BATCH_AVX2
+        return "AVX2 (8 lanes)";
+#elif COLLISIONMATH_BATCH_SSE2
+        return "SSE2 (4 lanes)";
+#else
+        return "scalar";
+#endif
+    }
+
+    // Closest distance (and segment parameters) for every pair in the batch.
+    // Results are written to batch.distance / param1 / param2 for indices [0, Size()).
+    template <size_t Capacity>
+    inline void ClosestDistanceBetweenSegmentsBatch(SegmentPairBatch<Capacity>& batch)
+    {
+        // Round up to whole vectors; padding lanes are computed and ignored
+#if COLLISIONMATH_BATCH_AVX2
+        BatchDetail::SegmentPairKernel<BatchDetail::AvxLanes>(batch, 0, (batch.count + 7) & ~size_t(7));
+#elif COLLISIONMATH_BATCH_SSE2
+        BatchDetail::SegmentPairKernel<BatchDetail::SseLanes>(batch, 0, (batch.count + 3) & ~size_t(3));
+#else
+        BatchDetail::SegmentPairKernel<BatchDetail::ScalarLanes>(batch, 0, batch.count);
+#endif
+    }
+}
+}
@@ -0,0 +1,97 @@
+#include "DelayedTaskQueue.h"
+#include "Engine.h"
+#include "GameTaskBatch.h"
+
+namespace FalseEdgeVR
+{
+    DelayedTaskQueue* DelayedTaskQueue::GetSingleton()
+    {
+        static DelayedTaskQueue instance;
+        return &instance;
+    }
+
+    DelayedTaskQueue::~DelayedTaskQueue()
+    {
+        // Runs at process exit, under the loader lock - joining here can deadlock, so the
+        // worker is told to stop and let go. Undelivered tasks die with the process.
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        if (m_worker.joinable())
+            m_worker.detach();
+    }
+
+    void DelayedTaskQueue::Schedule(int delayMs, TaskDelegate* task)
+    {
+        if (!task)
+            return;
+
+        Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(delayMs > 0 ? delayMs : 0);
+
+        bool wakeWorker = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stop)
+            {
+                task->Dispose();
+                return;
+            }
+
+            if (!m_worker.joinable())
+            {
+                m_worker = std::thread(&DelayedTaskQueue::WorkerLoop, this);
+                LOG_INFO("DelayedTaskQueue: Worker thread started");
+            }
+
+            // Only an earlier deadline changes how long the worker should sleep
+            wakeWorker = m_queue.empty() || deadline < m_queue.top().deadline;
+            m_queue.push({ deadline, m_nextSequence++, task });
+        }
+
+        if (wakeWorker)
+            m_wake.notify_one();
+    }
+
+    size_t DelayedTaskQueue::GetPendingCount()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_queue.size();
+    }
+
+    void DelayedTaskQueue::WorkerLoop()
+    {
+        std::vector<TaskDelegate*> due;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_stop)
+        {
+            if (m_queue.empty())
+            {
+                m_wake.wait(lock);
+                continue;
+            }
+
+            Clock::time_point now = Clock::now();
+            if (m_queue.top().deadline > now)
+            {
+                m_wake.wait_until(lock, m_queue.top().deadline);
+                continue;
+            }
+
+            while (!m_queue.empty() && m_queue.top().deadline <= now)
+            {
+                due.push_back(m_queue.top().task);
+                m_queue.pop();
+            }
+
+            // Hand over without holding the lock - the batch may take the game's own task lock
+            lock.unlock();
+            for (TaskDelegate* task : due)
+                SubmitGameTask(task);
+            due.clear();
+            lock.lock();
+        }
+    }
+}
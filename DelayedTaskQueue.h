@@ -0,0 +1,67 @@
+#pragma once
+
+// ============================================
+// DelayedTaskQueue - run a game-thread task after a delay
+// ============================================
+// One long-lived worker thread holds a deadline-ordered queue. It sleeps on a condition
+// variable until the earliest deadline (or a new, earlier task) and then hands every due
+// task to SubmitGameTask, so the task itself still runs on the game thread. This replaces
+// spawning a detached sleep thread per delayed call.
+//
+// The worker starts with the first Schedule() and lives as long as the process.
+
+#include "skse64/PluginAPI.h"
+#include "skse64/gamethreads.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace FalseEdgeVR
+{
+    class DelayedTaskQueue
+    {
+    public:
+        static DelayedTaskQueue* GetSingleton();
+
+        // Queues task for the game thread after delayMs. Takes ownership; tasks due at the same time
+        // are posted in the order they were scheduled. Callable from any thread.
+        void Schedule(int delayMs, TaskDelegate* task);
+
+        size_t GetPendingCount();
+
+    private:
+        DelayedTaskQueue() = default;
+        ~DelayedTaskQueue();
+        DelayedTaskQueue(const DelayedTaskQueue&) = delete;
+        DelayedTaskQueue& operator=(const DelayedTaskQueue&) = delete;
+
+        typedef std::chrono::steady_clock Clock;
+
+        struct Entry
+        {
+            Clock::time_point deadline;
+            UInt64 sequence;
+            TaskDelegate* task;
+
+            // Earliest deadline on top of the heap, FIFO between equal deadlines
+            bool operator<(const Entry& other) const
+            {
+                if (deadline != other.deadline)
+                    return deadline > other.deadline;
+                return sequence > other.sequence;
+            }
+        };
+
+        void WorkerLoop();
+
+        std::priority_queue<Entry> m_queue;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::thread m_worker;
+        UInt64 m_nextSequence = 0;
+        bool m_stop = false;
+    };
+}
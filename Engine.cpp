@@ -3,12 +3,14 @@
 #include "VRInputHandler.h"
 #include "WeaponGeometry.h"
 #include "ShieldCollision.h"
+#include "DelayedTaskQueue.h"
+#include "GameTaskBatch.h"
+#include "TaskPool.h"
 #include "skse64/GameObjects.h"
 #include <skse64/PapyrusActor.cpp>
 #include "skse64/GameRTTI.h"
 #include "skse64/PapyrusVM.h"
 #include "skse64/GameExtraData.h"
-#include <thread>
 #include <chrono>
 
 namespace FalseEdgeVR
@@ -26,8 +28,8 @@ namespace FalseEdgeVR
 	typedef bool(*_CastSpell)(VMClassRegistry* registry, UInt32 stackId, SpellItem* spell, TESObjectREFR* akSource, TESObjectREFR* akTarget);
 	RelocAddr<_CastSpell> CastSpell_Native(0x009BB6B0);
 
-	// Task to cast spell on main game thread
-	class CastSpellOnPlayerTask : public TaskDelegate
+	// Task to cast spell on main game thread (pooled, runs in the next game task batch)
+	class CastSpellOnPlayerTask : public PooledTask<CastSpellOnPlayerTask>
 	{
 	public:
 		UInt32 m_formId;
@@ -39,32 +41,27 @@ namespace FalseEdgeVR
 			Actor* player = *g_thePlayer;
 			if (!player)
 			{
-				_MESSAGE("[CastSpell] ERROR: Player not available");
+				LOG_ERROR("[CastSpell] ERROR: Player not available");
 				return;
 			}
 
 			TESForm* form = LookupFormByID(m_formId);
 			if (!form)
 			{
-				_MESSAGE("[CastSpell] ERROR: Spell form %08X not found", m_formId);
+				LOG_ERROR("[CastSpell] ERROR: Spell form %08X not found", m_formId);
 				return;
 			}
 
 			SpellItem* spell = DYNAMIC_CAST(form, TESForm, SpellItem);
 			if (!spell)
 			{
-				_MESSAGE("[CastSpell] ERROR: Form %08X is not a SpellItem", m_formId);
+				LOG_ERROR("[CastSpell] ERROR: Form %08X is not a SpellItem", m_formId);
 				return;
 			}
 
 			// Cast the spell on the player (source = player, target = player for self-cast spells)
 			bool result = CastSpell_Native((*g_skyrimVM)->GetClassRegistry(), 0, spell, player, player);
-			_MESSAGE("[CastSpell] Cast spell %08X on player, result: %s", m_formId, result ? "success" : "failed");
-		}
-
-		virtual void Dispose() override
-		{
-			delete this;
+			LOG_INFO("[CastSpell] Cast spell %08X on player, result: %s", m_formId, result ? "success" : "failed");
 		}
 	};
 
@@ -72,19 +69,19 @@ namespace FalseEdgeVR
 	{
 		if (formId == 0)
 		{
-			_MESSAGE("[CastSpell] ERROR: Invalid formId 0");
+			ALOG_ERROR("[CastSpell] ERROR: Invalid formId 0");
 			return;
 		}
 
 		extern SKSETaskInterface* g_task;
 		if (g_task)
 		{
-			g_task->AddTask(new CastSpellOnPlayerTask(formId));
-			_MESSAGE("[CastSpell] Queued spell cast %08X on player", formId);
+			SubmitGameTask(CastSpellOnPlayerTask::Create(formId));
+			ALOG_INFO("[CastSpell] Queued spell cast %08X on player", formId);
 		}
 		else
 		{
-			_MESSAGE("[CastSpell] ERROR: g_task not available!");
+			ALOG_ERROR("[CastSpell] ERROR: g_task not available!");
 		}
 	}
 
@@ -103,7 +100,7 @@ namespace FalseEdgeVR
 		PlayerCharacter* player = *g_thePlayer;
 		if (!player)
 		{
-			_MESSAGE("[PlaySound] ERROR: Player not available");
+			ALOG_ERROR("[PlaySound] ERROR: Player not available");
 			return;
 		}
 
@@ -111,7 +108,7 @@ namespace FalseEdgeVR
 		TESForm* form = LookupFormByID(soundFormId);
 		if (!form)
 		{
-			_MESSAGE("[PlaySound] ERROR: Failed to find sound form %08X", soundFormId);
+			ALOG_ERROR("[PlaySound] ERROR: Failed to find sound form %08X", soundFormId);
 			return;
 		}
 
@@ -119,14 +116,14 @@ namespace FalseEdgeVR
 		TESSound* sound = DYNAMIC_CAST(form, TESForm, TESSound);
 		if (!sound)
 		{
-			_MESSAGE("[PlaySound] ERROR: Form %08X is not a TESSound (type=%d, expected=%d)",
+			ALOG_ERROR("[PlaySound] ERROR: Form %08X is not a TESSound (type=%d, expected=%d)",
 				soundFormId, form->formType, kFormType_Sound);
 			return;
 		}
 
 		// Play the sound using the Papyrus native function
 		PlaySoundEffect((*g_skyrimVM)->GetClassRegistry(), 0, sound, player);
-		_MESSAGE("[PlaySound] Played sound %08X at player", soundFormId);
+		ALOG_INFO("[PlaySound] Played sound %08X at player", soundFormId);
 	}
 
 	// Play a sound at any actor's location (NPC or player)
@@ -135,7 +132,7 @@ namespace FalseEdgeVR
 	{
 		if (!actor)
 		{
-			_MESSAGE("[PlaySound] ERROR: Actor not available");
+			ALOG_ERROR("[PlaySound] ERROR: Actor not available");
 			return;
 		}
 
@@ -143,7 +140,7 @@ namespace FalseEdgeVR
 		TESForm* form = LookupFormByID(soundFormId);
 		if (!form)
 		{
-			_MESSAGE("[PlaySound] ERROR: Failed to find sound form %08X", soundFormId);
+			ALOG_ERROR("[PlaySound] ERROR: Failed to find sound form %08X", soundFormId);
 			return;
 		}
 
@@ -151,7 +148,7 @@ namespace FalseEdgeVR
 		TESSound* sound = DYNAMIC_CAST(form, TESForm, TESSound);
 		if (!sound)
 		{
-			_MESSAGE("[PlaySound] ERROR: Form %08X is not a TESSound (type=%d, expected=%d)",
+			ALOG_ERROR("[PlaySound] ERROR: Form %08X is not a TESSound (type=%d, expected=%d)",
 				soundFormId, form->formType, kFormType_Sound);
 			return;
 		}
@@ -166,14 +163,14 @@ namespace FalseEdgeVR
 	{
 		if (!objRef)
 		{
-			_MESSAGE("[SetOwner] ERROR: Object reference is null");
+			ALOG_ERROR("[SetOwner] ERROR: Object reference is null");
 			return;
 		}
 
 		PlayerCharacter* player = *g_thePlayer;
 		if (!player)
 		{
-			_MESSAGE("[SetOwner] ERROR: Player not available");
+			ALOG_ERROR("[SetOwner] ERROR: Player not available");
 			return;
 		}
 
@@ -191,7 +188,7 @@ namespace FalseEdgeVR
 				{
 					ExtraOwnership* ownership = static_cast<ExtraOwnership*>(existing);
 					ownership->owner = player;
-					_MESSAGE("[SetOwner] Updated existing ownership to player (RefID: %08X)", objRef->formID);
+					ALOG_INFO("[SetOwner] Updated existing ownership to player (RefID: %08X)", objRef->formID);
 					return;
 				}
 				existing = existing->next;
@@ -206,11 +203,11 @@ namespace FalseEdgeVR
 		{
 			xOwnership->owner = player;
 			extraList->Add(kExtraData_Ownership, xOwnership);
-			_MESSAGE("[SetOwner] Set ownership to player for RefID: %08X", objRef->formID);
+			ALOG_INFO("[SetOwner] Set ownership to player for RefID: %08X", objRef->formID);
 		}
 		else
 		{
-			_MESSAGE("[SetOwner] ERROR: Failed to create ExtraOwnership");
+			ALOG_ERROR("[SetOwner] ERROR: Failed to create ExtraOwnership");
 		}
 	}
 
@@ -226,16 +223,16 @@ namespace FalseEdgeVR
 	{
 		if (!objRef)
 		{
-			_MESSAGE("[DeleteWorldObject] ERROR: Object reference is null");
+			ALOG_ERROR("[DeleteWorldObject] ERROR: Object reference is null");
 			return;
 		}
 
-		_MESSAGE("[DeleteWorldObject] Deleting world object RefID: %08X", objRef->formID);
+		ALOG_INFO("[DeleteWorldObject] Deleting world object RefID: %08X", objRef->formID);
 		
 		// Call the Papyrus Delete function
 		DeleteObject_Native((*g_skyrimVM)->GetClassRegistry(), 0, objRef);
 		
-		_MESSAGE("[DeleteWorldObject] Delete command sent for RefID: %08X", objRef->formID);
+		ALOG_INFO("[DeleteWorldObject] Delete command sent for RefID: %08X", objRef->formID);
 	}
 
 	// ============================================
@@ -244,7 +241,7 @@ namespace FalseEdgeVR
 	
 	// Task to check and re-equip weapons after removal has been processed
 	// Must be defined BEFORE DelayedRemoveItemTask since it uses this class
-	class DelayedReequipCheckTask : public TaskDelegate
+	class DelayedReequipCheckTask : public PooledTask<DelayedReequipCheckTask>
 	{
 	public:
 		UInt32 m_itemFormId;
@@ -259,14 +256,14 @@ namespace FalseEdgeVR
 			PlayerCharacter* player = *g_thePlayer;
 			if (!player)
 			{
-				_MESSAGE("[ReequipCheck] ERROR: Player not available");
+				LOG_ERROR("[ReequipCheck] ERROR: Player not available");
 				return;
 			}
 
 			TESForm* itemForm = LookupFormByID(m_itemFormId);
 			if (!itemForm)
 			{
-				_MESSAGE("[ReequipCheck] ERROR: Item form %08X not found", m_itemFormId);
+				LOG_ERROR("[ReequipCheck] ERROR: Item form %08X not found", m_itemFormId);
 				return;
 			}
 
@@ -277,7 +274,7 @@ namespace FalseEdgeVR
 			bool leftStillHasWeapon = (leftEquippedAfter && leftEquippedAfter->formID == m_itemFormId);
 			bool rightStillHasWeapon = (rightEquippedAfter && rightEquippedAfter->formID == m_itemFormId);
 			
-			_MESSAGE("[ReequipCheck] After removal processed - Left equipped: %s, Right equipped: %s",
+			LOG_INFO("[ReequipCheck] After removal processed - Left equipped: %s, Right equipped: %s",
 				leftStillHasWeapon ? "YES" : "NO", rightStillHasWeapon ? "YES" : "NO");
 			
 			::EquipManager* equipMan = ::EquipManager::GetSingleton();
@@ -286,7 +283,7 @@ namespace FalseEdgeVR
 				// Check LEFT hand
 				if (m_leftHadWeapon && !leftStillHasWeapon)
 				{
-					_MESSAGE("[ReequipCheck] LEFT hand weapon was unequipped - re-equipping!");
+					LOG_INFO("[ReequipCheck] LEFT hand weapon was unequipped - re-equipping!");
 					BGSEquipSlot* leftSlot = GetLeftHandSlot();
 					FalseEdgeVR::EquipManager::s_suppressDrawSound = true;
 					
@@ -308,13 +305,13 @@ namespace FalseEdgeVR
 					}
 					
 					FalseEdgeVR::EquipManager::s_suppressDrawSound = false;
-					_MESSAGE("[ReequipCheck] Re-equipped weapon to LEFT hand (silent)");
+					LOG_INFO("[ReequipCheck] Re-equipped weapon to LEFT hand (silent)");
 				}
 				
 				// Check RIGHT hand
 				if (m_rightHadWeapon && !rightStillHasWeapon)
 				{
-					_MESSAGE("[ReequipCheck] RIGHT hand weapon was unequipped - re-equipping!");
+					LOG_INFO("[ReequipCheck] RIGHT hand weapon was unequipped - re-equipping!");
 					BGSEquipSlot* rightSlot = GetRightHandSlot();
 					FalseEdgeVR::EquipManager::s_suppressDrawSound = true;
 					// Temporarily strip enchantment to prevent enchant VFX/sound
@@ -334,19 +331,14 @@ namespace FalseEdgeVR
 						weap2->enchantable.enchantment = cachedEnchant2;
 					}
 					FalseEdgeVR::EquipManager::s_suppressDrawSound = false;
-					_MESSAGE("[ReequipCheck] Re-equipped weapon to RIGHT hand (silent)");
+					LOG_INFO("[ReequipCheck] Re-equipped weapon to RIGHT hand (silent)");
 				}
 			}
 		}
-
-		virtual void Dispose() override
-		{
-			delete this;
-		}
 	};
 
 	// Task to remove item from player inventory on game thread
-	class DelayedRemoveItemTask : public TaskDelegate
+	class DelayedRemoveItemTask : public PooledTask<DelayedRemoveItemTask>
 	{
 	public:
 		UInt32 m_itemFormId;
@@ -358,14 +350,14 @@ namespace FalseEdgeVR
 			PlayerCharacter* player = *g_thePlayer;
 			if (!player)
 			{
-				_MESSAGE("[DelayedRemove] ERROR: Player not available");
+				LOG_ERROR("[DelayedRemove] ERROR: Player not available");
 				return;
 			}
 
 			TESForm* itemForm = LookupFormByID(m_itemFormId);
 			if (!itemForm)
 			{
-				_MESSAGE("[DelayedRemove] ERROR: Item form %08X not found", m_itemFormId);
+				LOG_ERROR("[DelayedRemove] ERROR: Item form %08X not found", m_itemFormId);
 				return;
 			}
 
@@ -376,7 +368,7 @@ namespace FalseEdgeVR
 			bool leftHadWeapon = (leftEquippedBefore && leftEquippedBefore->formID == m_itemFormId);
 			bool rightHadWeapon = (rightEquippedBefore && rightEquippedBefore->formID == m_itemFormId);
 			
-			_MESSAGE("[DelayedRemove] Before removal - Left equipped: %s, Right equipped: %s",
+			LOG_INFO("[DelayedRemove] Before removal - Left equipped: %s, Right equipped: %s",
 				leftHadWeapon ? "YES" : "NO", rightHadWeapon ? "YES" : "NO");
 
 			// Get container changes to check inventory
@@ -385,7 +377,7 @@ namespace FalseEdgeVR
 			
 			if (!containerChanges || !containerChanges->data)
 			{
-				_MESSAGE("[DelayedRemove] No container changes data");
+				LOG_INFO("[DelayedRemove] No container changes data");
 				return;
 			}
 
@@ -393,7 +385,7 @@ namespace FalseEdgeVR
 			InventoryEntryData* entryData = containerChanges->data->FindItemEntry(itemForm);
 			if (!entryData)
 			{
-				_MESSAGE("[DelayedRemove] Item %08X not found in inventory", m_itemFormId);
+				LOG_WARN("[DelayedRemove] Item %08X not found in inventory", m_itemFormId);
 				return;
 			}
 
@@ -408,7 +400,7 @@ namespace FalseEdgeVR
 			// Only remove if we have MORE than what's equipped
 			if (totalCount > equippedCount)
 			{
-				_MESSAGE("[DelayedRemove] Removing 1x %08X from inventory (total: %d, equipped: %d)", 
+				LOG_INFO("[DelayedRemove] Removing 1x %08X from inventory (total: %d, equipped: %d)", 
 					m_itemFormId, totalCount, equippedCount);
 				RemoveItemFromInventory(player, itemForm, 1, true);
 				
@@ -417,51 +409,29 @@ namespace FalseEdgeVR
 				extern SKSETaskInterface* g_task;
 				if (g_task)
 				{
-					g_task->AddTask(new DelayedReequipCheckTask(m_itemFormId, leftHadWeapon, rightHadWeapon));
-					_MESSAGE("[DelayedRemove] Scheduled re-equip check task");
+					SubmitGameTask(DelayedReequipCheckTask::Create(m_itemFormId, leftHadWeapon, rightHadWeapon));
+					LOG_INFO("[DelayedRemove] Scheduled re-equip check task");
 				}
 			}
 			else
 			{
-				_MESSAGE("[DelayedRemove] NOT removing %08X - would remove equipped item (total: %d, equipped: %d)", 
+				LOG_INFO("[DelayedRemove] NOT removing %08X - would remove equipped item (total: %d, equipped: %d)", 
 					m_itemFormId, totalCount, equippedCount);
 			}
 		}
-
-		virtual void Dispose() override
-		{
-			delete this;
-		}
 	};
 
-	// Thread function to delay then queue the removal task
-	static void DelayedRemoveItemThread(UInt32 itemFormId, int delayMs)
-	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-		
-		extern SKSETaskInterface* g_task;
-		if (g_task)
-		{
-			g_task->AddTask(new DelayedRemoveItemTask(itemFormId));
-			_MESSAGE("[DelayedRemove] Queued item removal after %dms delay for item %08X", delayMs, itemFormId);
-		}
-		else
-		{
-			_MESSAGE("[DelayedRemove] ERROR: g_task not available!");
-		}
-	}
-
 	void DelayedRemoveItemFromInventory(UInt32 itemFormId, int delayMs)
 	{
 		if (itemFormId == 0)
 		{
-			_MESSAGE("[DelayedRemove] ERROR: Invalid itemFormId 0");
+			LOG_ERROR("[DelayedRemove] ERROR: Invalid itemFormId 0");
 			return;
 		}
 
-		// Start a detached thread to handle the delay
-		std::thread(DelayedRemoveItemThread, itemFormId, delayMs).detach();
-		_MESSAGE("[DelayedRemove] Started delayed removal thread for item %08X (delay: %dms)", itemFormId, delayMs);
+		// Posted to the game thread by the delayed task queue once the delay has passed
+		DelayedTaskQueue::GetSingleton()->Schedule(delayMs, DelayedRemoveItemTask::Create(itemFormId));
+		LOG_INFO("[DelayedRemove] Scheduled item removal for item %08X (delay: %dms)", itemFormId, delayMs);
 	}
 
 	// ============================================
@@ -485,13 +455,13 @@ namespace FalseEdgeVR
 		Actor* player = *g_thePlayer;
 		if (!player)
 		{
-			_MESSAGE("[Blocking] ERROR: Player not available");
+			ALOG_ERROR("[Blocking] ERROR: Player not available");
 			return;
 		}
 		
 		static BSFixedString s_blockStart("blockStart");
 		get_vfunc<_IAnimationGraphManagerHolder_NotifyAnimationGraph>(&player->animGraphHolder, 0x1)(&player->animGraphHolder, s_blockStart);
-		_MESSAGE("[Blocking] Started blocking (X-Pose)");
+		ALOG_INFO("[Blocking] Started blocking (X-Pose)");
 	}
 	
 	void StopBlocking()
@@ -499,13 +469,13 @@ namespace FalseEdgeVR
 		Actor* player = *g_thePlayer;
 		if (!player)
 		{
-			_MESSAGE("[Blocking] ERROR: Player not available");
+			ALOG_ERROR("[Blocking] ERROR: Player not available");
 			return;
 		}
 		
 		static BSFixedString s_blockStop("blockStop");
 		get_vfunc<_IAnimationGraphManagerHolder_NotifyAnimationGraph>(&player->animGraphHolder, 0x1)(&player->animGraphHolder, s_blockStop);
-		_MESSAGE("[Blocking] Stopped blocking (X-Pose ended)");
+		ALOG_INFO("[Blocking] Stopped blocking (X-Pose ended)");
 	}
 	
 	bool IsBlocking()
@@ -580,17 +550,17 @@ namespace FalseEdgeVR
 		// This function is called during DataLoaded, before HIGGS is ready
 		// Only do non-HIGGS dependent initialization here
 		
-		LOG("StartMod: FalseEdgeVR starting...");
+		LOG_WARN("StartMod: FalseEdgeVR starting...");
 		
 		// Log initial left-handed mode
-		_MESSAGE("==============================================");
-		_MESSAGE("[LeftHandedMode] VR Controller Mode: %s", IsLeftHandedMode() ? "LEFT-HANDED" : "RIGHT-HANDED (default)");
+		LOG_INFO("==============================================");
+		LOG_INFO("[LeftHandedMode] VR Controller Mode: %s", IsLeftHandedMode() ? "LEFT-HANDED" : "RIGHT-HANDED (default)");
 		if (IsLeftHandedMode())
 		{
-			_MESSAGE("[LeftHandedMode] NOTE: In left-handed mode, VR controllers are inverted!");
-			_MESSAGE("[LeftHandedMode]   Left VR controller  -> Right game hand");
-			_MESSAGE("[LeftHandedMode]   Right VR controller -> Left game hand");
+			LOG_INFO("[LeftHandedMode] NOTE: In left-handed mode, VR controllers are inverted!");
+			LOG_INFO("[LeftHandedMode]   Left VR controller  -> Right game hand");
+			LOG_INFO("[LeftHandedMode]   Right VR controller -> Left game hand");
 		}
-		_MESSAGE("==============================================");
+		LOG_INFO("==============================================");
 	}
 }
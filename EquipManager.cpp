@@ -2,13 +2,17 @@
 #include "VRInputHandler.h"
 #include "Engine.h"
 #include "SkyrimVRESLAPI.h"
+#include "DelayedTaskQueue.h"
+#include "TaskPool.h"
+#include "NodeCache.h"
+#include "GameEventQueue.h"
+#include "AsyncLog.h"
 #include "skse64/GameData.h"
 #include "skse64/GameForms.h"
 #include "skse64/GameExtraData.h"
 #include "skse64/GameReferences.h"
 #include "skse64/PapyrusActor.h"
 #include "skse64/PluginAPI.h"
-#include <thread>
 #include <chrono>
 #include <unordered_map>
 #include <mutex>
@@ -30,7 +34,7 @@ namespace FalseEdgeVR
     // ============================================
     // Delayed Equip Weapon Task (runs on game thread)
     // ============================================
-    class DelayedEquipWeaponTask : public TaskDelegate
+    class DelayedEquipWeaponTask : public PooledTask<DelayedEquipWeaponTask>
     {
     public:
         UInt32 m_weaponFormId;
@@ -44,21 +48,21 @@ namespace FalseEdgeVR
             Actor* player = (*g_thePlayer);
             if (!player)
             {
-                _MESSAGE("[DelayedEquipWeapon] Player not available");
+                LOG_WARN("[DelayedEquipWeapon] Player not available");
                 return;
             }
 
             TESForm* weaponForm = LookupFormByID(m_weaponFormId);
             if (!weaponForm)
             {
-                _MESSAGE("[DelayedEquipWeapon] Weapon form %08X not found", m_weaponFormId);
+                LOG_WARN("[DelayedEquipWeapon] Weapon form %08X not found", m_weaponFormId);
                 return;
             }
 
             ::EquipManager* equipMan = ::EquipManager::GetSingleton();
             if (!equipMan)
             {
-                _MESSAGE("[DelayedEquipWeapon] EquipManager not available");
+                LOG_WARN("[DelayedEquipWeapon] EquipManager not available");
                 return;
             }
 
@@ -67,32 +71,18 @@ namespace FalseEdgeVR
 
             // EquipItem params: actor, item, extraData, count, slot, withEquipSound, preventUnequip, showMsg, unk
             CALL_MEMBER_FN(equipMan, EquipItem)(player, weaponForm, nullptr,1, slot, false, true, false, nullptr);
-            _MESSAGE("[DelayedEquipWeapon] Equipped weapon %08X to %s hand (silent)", m_weaponFormId, m_equipToLeftHand ? "LEFT" : "RIGHT");
-        }
-
-        virtual void Dispose() override
-        {
-            delete this;
+            LOG_INFO("[DelayedEquipWeapon] Equipped weapon %08X to %s hand (silent)", m_weaponFormId, m_equipToLeftHand ? "LEFT" : "RIGHT");
         }
     };
 
     // ============================================
-    // Thread function to delay then queue the equip task
+    // Queue the equip task after a delay
     // ============================================
-    static void DelayedEquipWeaponThread(UInt32 weaponFormId, bool equipToLeftHand, int delayMs)
+    static void DelayedEquipWeapon(UInt32 weaponFormId, bool equipToLeftHand, int delayMs)
     {
-        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
-   
-        if (g_task)
-        {
-            g_task->AddTask(new DelayedEquipWeaponTask(weaponFormId, equipToLeftHand));
-            _MESSAGE("[EquipManager] Queued weapon equip task after %dms delay for weapon %08X to %s hand", 
-        delayMs, weaponFormId, equipToLeftHand ? "LEFT" : "RIGHT");
-        }
-        else
-        {
-            _MESSAGE("[EquipManager] ERROR: g_task not available for delayed equip!");
-        }
+        DelayedTaskQueue::GetSingleton()->Schedule(delayMs, DelayedEquipWeaponTask::Create(weaponFormId, equipToLeftHand));
+        ALOG_INFO("[EquipManager] Scheduled weapon equip task in %dms for weapon %08X to %s hand", 
+            delayMs, weaponFormId, equipToLeftHand ? "LEFT" : "RIGHT");
     }
 
     // ============================================
@@ -191,32 +181,32 @@ static UInt32 cachedSwordSound = 0;
      cachedAxeSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x808);
           cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
         soundsCached = true;
-    _MESSAGE("EquipManager: Cached weapon draw sounds - Dagger:%08X, Sword:%08X, Axe:%08X, Mace:%08X",
+    ALOG_INFO("EquipManager: Cached weapon draw sounds - Dagger:%08X, Sword:%08X, Axe:%08X, Mace:%08X",
        cachedDaggerSound, cachedSwordSound, cachedAxeSound, cachedMaceSound);
      }
       
   switch (type)
      {
     case WeaponType::Dagger:
-    _MESSAGE(">>> NPC EQUIPPED: DAGGER - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
+    ALOG_INFO(">>> NPC EQUIPPED: DAGGER - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
     npcName ? npcName : "Unknown", actor->formID, distance, item->formID);
    if (cachedDaggerSound != 0)
    PlaySoundAtActor(cachedDaggerSound, actor);
    break;
    case WeaponType::Sword:
-    _MESSAGE(">>> NPC EQUIPPED: 1H SWORD - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
+    ALOG_INFO(">>> NPC EQUIPPED: 1H SWORD - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
        npcName ? npcName : "Unknown", actor->formID, distance, item->formID);
         if (cachedSwordSound != 0)
        PlaySoundAtActor(cachedSwordSound, actor);
    break;
   case WeaponType::Mace:
-  _MESSAGE(">>> NPC EQUIPPED: 1H MACE - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
+  ALOG_INFO(">>> NPC EQUIPPED: 1H MACE - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
   npcName ? npcName : "Unknown", actor->formID, distance, item->formID);
    if (cachedMaceSound != 0)
        PlaySoundAtActor(cachedMaceSound, actor);
    break;
 case WeaponType::Axe:
- _MESSAGE(">>> NPC EQUIPPED: 1H AXE - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
+ ALOG_INFO(">>> NPC EQUIPPED: 1H AXE - NPC: %s (RefID: %08X), Distance: %.1f units, WeaponID: %08X",
   npcName ? npcName : "Unknown", actor->formID, distance, item->formID);
         if (cachedAxeSound != 0)
    PlaySoundAtActor(cachedAxeSound, actor);
@@ -235,7 +225,7 @@ case WeaponType::Axe:
         if (actor != *g_thePlayer)
         return kEvent_Continue;
 
-     _MESSAGE("EquipEventHandler: Received equip event for FormID %08X, equipped=%d", evn->baseObject, evn->equipped);
+     ALOG_INFO("EquipEventHandler: Received equip event for FormID %08X, equipped=%d", evn->baseObject, evn->equipped);
 
      // Determining which hand based on the equipped flag
      
@@ -244,6 +234,10 @@ case WeaponType::Axe:
         TESForm* leftEquipped = actor->GetEquippedObject(true);
         TESForm* rightEquipped = actor->GetEquippedObject(false);
         
+      // The draw sound and its cooldown are decided here, while s_suppressDrawSound still
+      // reflects the re-equip that caused this event. The equip state itself is updated
+      // from the event queue on the next physics step (the hand of an unequip is resolved
+      // there, from the tracked state).
       if (isEquipping)
 {
      if (leftEquipped && leftEquipped->formID == item->formID)
@@ -251,17 +245,13 @@ case WeaponType::Axe:
    else if (rightEquipped && rightEquipped->formID == item->formID)
          isLeftHand = false;
             
-EquipManager::GetSingleton()->OnEquip(item, actor, isLeftHand);
+EquipManager::PlayEquipSound(item, isLeftHand);
+            PushGameEvent(GameEventType::PlayerEquip, isLeftHand, item->formID);
    }
         else
         {
- const PlayerEquipState& state = EquipManager::GetSingleton()->GetEquipState();
-            if (state.leftHand.form && state.leftHand.form->formID == item->formID)
-      isLeftHand = true;
-        else if (state.rightHand.form && state.rightHand.form->formID == item->formID)
-   isLeftHand = false;
-  
-            EquipManager::GetSingleton()->OnUnequip(item, actor, isLeftHand);
+            EquipManager::RecordUnequipTime(item);
+            PushGameEvent(GameEventType::PlayerUnequip, false, item->formID);
    }
 
       return kEvent_Continue;
@@ -282,13 +272,13 @@ EquipManager::GetSingleton()->OnEquip(item, actor, isLeftHand);
         if (m_initialized)
           return;
 
-        _MESSAGE("EquipManager: Initializing...");
+        LOG_INFO("EquipManager: Initializing...");
         
         m_equipState.leftHand.Clear();
       m_equipState.rightHand.Clear();
         
         m_initialized = true;
-     _MESSAGE("EquipManager: Initialized successfully");
+     LOG_INFO("EquipManager: Initialized successfully");
     }
 
     void EquipManager::UpdateEquipmentState()
@@ -296,14 +286,14 @@ EquipManager::GetSingleton()->OnEquip(item, actor, isLeftHand);
         PlayerCharacter* player = *g_thePlayer;
         if (!player)
    {
-   _MESSAGE("EquipManager::UpdateEquipmentState - No player!");
+   ALOG_WARN("EquipManager::UpdateEquipmentState - No player!");
       return;
       }
 
   TESForm* leftItem = player->GetEquippedObject(true);
         TESForm* rightItem = player->GetEquippedObject(false);
 
- _MESSAGE("EquipManager::UpdateEquipmentState - Left: %08X, Right: %08X", 
+ ALOG_INFO("EquipManager::UpdateEquipmentState - Left: %08X, Right: %08X", 
             leftItem ? leftItem->formID : 0, 
       rightItem ? rightItem->formID : 0);
 
@@ -354,7 +344,7 @@ EquipManager::GetSingleton()->OnEquip(item, actor, isLeftHand);
     {
          modIsLoaded = true;
          modIndex = modInfo->GetPartialIndex();
-        _MESSAGE("EquipManager: Interactive_Pipe_Smoking_VR.esp detected (index: %02X) - pipe weapons will be excluded from draw sounds", modIndex);
+        ALOG_INFO("EquipManager: Interactive_Pipe_Smoking_VR.esp detected (index: %02X) - pipe weapons will be excluded from draw sounds", modIndex);
       }
             }
      }
@@ -392,7 +382,7 @@ EquipManager::GetSingleton()->OnEquip(item, actor, isLeftHand);
        case 0x014C0A:
   case 0x014C2E:
      case 0x014C34:
-        _MESSAGE("EquipManager: Weapon %08X is a pipe smoking item - skipping sound", weaponFormID);
+        ALOG_INFO("EquipManager: Weapon %08X is a pipe smoking item - skipping sound", weaponFormID);
        return true;
      default:
       return false;
@@ -419,7 +409,7 @@ EquipManager::GetSingleton()->OnEquip(item, actor, isLeftHand);
   {
      modIsLoaded = true;
          modIndex = modInfo->GetPartialIndex();
-       _MESSAGE("EquipManager: Navigate VR mod detected (index: %02X) - map/compass items will be excluded from sounds", modIndex);
+       ALOG_INFO("EquipManager: Navigate VR mod detected (index: %02X) - map/compass items will be excluded from sounds", modIndex);
         }
             }
         }
@@ -446,7 +436,7 @@ if (!modIsLoaded)
   case 0x037482:
         case 0x06ed71:
             case 0x0bdcea:
-              _MESSAGE("EquipManager: Weapon %08X is a Navigate VR item - skipping sound", weaponFormID);
+              ALOG_INFO("EquipManager: Weapon %08X is a Navigate VR item - skipping sound", weaponFormID);
     return true;
        default:
         return false;
@@ -460,23 +450,15 @@ if (!modIsLoaded)
         return IsPipeSmokingWeapon(formID) || IsNavigateVRWeapon(formID);
     }
 
-    void EquipManager::OnEquip(TESForm* item, Actor* actor, bool isLeftHand)
+    void EquipManager::PlayEquipSound(TESForm* item, bool isLeftHand)
     {
-      if (!item)
-       return;
-
-  WeaponType type = GetWeaponType(item);
-        const char* typeName = GetWeaponTypeName(type);
-   const char* handName = isLeftHand ? "Left" : "Right";
+        if (!item)
+            return;
 
-    EquippedWeapon& hand = isLeftHand ? m_equipState.leftHand : m_equipState.rightHand;
-   hand.form = item;
-        hand.type = type;
- hand.isEquipped = true;
+        WeaponType type = GetWeaponType(item);
+        const char* handName = isLeftHand ? "Left" : "Right";
 
-  _MESSAGE("EquipManager: EQUIPPED %s in %s hand (FormID: %08X)", typeName, handName, item->formID);
-        
-// Cache sound FormIDs from Fake Edge VR.esp (ESL-flagged)
+        // Cache sound FormIDs from Fake Edge VR.esp (ESL-flagged)
       // Base FormIDs: Dagger=0x806, Sword=0x807, Axe=0x808, Mace=0x809
   static UInt32 cachedDaggerSound = 0;
         static UInt32 cachedSwordSound = 0;
@@ -508,7 +490,7 @@ cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
  if (elapsed < DRAW_SOUND_COOLDOWN_SECONDS)
   {
           onDrawCooldown = true;
-             _MESSAGE("EquipManager: Draw sound on cooldown for %08X (%lld/%d seconds since unequip)", 
+             ALOG_INFO("EquipManager: Draw sound on cooldown for %08X (%lld/%d seconds since unequip)", 
         item->formID, elapsed, DRAW_SOUND_COOLDOWN_SECONDS);
       }
      }
@@ -517,27 +499,27 @@ cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
  switch (type)
  {
  case WeaponType::Dagger:
-     _MESSAGE(">>> PLAYER EQUIPPED: DAGGER (FormID: %08X) in %s hand", item->formID, handName);
+     ALOG_INFO(">>> PLAYER EQUIPPED: DAGGER (FormID: %08X) in %s hand", item->formID, handName);
      if (!s_suppressDrawSound && !shouldExclude && !onDrawCooldown && cachedDaggerSound != 0)
   PlaySoundAtPlayer(cachedDaggerSound);
      break;
  case WeaponType::Sword:
- _MESSAGE(">>> PLAYER EQUIPPED: 1H SWORD (FormID: %08X) in %s hand", item->formID, handName);
+ ALOG_INFO(">>> PLAYER EQUIPPED: 1H SWORD (FormID: %08X) in %s hand", item->formID, handName);
      if (!s_suppressDrawSound && !shouldExclude && !onDrawCooldown && cachedSwordSound != 0)
          PlaySoundAtPlayer(cachedSwordSound);
      break;
  case WeaponType::Mace:
-     _MESSAGE(">>> PLAYER EQUIPPED: 1H MACE (FormID: %08X) in %s hand", item->formID, handName);
+     ALOG_INFO(">>> PLAYER EQUIPPED: 1H MACE (FormID: %08X) in %s hand", item->formID, handName);
      if (!s_suppressDrawSound && !shouldExclude && !onDrawCooldown && cachedMaceSound != 0)
          PlaySoundAtPlayer(cachedMaceSound);
      break;
  case WeaponType::Axe:
-     _MESSAGE(">>> PLAYER EQUIPPED: 1H AXE (FormID: %08X) in %s hand", item->formID, handName);
+     ALOG_INFO(">>> PLAYER EQUIPPED: 1H AXE (FormID: %08X) in %s hand", item->formID, handName);
      if (!s_suppressDrawSound && !shouldExclude && !onDrawCooldown && cachedAxeSound != 0)
          PlaySoundAtPlayer(cachedAxeSound);
      break;
  case WeaponType::Shield:
-     _MESSAGE(">>> PLAYER EQUIPPED: SHIELD (FormID: %08X) in %s hand", item->formID, handName);
+     ALOG_INFO(">>> PLAYER EQUIPPED: SHIELD (FormID: %08X) in %s hand", item->formID, handName);
      break;
  default:
      break;
@@ -545,8 +527,41 @@ cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
  
         if (s_suppressDrawSound)
         {
-        _MESSAGE("EquipManager: Skipping draw sound (internal collision re-equip)");
+        ALOG_INFO("EquipManager: Skipping draw sound (internal collision re-equip)");
+        }
+    }
+
+    void EquipManager::RecordUnequipTime(TESForm* item)
+    {
+        if (!item)
+            return;
+
+        // Record unequip time for draw sound cooldown
+        // Only track weapons (not shields)
+        WeaponType type = GetWeaponType(item);
+        if (type != WeaponType::Shield && type != WeaponType::None)
+        {
+    std::lock_guard<std::mutex> lock(s_drawMutex);
+      s_lastUnequipTimes[item->formID] = std::chrono::steady_clock::now();
+   ALOG_INFO("EquipManager: Recorded unequip time for weapon %08X (5s draw sound cooldown started)", item->formID);
         }
+    }
+
+    void EquipManager::OnEquip(TESForm* item, Actor* actor, bool isLeftHand)
+    {
+      if (!item)
+       return;
+
+  WeaponType type = GetWeaponType(item);
+        const char* typeName = GetWeaponTypeName(type);
+   const char* handName = isLeftHand ? "Left" : "Right";
+
+    EquippedWeapon& hand = isLeftHand ? m_equipState.leftHand : m_equipState.rightHand;
+   hand.form = item;
+        hand.type = type;
+ hand.isEquipped = true;
+
+  ALOG_INFO("EquipManager: EQUIPPED %s in %s hand (FormID: %08X)", typeName, handName, item->formID);
         
       LogEquipmentState();
    
@@ -566,16 +581,7 @@ cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
      EquippedWeapon& hand = isLeftHand ? m_equipState.leftHand : m_equipState.rightHand;
     hand.Clear();
 
-   _MESSAGE("EquipManager: UNEQUIPPED %s from %s hand (FormID: %08X)", typeName, handName, item->formID);
-        
-        // Record unequip time for draw sound cooldown
-        // Only track weapons (not shields)
-        if (type != WeaponType::Shield && type != WeaponType::None)
-        {
-    std::lock_guard<std::mutex> lock(s_drawMutex);
-      s_lastUnequipTimes[item->formID] = std::chrono::steady_clock::now();
-   _MESSAGE("EquipManager: Recorded unequip time for weapon %08X (5s draw sound cooldown started)", item->formID);
-        }
+   ALOG_INFO("EquipManager: UNEQUIPPED %s from %s hand (FormID: %08X)", typeName, handName, item->formID);
         
         if (m_equipState.HasOneWeaponEquipped())
         {
@@ -584,7 +590,7 @@ cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
         ? m_equipState.leftHand.type 
                 : m_equipState.rightHand.type;
             
-      _MESSAGE("EquipManager: Player now has SINGLE weapon equipped - %s in %s hand", 
+      ALOG_INFO("EquipManager: Player now has SINGLE weapon equipped - %s in %s hand", 
        GetWeaponTypeName(remainingType), remainingHand);
         }
    
@@ -596,16 +602,16 @@ cachedMaceSound = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x809);
 
     void EquipManager::LogEquipmentState()
     {
-        _MESSAGE("EquipManager: === Equipment State ===");
-        _MESSAGE("  Left Hand:  %s (%s)", 
+        ALOG_INFO("EquipManager: === Equipment State ===");
+        ALOG_INFO("  Left Hand:  %s (%s)", 
             m_equipState.leftHand.isEquipped ? GetWeaponTypeName(m_equipState.leftHand.type) : "Empty",
        m_equipState.leftHand.form ? std::to_string(m_equipState.leftHand.form->formID).c_str() : "None");
-        _MESSAGE("  Right Hand: %s (%s)", 
+        ALOG_INFO("  Right Hand: %s (%s)", 
       m_equipState.rightHand.isEquipped ? GetWeaponTypeName(m_equipState.rightHand.type) : "Empty",
             m_equipState.rightHand.form ? std::to_string(m_equipState.rightHand.form->formID).c_str() : "None");
-    _MESSAGE("  Weapon Count: %d", m_equipState.GetEquippedWeaponCount());
-        _MESSAGE("  Single Weapon: %s", m_equipState.HasOneWeaponEquipped() ? "YES" : "NO");
-        _MESSAGE("==============================");
+    ALOG_INFO("  Weapon Count: %d", m_equipState.GetEquippedWeaponCount());
+        ALOG_INFO("  Single Weapon: %s", m_equipState.HasOneWeaponEquipped() ? "YES" : "NO");
+        ALOG_INFO("==============================");
     }
 
     WeaponType EquipManager::GetWeaponType(TESForm* form)
@@ -740,14 +746,14 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
    PlayerCharacter* player = *g_thePlayer;
         if (!player)
       {
-      _MESSAGE("EquipManager::ForceUnequipHand - No player!");
+      ALOG_WARN("EquipManager::ForceUnequipHand - No player!");
      return;
         }
 
  EquippedWeapon& hand = isLeftHand ? m_equipState.leftHand : m_equipState.rightHand;
      if (!hand.isEquipped || !hand.form)
         {
- _MESSAGE("EquipManager::ForceUnequipHand - %s hand has no weapon to unequip", 
+ ALOG_INFO("EquipManager::ForceUnequipHand - %s hand has no weapon to unequip", 
    isLeftHand ? "Left" : "Right");
        return;
         }
@@ -764,7 +770,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
          m_pendingReequipRight = item;
         }
     
-        _MESSAGE("EquipManager: FORCE UNEQUIPPING %s from %s hand (FormID: %08X) - stored for re-equip", 
+        ALOG_INFO("EquipManager: FORCE UNEQUIPPING %s from %s hand (FormID: %08X) - stored for re-equip", 
       GetWeaponTypeName(hand.type), 
         isLeftHand ? "Left" : "Right", 
      item->formID);
@@ -773,7 +779,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
     ::EquipManager* equipManager = ::EquipManager::GetSingleton();
         if (!equipManager)
         {
-   _MESSAGE("EquipManager::ForceUnequipHand - Failed to get game EquipManager!");
+   ALOG_WARN("EquipManager::ForceUnequipHand - Failed to get game EquipManager!");
   return;
         }
 
@@ -783,7 +789,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
       
         if (!containerChanges || !containerChanges->data)
     {
-      _MESSAGE("EquipManager::ForceUnequipHand - No container changes data!");
+      ALOG_WARN("EquipManager::ForceUnequipHand - No container changes data!");
    return;
    }
 
@@ -791,7 +797,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
  InventoryEntryData* entryData = containerChanges->data->FindItemEntry(item);
      if (!entryData)
    {
-        _MESSAGE("EquipManager::ForceUnequipHand - Item not found in inventory!");
+        ALOG_WARN("EquipManager::ForceUnequipHand - Item not found in inventory!");
  return;
         }
 
@@ -806,7 +812,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
 
         if (!equipList)
         {
- _MESSAGE("EquipManager::ForceUnequipHand - No equip list found for %s hand!", 
+ ALOG_WARN("EquipManager::ForceUnequipHand - No equip list found for %s hand!", 
      isLeftHand ? "Left" : "Right");
             return;
         }
@@ -821,7 +827,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
         // Unequip the item (silent - no sound, no message)
   CALL_MEMBER_FN(equipManager, UnequipItem)(player, item, equipList, 1, equipSlot, false, true, true, false, NULL);
 
-    _MESSAGE("EquipManager: Force unaquip command sent for %s hand (silent)", isLeftHand ? "Left" : "Right");
+    ALOG_INFO("EquipManager: Force unaquip command sent for %s hand (silent)", isLeftHand ? "Left" : "Right");
     }
 
     void EquipManager::ForceUnequipLeftHand()
@@ -839,7 +845,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
         PlayerCharacter* player = *g_thePlayer;
         if (!player)
         {
-    _MESSAGE("EquipManager::ForceReequipHand - No player!");
+    ALOG_WARN("EquipManager::ForceReequipHand - No player!");
             return;
         }
 
@@ -848,7 +854,7 @@ TESObjectARMO* armor = DYNAMIC_CAST(form, TESForm, TESObjectARMO);
       
         if (cachedFormID == 0)
         {
-_MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!", 
+ALOG_WARN("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!", 
      isLeftHand ? "Left" : "Right");
             return;
         }
@@ -856,14 +862,14 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         TESForm* weaponForm = LookupFormByID(cachedFormID);
         if (!weaponForm)
         {
-            _MESSAGE("EquipManager::ForceReequipHand - Weapon form %08X not found!", cachedFormID);
+            ALOG_WARN("EquipManager::ForceReequipHand - Weapon form %08X not found!", cachedFormID);
  return;
         }
         
      ::EquipManager* equipMan = ::EquipManager::GetSingleton();
     if (!equipMan)
   {
-            _MESSAGE("EquipManager::ForceReequipHand - EquipManager not available!");
+            ALOG_WARN("EquipManager::ForceReequipHand - EquipManager not available!");
             return;
         }
     
@@ -873,7 +879,7 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         // Direct equip - same as auto-equip grabbed weapon
         CALL_MEMBER_FN(equipMan, EquipItem)(player, weaponForm, nullptr, 1, slot, false, true, false, nullptr);
      
-        _MESSAGE("EquipManager: FORCE RE-EQUIPPED to %s hand (FormID: %08X) - direct call", 
+        ALOG_INFO("EquipManager: FORCE RE-EQUIPPED to %s hand (FormID: %08X) - direct call", 
             isLeftHand ? "Left" : "Right", cachedFormID);
         
     // Clear the pending re-equip and cached FormID for this hand
@@ -915,23 +921,24 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         }
     }
 
-    void EquipManager::ForceUnequipAndGrab(bool isLeftGameHand)
+    void EquipManager::ForceUnequipAndGrab(bool isLeftGameHand, const FrameContext& frame)
     {
-    PlayerCharacter* player = *g_thePlayer;
+    PlayerCharacter* player = frame.player;
         if (!player)
         {
-            _MESSAGE("EquipManager::ForceUnequipAndGrab - No player!");
+            ALOG_WARN("EquipManager::ForceUnequipAndGrab - No player!");
             return;
         }
 
-    // ALWAYS use direct player check for what's equipped - our state might be stale
-        TESForm* leftEquipped = player->GetEquippedObject(true);
-   TESForm* rightEquipped = player->GetEquippedObject(false);
+    // ALWAYS use the direct player check for what's equipped (frame context) - our state might be stale.
+        // If the item was unequipped earlier this step, GetExtraWornBaseLists below finds no equip list and we abort.
+        TESForm* leftEquipped = frame.leftEquipped;
+   TESForm* rightEquipped = frame.rightEquipped;
      
       TESForm* item = isLeftGameHand ? leftEquipped : rightEquipped;
         if (!item)
     {
-  _MESSAGE("EquipManager::ForceUnequipAndGrab - %s GAME hand has no weapon (direct check)", 
+  ALOG_INFO("EquipManager::ForceUnequipAndGrab - %s GAME hand has no weapon (direct check)", 
         isLeftGameHand ? "Left" : "Right");
             return;
         }
@@ -939,7 +946,7 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         // Check if this is a weapon we should handle
    if (!IsWeapon(item))
   {
- _MESSAGE("EquipManager::ForceUnequipAndGrab - %s GAME hand item is not a weapon (FormID: %08X)", 
+ ALOG_INFO("EquipManager::ForceUnequipAndGrab - %s GAME hand item is not a weapon (FormID: %08X)", 
         isLeftGameHand ? "Left" : "Right", item->formID);
     return;
         }
@@ -950,8 +957,8 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         
         if (bothHandsSameWeapon)
         {
-   _MESSAGE("EquipManager::ForceUnequipAndGrab - SAME WEAPON in both hands (FormID: %08X)", item->formID);
-        _MESSAGE("EquipManager::ForceUnequipAndGrab - Using special handling for duplicate weapons");
+   ALOG_INFO("EquipManager::ForceUnequipAndGrab - SAME WEAPON in both hands (FormID: %08X)", item->formID);
+        ALOG_INFO("EquipManager::ForceUnequipAndGrab - Using special handling for duplicate weapons");
   }
         
         // Track if we were dual-wielding same weapon (for cleanup after re-equip)
@@ -968,12 +975,12 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         if (isLeftGameHand)
  {
         m_cachedWeaponFormIDLeft = item->formID;
-      _MESSAGE("EquipManager: Cached LEFT GAME hand weapon FormID: %08X for re-equip", m_cachedWeaponFormIDLeft);
+      ALOG_INFO("EquipManager: Cached LEFT GAME hand weapon FormID: %08X for re-equip", m_cachedWeaponFormIDLeft);
    }
  else
         {
    m_cachedWeaponFormIDRight = item->formID;
-            _MESSAGE("EquipManager: Cached RIGHT GAME hand weapon FormID: %08X for re-equip", m_cachedWeaponFormIDRight);
+            ALOG_INFO("EquipManager: Cached RIGHT GAME hand weapon FormID: %08X for re-equip", m_cachedWeaponFormIDRight);
   }
         
 // Store for potential re-equip later
@@ -986,7 +993,7 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
   m_pendingReequipRight = item;
   }
 
-        _MESSAGE("EquipManager: FORCE UNEQUIP AND GRAB - %s from %s GAME hand (FormID: %08X)", 
+        ALOG_INFO("EquipManager: FORCE UNEQUIP AND GRAB - %s from %s GAME hand (FormID: %08X)", 
             GetWeaponTypeName(GetWeaponType(item)), 
   isLeftGameHand ? "Left" : "Right", 
   item->formID);
@@ -995,7 +1002,7 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         ::EquipManager* equipManager = ::EquipManager::GetSingleton();
         if (!equipManager)
         {
-         _MESSAGE("EquipManager::ForceUnequipAndGrab - Failed to get game EquipManager!");
+         ALOG_WARN("EquipManager::ForceUnequipAndGrab - Failed to get game EquipManager!");
           return;
 }
 
@@ -1004,14 +1011,14 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
      
    if (!containerChanges || !containerChanges->data)
         {
- _MESSAGE("EquipManager::ForceUnequipAndGrab - No container changes data!");
+ ALOG_WARN("EquipManager::ForceUnequipAndGrab - No container changes data!");
           return;
 }
 
         InventoryEntryData* entryData = containerChanges->data->FindItemEntry(item);
         if (!entryData)
         {
-      _MESSAGE("EquipManager::ForceUnequipAndGrab - Item not found in inventory!");
+      ALOG_WARN("EquipManager::ForceUnequipAndGrab - Item not found in inventory!");
     return;
         }
 
@@ -1020,13 +1027,13 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
         entryData->GetExtraWornBaseLists(&rightEquipList, &leftEquipList);
 
         // Debug: Log what we got from GetExtraWornBaseLists
-        _MESSAGE("EquipManager::ForceUnequipAndGrab - GetExtraWornBaseLists results:");
-        _MESSAGE("  leftEquipList: %p, rightEquipList: %p", leftEquipList, rightEquipList);
-        _MESSAGE("  Requested hand: %s GAME hand", isLeftGameHand ? "Left" : "Right");
+        ALOG_INFO("EquipManager::ForceUnequipAndGrab - GetExtraWornBaseLists results:");
+        ALOG_INFO("  leftEquipList: %p, rightEquipList: %p", leftEquipList, rightEquipList);
+        ALOG_INFO("  Requested hand: %s GAME hand", isLeftGameHand ? "Left" : "Right");
         
         if (bothHandsSameWeapon)
    {
-     _MESSAGE("  NOTE: Both hands have SAME weapon - entryData count: %d", entryData->countDelta);
+     ALOG_INFO("  NOTE: Both hands have SAME weapon - entryData count: %d", entryData->countDelta);
       }
 
         // Note: These are GAME hand equip lists
@@ -1035,15 +1042,15 @@ _MESSAGE("EquipManager::ForceReequipHand - No cached weapon FormID for %s hand!"
 
         if (!equipList)
         {
-          _MESSAGE("EquipManager::ForceUnequipAndGrab - No equip list found for %s hand!", 
+          ALOG_WARN("EquipManager::ForceUnequipAndGrab - No equip list found for %s hand!", 
 isLeftGameHand ? "Left" : "Right");
-    _MESSAGE("EquipManager::ForceUnequipAndGrab - leftEquipList: %p, rightEquipList: %p", 
+    ALOG_INFO("EquipManager::ForceUnequipAndGrab - leftEquipList: %p, rightEquipList: %p", 
              leftEquipList, rightEquipList);
   
 // If we couldn't get the equip list for the requested hand, we cannot safely unequip
  // Using the other hand's equip list would unequip the WRONG weapon!
             // This can happen with same weapon in both hands - just abort
-    _MESSAGE("EquipManager::ForceUnequipAndGrab - Cannot get correct equip list, aborting to prevent wrong weapon unequip");
+    ALOG_WARN("EquipManager::ForceUnequipAndGrab - Cannot get correct equip list, aborting to prevent wrong weapon unequip");
        return;
         }
 
@@ -1056,14 +1063,10 @@ BSExtraData* xCannotWear = equipList->GetByType(kExtraData_CannotWear);
    // Unequip the item (silent - no sound, no message)
         CALL_MEMBER_FN(equipManager, UnequipItem)(player, item, equipList, 1, equipSlot, false, true, true, false, NULL);
 
-     _MESSAGE("EquipManager: Item unequipped (silent), now creating world object for HIGGS grab...");
+     ALOG_INFO("EquipManager: Item unequipped (silent), now creating world object for HIGGS grab...");
 
         // Step 2: Get the hand position to spawn the weapon there
-   NiNode* rootNode = player->GetNiRootNode(0);
-    if (!rootNode)
-        {
-  rootNode = player->GetNiRootNode(1);
-  }
+   NiNode* rootNode = frame.rootNode;
       
         NiPoint3 spawnPos = player->pos;
     
@@ -1071,19 +1074,18 @@ BSExtraData* xCannotWear = equipList->GetByType(kExtraData_CannotWear);
       {
             // Try to get the hand node position
   const char* handNodeName = isLeftGameHand ? "NPC L Hand [LHnd]" : "NPC R Hand [RHnd]";
-        BSFixedString handNodeStr(handNodeName);
-      NiAVObject* handNode = rootNode->GetObjectByName(&handNodeStr.data);
+      NiAVObject* handNode = NodeCache::GetSingleton()->Find(rootNode, handNodeName);
       
     if (handNode)
      {
    spawnPos = handNode->m_worldTransform.pos;
-          _MESSAGE("EquipManager: Spawning weapon at GAME %s hand position (%.2f, %.2f, %.2f)", 
+          ALOG_INFO("EquipManager: Spawning weapon at GAME %s hand position (%.2f, %.2f, %.2f)", 
     isLeftGameHand ? "Left" : "Right",
     spawnPos.x, spawnPos.y, spawnPos.z);
    }
 else
   {
-     _MESSAGE("EquipManager: Hand node not found, using player position");
+     ALOG_WARN("EquipManager: Hand node not found, using player position");
    }
  }
 
@@ -1092,7 +1094,7 @@ else
       
    if (droppedWeapon)
      {
-    _MESSAGE("EquipManager: Created world weapon reference (RefID: %08X)", droppedWeapon->formID);
+    ALOG_INFO("EquipManager: Created world weapon reference (RefID: %08X)", droppedWeapon->formID);
 
  // Step 3.25: Set ownership to player to prevent "stolen" flag when picking up
         SetOwnerToPlayer(droppedWeapon);
@@ -1103,11 +1105,11 @@ else
         if (!bothHandsSameWeapon)
         {
     RemoveItemFromInventory(player, item, 1, true);
-  _MESSAGE("EquipManager: Removed 1x item from inventory to prevent duplication");
+  ALOG_INFO("EquipManager: Removed 1x item from inventory to prevent duplication");
         }
      else
    {
-            _MESSAGE("EquipManager: SKIPPING inventory removal - same weapon in both hands, need it for other hand");
+            ALOG_INFO("EquipManager: SKIPPING inventory removal - same weapon in both hands, need it for other hand");
         }
 
  // Store the reference (by GAME hand)
@@ -1123,32 +1125,32 @@ else
             // Step 4: Use HIGGS to grab the object
             // IMPORTANT: HIGGS uses VR CONTROLLER, not game hand!
    // We need to convert game hand to VR controller
-    bool isLeftVRController = GameHandToVRController(isLeftGameHand);
+    bool isLeftVRController = frame.GameHandToController(isLeftGameHand);
         
      if (higgsInterface)
      {
  // Check if VR controller can grab
             if (higgsInterface->CanGrabObject(isLeftVRController))
     {
-        _MESSAGE("EquipManager: HIGGS grabbing weapon with %s VR controller (game %s hand)!", 
+        ALOG_INFO("EquipManager: HIGGS grabbing weapon with %s VR controller (game %s hand)!", 
       isLeftVRController ? "Left" : "Right",
    isLeftGameHand ? "Left" : "Right");
      higgsInterface->GrabObject(droppedWeapon, isLeftVRController);
    }
          else
        {
-     _MESSAGE("EquipManager: HIGGS cannot grab with %s VR controller right now", 
+     ALOG_INFO("EquipManager: HIGGS cannot grab with %s VR controller right now", 
        isLeftVRController ? "Left" : "Right");
     }
     }
   else
          {
-         _MESSAGE("EquipManager: HIGGS interface not available!");
+         ALOG_WARN("EquipManager: HIGGS interface not available!");
        }
      }
         else
   {
-          _MESSAGE("EquipManager: Failed to create world weapon reference!");
+          ALOG_WARN("EquipManager: Failed to create world weapon reference!");
  }
     }
 
@@ -1187,12 +1189,12 @@ else
         if (isLeftHand)
         {
     m_cachedWeaponFormIDLeft = 0;
-   _MESSAGE("EquipManager: Cleared cached weapon FormID for LEFT hand");
+   ALOG_INFO("EquipManager: Cleared cached weapon FormID for LEFT hand");
         }
   else
         {
         m_cachedWeaponFormIDRight = 0;
-   _MESSAGE("EquipManager: Cleared cached weapon FormID for RIGHT hand");
+   ALOG_INFO("EquipManager: Cleared cached weapon FormID for RIGHT hand");
      }
     }
 
@@ -1243,26 +1245,26 @@ else
         const char* typeName = EquipManager::GetWeaponTypeName(weaponType);
         
         // Log the weapon being added
- _MESSAGE("=== WEAPON ADDED TO PLAYER INVENTORY ===");
-        _MESSAGE("  Name: %s", weaponName ? weaponName : "Unknown");
-        _MESSAGE("  Type: %s", typeName);
-  _MESSAGE("  FormID: %08X", evn->itemFormId);
-        _MESSAGE("  Count: %d", evn->count);
-     _MESSAGE("  From: %08X", evn->fromFormId);
-    _MESSAGE("=========================================");
+ ALOG_INFO("=== WEAPON ADDED TO PLAYER INVENTORY ===");
+        ALOG_INFO("  Name: %s", weaponName ? weaponName : "Unknown");
+        ALOG_INFO("  Type: %s", typeName);
+  ALOG_INFO("  FormID: %08X", evn->itemFormId);
+        ALOG_INFO("  Count: %d", evn->count);
+     ALOG_INFO("  From: %08X", evn->fromFormId);
+    ALOG_INFO("=========================================");
         
      // Play the weapon pickup sound from Fake Edge VR.esp (ESL-flagged)
      // BUT skip if this is from our internal re-equip logic (SafeActivate)
     if (EquipManager::s_suppressPickupSound)
      {
-   _MESSAGE("EquipManager: Skipping pickup sound (internal re-equip)");
+   ALOG_INFO("EquipManager: Skipping pickup sound (internal re-equip)");
           return kEvent_Continue;
      }
         
      // Skip pickup sound for excluded items (pipe smoking, navigate VR, etc.)
    if (IsExcludedItem(evn->itemFormId))
         {
-         _MESSAGE("EquipManager: Skipping pickup sound (excluded item)");
+         ALOG_INFO("EquipManager: Skipping pickup sound (excluded item)");
    return kEvent_Continue;
  }
         
@@ -1273,11 +1275,11 @@ else
           cachedSoundFormId = GetFullFormIdFromEspAndFormId("Fake Edge VR.esp", 0x800);
  if (cachedSoundFormId != 0)
   {
-  _MESSAGE("EquipManager: Cached weapon pickup sound FormID: %08X", cachedSoundFormId);
+  ALOG_INFO("EquipManager: Cached weapon pickup sound FormID: %08X", cachedSoundFormId);
          }
      else
    {
-    _MESSAGE("EquipManager: WARNING - Could not find weapon pickup sound in Fake Edge VR.esp");
+    ALOG_WARN("EquipManager: WARNING - Could not find weapon pickup sound in Fake Edge VR.esp");
    }
 }
 
@@ -1292,22 +1294,22 @@ else
 
     void RegisterEquipEventHandler()
     {
-        _MESSAGE("EquipManager: Registering event handlers...");
+        LOG_INFO("EquipManager: Registering event handlers...");
         
         auto* eventDispatcher = GetEventDispatcherList();
         if (eventDispatcher)
         {
             // Register equip event handler
           eventDispatcher->unk4D0.AddEventSink(EquipEventHandler::GetSingleton());
-    _MESSAGE("EquipManager: Equip event handler registered successfully");
+    LOG_INFO("EquipManager: Equip event handler registered successfully");
             
   // Register container change event handler
    eventDispatcher->unk370.AddEventSink(ContainerChangeEventHandler::GetSingleton());
-            _MESSAGE("EquipManager: Container change event handler registered successfully");
+            LOG_INFO("EquipManager: Container change event handler registered successfully");
         }
       else
         {
- _MESSAGE("EquipManager: ERROR - Failed to get event dispatcher list!");
+ LOG_ERROR("EquipManager: ERROR - Failed to get event dispatcher list!");
         }
     }
 
@@ -1318,7 +1320,7 @@ else
         {
      eventDispatcher->unk4D0.RemoveEventSink(EquipEventHandler::GetSingleton());
             eventDispatcher->unk370.RemoveEventSink(ContainerChangeEventHandler::GetSingleton());
-      _MESSAGE("EquipManager: Event handlers unregistered");
+      LOG_INFO("EquipManager: Event handlers unregistered");
  }
     }
 }
@@ -5,6 +5,7 @@
 #include "skse64/GameEvents.h"
 #include "skse64/GameRTTI.h"
 #include "config.h"
+#include "FrameContext.h"
 
 namespace FalseEdgeVR
 {
@@ -99,8 +100,12 @@ namespace FalseEdgeVR
      // Update equipment state from current player equipped items
         void UpdateEquipmentState();
         
-        // Handle equip event
+        // Handle equip event (applied from the event queue on the physics step)
       void OnEquip(TESForm* item, Actor* actor, bool isLeftHand);
+        
+        // Event-sink side of a player equip/unequip: draw sound and its cooldown
+        static void PlayEquipSound(TESForm* item, bool isLeftHand);
+        static void RecordUnequipTime(TESForm* item);
    
    // Handle unequip event
         void OnUnequip(TESForm* item, Actor* actor, bool isLeftHand);
@@ -127,8 +132,8 @@ namespace FalseEdgeVR
         // Forced Equip/Unequip Functions
         // ============================================
   
-        // Unequip weapon and drop it for HIGGS to grab
-        void ForceUnequipAndGrab(bool isLeftHand);
+        // Unequip weapon and drop it for HIGGS to grab (called from the physics step trackers)
+        void ForceUnequipAndGrab(bool isLeftHand, const FrameContext& frame);
 
       // Unequip the weapon from the specified hand (stores for re-equip)
   void ForceUnequipHand(bool isLeftHand);
@@ -0,0 +1,74 @@
+#pragma once
+
+// ============================================
+// FixedTimestep - fixed-rate substeps from variable step intervals
+// ============================================
+// Time is fed in whatever the headset's refresh rate makes it. The accumulator hands out
+// whole steps of a fixed length and keeps the remainder for next time, so logic behind it
+// runs at the same rate, with the same step length, at 72, 90 or 144 Hz.
+//
+// At most maxSubsteps steps come out of one Advance(); a bigger backlog (hitch, pause) is
+// dropped rather than replayed. A step of 0 turns the accumulator into a pass-through:
+// every Advance() yields one step of the elapsed time.
+
+namespace FalseEdgeVR
+{
+    class FixedTimestep
+    {
+    public:
+        explicit FixedTimestep(float step = 0.0f, int maxSubsteps = 1)
+            : m_step(step), m_maxSubsteps(maxSubsteps > 0 ? maxSubsteps : 1)
+        {
+        }
+
+        // 0 = variable step (pass-through)
+        void SetStep(float step)
+        {
+            if (step != m_step)
+            {
+                m_step = step;
+                m_accumulator = 0.0f;
+            }
+        }
+
+        // Adds elapsed seconds; returns how many steps of Step() length to run now
+        int Advance(float elapsed)
+        {
+            if (m_step <= 0.0f)
+            {
+                m_lastElapsed = elapsed;
+                return 1;
+            }
+
+            m_accumulator += elapsed;
+            int steps = 0;
+            while (m_accumulator >= m_step && steps < m_maxSubsteps)
+            {
+                m_accumulator -= m_step;
+                steps++;
+            }
+
+            // Backlog beyond maxSubsteps is dropped, not carried
+            if (m_accumulator >= m_step)
+                m_accumulator = 0.0f;
+
+            return steps;
+        }
+
+        // Length of each step Advance() asked for
+        float Step() const { return m_step > 0.0f ? m_step : m_lastElapsed; }
+
+        bool IsFixed() const { return m_step > 0.0f; }
+
+        // Fraction of a step waiting in the accumulator (0..1), for interpolation
+        float Alpha() const { return m_step > 0.0f ? m_accumulator / m_step : 0.0f; }
+
+        void Reset() { m_accumulator = 0.0f; }
+
+    private:
+        float m_step;
+        int m_maxSubsteps;
+        float m_accumulator = 0.0f;
+        float m_lastElapsed = 0.0f;
+    };
+}
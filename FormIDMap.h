@@ -0,0 +1,117 @@
+#pragma once
+
+// ============================================
+// FlatFormIDMap - open-addressing map keyed by FormID
+// ============================================
+// Per-form caches that are read every physics step (blade profiles, shield shapes).
+// Slots live in one contiguous array with linear probing, so a lookup is a hash and
+// usually a single cache line. FormID 0 is never a real form and marks empty slots.
+// Entries are never erased individually - Clear() drops everything.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FalseEdgeVR
+{
+    template <typename T>
+    class FlatFormIDMap
+    {
+    public:
+        explicit FlatFormIDMap(size_t initialCapacity = 64)
+        {
+            size_t capacity = 16;
+            while (capacity < initialCapacity)
+                capacity <<= 1;
+            m_slots.resize(capacity);
+        }
+
+        // Returns nullptr if formID has no entry
+        T* Find(std::uint32_t formID)
+        {
+            if (formID == 0)
+                return nullptr;
+
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Hash(formID) & mask; ; i = (i + 1) & mask)
+            {
+                Slot& slot = m_slots[i];
+                if (slot.key == formID)
+                    return &slot.value;
+                if (slot.key == 0)
+                    return nullptr;
+            }
+        }
+
+        const T* Find(std::uint32_t formID) const
+        {
+            return const_cast<FlatFormIDMap*>(this)->Find(formID);
+        }
+
+        // Insert or overwrite; returns the stored value (formID must be non-zero)
+        T& Insert(std::uint32_t formID, const T& value)
+        {
+            // Keep load factor under 1/2 so probe runs stay short
+            if ((m_size + 1) * 2 > m_slots.size())
+                Grow();
+
+            Slot& slot = FindSlot(formID);
+            if (slot.key == 0)
+            {
+                slot.key = formID;
+                m_size++;
+            }
+            slot.value = value;
+            return slot.value;
+        }
+
+        void Clear()
+        {
+            for (Slot& slot : m_slots)
+                slot = Slot();
+            m_size = 0;
+        }
+
+        size_t Size() const { return m_size; }
+
+    private:
+        struct Slot
+        {
+            std::uint32_t key = 0;
+            T value = T();
+        };
+
+        // FormIDs share their high (plugin index) byte - mix so the low bits spread
+        static size_t Hash(std::uint32_t formID)
+        {
+            return (size_t)((formID * 2654435761u) ^ (formID >> 16));
+        }
+
+        // Slot holding formID, or the empty slot where it would go
+        Slot& FindSlot(std::uint32_t formID)
+        {
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Hash(formID) & mask; ; i = (i + 1) & mask)
+            {
+                Slot& slot = m_slots[i];
+                if (slot.key == formID || slot.key == 0)
+                    return slot;
+            }
+        }
+
+        void Grow()
+        {
+            std::vector<Slot> old;
+            old.swap(m_slots);
+            m_slots.resize(old.size() * 2);
+            for (Slot& slot : old)
+            {
+                if (slot.key != 0)
+                    FindSlot(slot.key) = slot;
+            }
+        }
+
+        std::vector<Slot> m_slots;     // Size is a power of two
+        size_t m_size = 0;
+    };
+}
@@ -0,0 +1,63 @@
+#include "FrameContext.h"
+#include "Engine.h"
+#include "EquipManager.h"
+#include "VRInputHandler.h"
+#include "ScopedTimer.h"
+
+namespace FalseEdgeVR
+{
+    static FrameContext s_frameContext;
+
+    static const FrameContext& BuildFrameContext(UInt32 frameNumber, float deltaTime)
+    {
+        FrameContext context;
+        context.frameNumber = frameNumber;
+        context.deltaTime = deltaTime;
+
+        context.leftHandedMode = IsLeftHandedMode();
+        context.leftTriggerPressed = VRInputHandler::IsLeftTriggerPressed();
+        context.rightTriggerPressed = VRInputHandler::IsRightTriggerPressed();
+
+        if (higgsInterface)
+        {
+            ScopedTimer higgsTimer(TimedSection::HiggsQueries);
+            context.leftControllerGrabbed = higgsInterface->GetGrabbedObject(true);
+            context.rightControllerGrabbed = higgsInterface->GetGrabbedObject(false);
+        }
+
+        PlayerCharacter* player = *g_thePlayer;
+        if (player && player->loadedState)
+        {
+            context.player = player;
+
+            context.rootNode = player->GetNiRootNode(0);    // First person root
+            if (!context.rootNode)
+                context.rootNode = player->GetNiRootNode(1);    // Third person root
+
+            context.leftEquipped = player->GetEquippedObject(true);
+            context.rightEquipped = player->GetEquippedObject(false);
+            context.leftIsShield = context.leftEquipped && EquipManager::IsShield(context.leftEquipped);
+            context.rightIsShield = context.rightEquipped && EquipManager::IsShield(context.rightEquipped);
+            context.leftIsWeapon = context.leftEquipped && EquipManager::IsWeapon(context.leftEquipped);
+            context.rightIsWeapon = context.rightEquipped && EquipManager::IsWeapon(context.rightEquipped);
+        }
+
+        s_frameContext = context;
+        return s_frameContext;
+    }
+
+    const FrameContext& BeginFrameContext(float deltaTime)
+    {
+        return BuildFrameContext(s_frameContext.frameNumber + 1, deltaTime);
+    }
+
+    const FrameContext& RefreshFrameContext(float deltaTime)
+    {
+        return BuildFrameContext(s_frameContext.frameNumber, deltaTime);
+    }
+
+    const FrameContext& GetFrameContext()
+    {
+        return s_frameContext;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// ============================================
+// FrameContext - per-step snapshot of engine state
+// ============================================
+// Everything the physics-step subsystems read from the engine (equipped forms, HIGGS grabs,
+// handedness, trigger state, the player's root node) is queried once at the top of
+// OnPrePhysicsStep and handed to every subsystem by const reference. Every subsystem sees
+// the same view of the step, and nothing asks the engine the same question twice.
+//
+// The snapshot is the state at the START of the step. Equips and unequips issued during
+// the step show up in the next step's context.
+
+#include "skse64/GameReferences.h"
+#include "skse64/GameForms.h"
+#include "skse64/NiNodes.h"
+
+namespace FalseEdgeVR
+{
+    struct FrameContext
+    {
+        UInt32 frameNumber = 0;
+        float deltaTime = 0.0f;                 // Clamped step interval (seconds)
+
+        PlayerCharacter* player = nullptr;      // Null if there is no player or its 3D isn't loaded
+        NiNode* rootNode = nullptr;             // First person root, third person if that is missing
+
+        // Equipped forms by GAME hand, and what they are
+        TESForm* leftEquipped = nullptr;
+        TESForm* rightEquipped = nullptr;
+        bool leftIsShield = false;
+        bool rightIsShield = false;
+        bool leftIsWeapon = false;
+        bool rightIsWeapon = false;
+
+        // HIGGS grabs by VR CONTROLLER (what GetGrabbedObject takes)
+        TESObjectREFR* leftControllerGrabbed = nullptr;
+        TESObjectREFR* rightControllerGrabbed = nullptr;
+
+        bool leftHandedMode = false;
+        bool leftTriggerPressed = false;        // By VR controller
+        bool rightTriggerPressed = false;
+
+        bool HasPlayer() const { return player != nullptr; }
+
+        TESForm* Equipped(bool isLeftGameHand) const { return isLeftGameHand ? leftEquipped : rightEquipped; }
+        bool IsShield(bool isLeftGameHand) const { return isLeftGameHand ? leftIsShield : rightIsShield; }
+        bool IsWeapon(bool isLeftGameHand) const { return isLeftGameHand ? leftIsWeapon : rightIsWeapon; }
+        bool HasShield() const { return leftIsShield || rightIsShield; }
+
+        // Off-hand is the LEFT game hand in right-handed mode, RIGHT in left-handed mode
+        bool OffHandIsLeft() const { return !leftHandedMode; }
+
+        // Same mapping as GameHandToVRController / VRControllerToGameHand, without re-reading the mode
+        bool GameHandToController(bool isLeftGameHand) const { return leftHandedMode ? !isLeftGameHand : isLeftGameHand; }
+        bool ControllerToGameHand(bool isLeftVRController) const { return leftHandedMode ? !isLeftVRController : isLeftVRController; }
+
+        TESObjectREFR* GrabbedByController(bool isLeftVRController) const
+        {
+            return isLeftVRController ? leftControllerGrabbed : rightControllerGrabbed;
+        }
+
+        TESObjectREFR* GrabbedByGameHand(bool isLeftGameHand) const
+        {
+            return GrabbedByController(GameHandToController(isLeftGameHand));
+        }
+
+        bool AnyTriggerPressed() const { return leftTriggerPressed || rightTriggerPressed; }
+    };
+
+    // Builds this step's context from the engine. Call once at the top of OnPrePhysicsStep,
+    // after the trigger state has been polled.
+    const FrameContext& BeginFrameContext(float deltaTime);
+
+    // Rebuilds the context later in the same step (after VRIK/HIGGS have placed the hands),
+    // keeping the step's frame number
+    const FrameContext& RefreshFrameContext(float deltaTime);
+
+    // The most recently built context (the current step's, while a step is running)
+    const FrameContext& GetFrameContext();
+}
@@ -0,0 +1,175 @@
+#include "FrameScheduler.h"
+#include "Engine.h"
+
+namespace FalseEdgeVR
+{
+    int FrameScheduler::AddTask(const char* name, FrameTaskFunc func, float rateHz, float budgetMs, int maxSubsteps)
+    {
+        Task task;
+        task.name = name;
+        task.func = func;
+        task.timestep = FixedTimestep(rateHz > 0.0f ? 1.0f / rateHz : 0.0f, maxSubsteps);
+        task.budgetMs = budgetMs;
+
+        m_tasks.push_back(task);
+        m_orderDirty = true;
+        return (int)m_tasks.size() - 1;
+    }
+
+    void FrameScheduler::AddDependency(int task, int dependency)
+    {
+        if (task < 0 || task >= (int)m_tasks.size() || dependency < 0 || dependency >= (int)m_tasks.size() || task == dependency)
+            return;
+
+        m_tasks[task].dependencies.push_back(dependency);
+        m_orderDirty = true;
+    }
+
+    void FrameScheduler::SetRate(int task, float rateHz)
+    {
+        if (task < 0 || task >= (int)m_tasks.size())
+            return;
+
+        m_tasks[task].timestep.SetStep(rateHz > 0.0f ? 1.0f / rateHz : 0.0f);
+    }
+
+    void FrameScheduler::SetTimedSection(int task, TimedSection section)
+    {
+        if (task < 0 || task >= (int)m_tasks.size())
+            return;
+
+        m_tasks[task].section = section;
+    }
+
+    void FrameScheduler::BuildOrder()
+    {
+        // Kahn's algorithm, always taking the lowest ready id so ties keep registration order
+        size_t count = m_tasks.size();
+        std::vector<int> pending(count, 0);
+        for (size_t i = 0; i < count; i++)
+            pending[i] = (int)m_tasks[i].dependencies.size();
+
+        std::vector<bool> placed(count, false);
+        m_order.clear();
+
+        while (m_order.size() < count)
+        {
+            int next = -1;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!placed[i] && pending[i] == 0)
+                {
+                    next = (int)i;
+                    break;
+                }
+            }
+
+            if (next < 0)
+            {
+                // Dependency cycle - run the rest in registration order rather than not at all
+                ALOG_ERROR("%s: Dependency cycle detected, remaining tasks run in registration order", m_name);
+                for (size_t i = 0; i < count; i++)
+                {
+                    if (!placed[i])
+                    {
+                        ALOG_ERROR("%s:   unordered: %s", m_name, m_tasks[i].name);
+                        placed[i] = true;
+                        m_order.push_back((int)i);
+                    }
+                }
+                break;
+            }
+
+            placed[next] = true;
+            m_order.push_back(next);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                for (int dependency : m_tasks[i].dependencies)
+                {
+                    if (dependency == next)
+                        pending[i]--;
+                }
+            }
+        }
+
+        m_orderDirty = false;
+
+        ALOG_INFO("%s: %d tasks in order:", m_name, (int)m_order.size());
+        for (int id : m_order)
+        {
+            const Task& task = m_tasks[id];
+            ALOG_INFO("%s:   %s (%s, budget %.2f ms)", m_name, task.name,
+                task.timestep.IsFixed() ? "fixed step" : "every step", task.budgetMs);
+        }
+    }
+
+    void FrameScheduler::Run(const FrameContext& frame)
+    {
+        if (m_orderDirty)
+            BuildOrder();
+
+        if (m_ticksPerMs <= 0.0)
+            m_ticksPerMs = GetTimerTicksPerMillisecond();
+        double msPerTick = (m_ticksPerMs > 0.0) ? 1.0 / m_ticksPerMs : 0.0;
+
+        for (int id : m_order)
+        {
+            Task& task = m_tasks[id];
+
+            // Full-rate tasks get one run of frame.deltaTime; fixed-step ones as many whole periods as are due
+            int runs = task.timestep.Advance(frame.deltaTime);
+            if (runs == 0)
+                continue;
+
+            // Measured in real time, whatever clock drives the step - one reading per run
+            // feeds both the task stats and its latency histogram
+            for (int i = 0; i < runs; i++)
+            {
+                uint64_t start = ReadTimerTicks();
+                task.func(frame, task.timestep.Step());
+                uint64_t ticks = ReadTimerTicks() - start;
+
+                if (task.section != TimedSection::Count)
+                    RecordHotPathTicks(task.section, ticks);
+
+                double ms = ticks * msPerTick;
+                task.runs++;
+                task.totalMs += ms;
+                if (ms > task.maxMs)
+                    task.maxMs = ms;
+                if (task.budgetMs > 0.0f && ms > task.budgetMs)
+                    task.overruns++;
+            }
+        }
+
+        m_windowSteps++;
+        m_sinceReport += frame.deltaTime;
+        if (m_reportInterval > 0.0f && m_sinceReport >= m_reportInterval)
+            LogStats();
+    }
+
+    void FrameScheduler::LogStats()
+    {
+        ALOG_INFO("%s: === Task timing over %.1f s (%u steps) ===", m_name, m_sinceReport, m_windowSteps);
+        for (int id : m_order)
+        {
+            Task& task = m_tasks[id];
+            double averageMs = task.runs > 0 ? task.totalMs / task.runs : 0.0;
+            ALOG_INFO("%s:   %-22s runs=%-6u avg=%.3f ms  max=%.3f ms  total=%.1f ms  budget=%.2f ms  overruns=%u",
+                m_name, task.name, task.runs, averageMs, task.maxMs, task.totalMs, task.budgetMs, task.overruns);
+
+            task.runs = 0;
+            task.overruns = 0;
+            task.totalMs = 0.0;
+            task.maxMs = 0.0;
+        }
+
+        if (m_reportCallback)
+            m_reportCallback();
+
+        m_ticksPerMs = GetTimerTicksPerMillisecond();
+        m_sinceReport = 0.0f;
+        m_windowSteps = 0;
+    }
+}
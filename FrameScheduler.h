@@ -0,0 +1,94 @@
+#pragma once
+
+// ============================================
+// FrameScheduler - per-step subsystem graph
+// ============================================
+// Each subsystem that runs from OnPrePhysicsStep is registered as a task with
+// - the tasks it must run after (its dependencies),
+// - a target rate (0 = every physics step; 10 = ten times a second),
+// - a time budget per run.
+// Tasks run in dependency order; ties keep registration order. A task below full rate
+// runs on a fixed timestep: every run is exactly one period long whatever the headset's
+// refresh rate, and leftover time carries into the next step.
+//
+// The scheduler measures every run with the timestamp counter. Budget overruns are counted,
+// and a per-task summary (runs, average, max, overruns) is logged every report interval.
+// A task given a TimedSection also feeds that measurement into the hot-path latency
+// histograms, so it needs no ScopedTimer of its own.
+// Physics-step thread only.
+
+#include "FrameContext.h"
+#include "FixedTimestep.h"
+#include "ScopedTimer.h"
+#include <vector>
+
+namespace FalseEdgeVR
+{
+    // elapsed = frame.deltaTime for full-rate tasks, the fixed period for rate-limited ones
+    typedef void (*FrameTaskFunc)(const FrameContext& frame, float elapsed);
+
+    // Called after each stats summary, for counters that share the report window
+    typedef void (*FrameReportFunc)();
+
+    class FrameScheduler
+    {
+    public:
+        // name prefixes the scheduler's log lines
+        explicit FrameScheduler(const char* name = "FrameScheduler") : m_name(name) {}
+
+        // Returns the task id. maxSubsteps caps catch-up runs of a rate-limited task in one step.
+        int AddTask(const char* name, FrameTaskFunc func, float rateHz, float budgetMs, int maxSubsteps = 1);
+
+        // task runs after dependency within a step (both must already be added)
+        void AddDependency(int task, int dependency);
+
+        // Change a task's rate (0 = every step) - e.g. after a config reload
+        void SetRate(int task, float rateHz);
+
+        // Also record the task's run times in a hot-path latency histogram
+        void SetTimedSection(int task, TimedSection section);
+
+        // Runs every task that is due this step, in dependency order
+        void Run(const FrameContext& frame);
+
+        // Seconds between stats summaries (0 = never)
+        void SetReportInterval(float seconds) { m_reportInterval = seconds; }
+        void SetReportCallback(FrameReportFunc func) { m_reportCallback = func; }
+
+        // Log the per-task summary now and start a new stats window
+        void LogStats();
+
+        size_t GetTaskCount() const { return m_tasks.size(); }
+
+    private:
+        struct Task
+        {
+            const char* name = nullptr;
+            FrameTaskFunc func = nullptr;
+            FixedTimestep timestep;         // Step 0 = every physics step
+            float budgetMs = 0.0f;
+            TimedSection section = TimedSection::Count;     // Count = no histogram
+            std::vector<int> dependencies;
+
+            // Stats for the current report window
+            UInt32 runs = 0;
+            UInt32 overruns = 0;
+            double totalMs = 0.0;
+            double maxMs = 0.0;
+        };
+
+        // Orders m_order so every task comes after its dependencies
+        void BuildOrder();
+
+        const char* m_name;
+        std::vector<Task> m_tasks;
+        std::vector<int> m_order;
+        bool m_orderDirty = true;
+
+        float m_reportInterval = 60.0f;
+        FrameReportFunc m_reportCallback = nullptr;
+        float m_sinceReport = 0.0f;
+        UInt32 m_windowSteps = 0;
+        double m_ticksPerMs = 0.0;      // Timestamp-counter rate, refreshed each report
+    };
+}
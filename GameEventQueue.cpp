@@ -0,0 +1,38 @@
+#include "GameEventQueue.h"
+#include "BoundedMPSCQueue.h"
+#include <atomic>
+
+namespace FalseEdgeVR
+{
+    // A few steps' worth of even the busiest event traffic (equip spam in a menu is ~2 per click)
+    static BoundedMPSCQueue<GameEvent, 256> s_gameEvents;
+    static std::atomic<UInt32> s_droppedGameEvents{ 0 };
+
+    bool PushGameEvent(GameEventType type, bool isLeft, UInt32 formID, TESObjectREFR* refr,
+        float mass, float separatingVelocity)
+    {
+        GameEvent event;
+        event.type = type;
+        event.isLeft = isLeft;
+        event.refHandle = refr ? refr->CreateRefHandle() : 0;
+        event.formID = formID;
+        event.mass = mass;
+        event.separatingVelocity = separatingVelocity;
+
+        if (s_gameEvents.TryPush(event))
+            return true;
+
+        s_droppedGameEvents.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool PopGameEvent(GameEvent& outEvent)
+    {
+        return s_gameEvents.TryPop(outEvent);
+    }
+
+    UInt32 TakeDroppedGameEventCount()
+    {
+        return s_droppedGameEvents.exchange(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+// ============================================
+// GameEventQueue - events from game/HIGGS threads to the physics step
+// ============================================
+// Event sinks and HIGGS callbacks only record what happened and return. The records go
+// into one lock-free queue and VRInputHandler applies them, in arrival order, at the top
+// of OnPrePhysicsStep - the only place tracking state changes, so it needs no locks.
+//
+// References are carried as ref handles, not pointers: a reference can unload between
+// the event and the next step, and the handle lookup then simply fails.
+
+#include "skse64/GameReferences.h"
+#include "skse64/GameForms.h"
+
+namespace FalseEdgeVR
+{
+    enum class GameEventType : UInt8
+    {
+        Grabbed,            // HIGGS: isLeft = VR controller, refHandle = grabbed reference
+        Dropped,            // HIGGS: isLeft = VR controller, refHandle = dropped reference
+        Pulled,             // HIGGS: isLeft = VR controller, refHandle = pulled reference
+        Collision,          // HIGGS: isLeft = VR controller, mass, separatingVelocity
+        StartTwoHanding,
+        StopTwoHanding,
+        WeaponSwing,        // isLeft = game hand, formID = weapon
+        PlayerDeath,
+        PlayerEquip,        // isLeft = game hand, formID = item
+        PlayerUnequip,      // formID = item (hand is resolved from the tracked equip state)
+        MenuClosed,         // A game-pausing menu closed - resync equipment
+        GameLoaded,         // A save finished loading - old references are invalid
+    };
+
+    // Small POD - copied into the queue as-is
+    struct GameEvent
+    {
+        GameEventType type;
+        bool isLeft;
+        UInt32 refHandle;
+        UInt32 formID;
+        float mass;
+        float separatingVelocity;
+    };
+
+    // Any thread. Returns false (and counts the drop) if the queue is full.
+    bool PushGameEvent(GameEventType type, bool isLeft = false, UInt32 formID = 0, TESObjectREFR* refr = nullptr,
+        float mass = 0.0f, float separatingVelocity = 0.0f);
+
+    // Physics-step thread only. False when the queue is empty.
+    bool PopGameEvent(GameEvent& outEvent);
+
+    // Events dropped because the queue was full since the last call (resets the count)
+    UInt32 TakeDroppedGameEventCount();
+}
@@ -0,0 +1,65 @@
+#include "GameTaskBatch.h"
+#include "BoundedMPSCQueue.h"
+#include "Engine.h"
+#include <atomic>
+
+namespace FalseEdgeVR
+{
+    // Far more than one frame ever produces; overflow is posted on its own
+    static const size_t kBatchCapacity = 64;
+    static BoundedMPSCQueue<TaskDelegate*, kBatchCapacity> s_pendingTasks;
+    static std::atomic<bool> s_batchPosted{ false };
+
+    // The one delegate g_task sees. Static - it is reused, never freed.
+    class GameTaskBatchDelegate : public TaskDelegate
+    {
+    public:
+        virtual void Run() override
+        {
+            // Cleared before taking the batch: a task submitted from here on either lands in
+            // this batch or posts the next one, never neither
+            s_batchPosted.store(false);
+
+            // Take the batch first so tasks queued by these tasks wait for the next one
+            TaskDelegate* batch[kBatchCapacity];
+            size_t count = 0;
+            while (count < kBatchCapacity && s_pendingTasks.TryPop(batch[count]))
+                count++;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                batch[i]->Run();
+                batch[i]->Dispose();
+            }
+        }
+
+        virtual void Dispose() override
+        {
+        }
+    };
+
+    static GameTaskBatchDelegate s_batchDelegate;
+
+    void SubmitGameTask(TaskDelegate* task)
+    {
+        if (!task)
+            return;
+
+        if (!g_task)
+        {
+            LOG_ERROR("GameTaskBatch: ERROR: g_task not available, dropping task");
+            task->Dispose();
+            return;
+        }
+
+        if (!s_pendingTasks.TryPush(task))
+        {
+            LOG_INFO("GameTaskBatch: Batch full, posting task on its own");
+            g_task->AddTask(task);
+            return;
+        }
+
+        if (!s_batchPosted.exchange(true))
+            g_task->AddTask(&s_batchDelegate);
+    }
+}
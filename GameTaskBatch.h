@@ -0,0 +1,21 @@
+#pragma once
+
+// ============================================
+// GameTaskBatch - one SKSE task per game frame for all queued game-thread work
+// ============================================
+// SubmitGameTask replaces g_task->AddTask for this plugin's tasks. Tasks go into a
+// lock-free queue; the first one submitted since the last batch ran posts a single
+// batch delegate to g_task, and every later one just joins it. When the batch runs on
+// the game thread it runs and disposes everything queued so far, in submission order.
+// A busy combat frame is then one trip through the game's task queue (and its lock)
+// however many spell casts and re-equips it produced.
+//
+// Callable from any thread. Tasks submitted while a batch is running go into the next one.
+
+#include "skse64/gamethreads.h"
+
+namespace FalseEdgeVR
+{
+    // Takes ownership of task (Dispose is called after it runs)
+    void SubmitGameTask(TaskDelegate* task);
+}
@@ -22,7 +22,7 @@ namespace FalseEdgeVR
 		{
 			leftHandedMode = value;
 
-			LOG("Left Handed Mode is %s.", leftHandedMode ? "ON" : "OFF");
+			LOG_WARN("Left Handed Mode is %s.", leftHandedMode ? "ON" : "OFF");
 		}
 	}
 
@@ -81,17 +81,17 @@ namespace FalseEdgeVR
 
 				if (castedForm) 
 				{
-					LOG_ERR("%s found. formid: %x", formName, fullFormId);
+					LOG_INFO("%s found. formid: %x", formName, fullFormId);
 					return castedForm;
 				}
 				else 
 				{
-					LOG_ERR("%s null. formid: %x", formName, fullFormId);
+					LOG_ERROR("%s null. formid: %x", formName, fullFormId);
 				}
 			}
 			else 
 			{
-				LOG_ERR("%s not found. formid: %x", formName, fullFormId);
+				LOG_ERROR("%s not found. formid: %x", formName, fullFormId);
 			}
 		}
 		return nullptr;
@@ -0,0 +1,126 @@
+#include "LogChannel.h"
+#include "StepClock.h"
+#include <atomic>
+
+namespace FalseEdgeVR
+{
+    struct LogChannelPolicy
+    {
+        const char* name;
+        float burst;        // Messages that can go out back to back
+        float perSecond;    // Refill rate; 0 = only after ResetLogChannels
+    };
+
+    // Refill rates. The old counters logged every 100/200/500 steps at roughly 90 steps a second.
+    static const float kOnce = 0.0f;
+    static const float kEverySecond = 1.0f;
+    static const float kEvery2Seconds = 0.5f;
+    static const float kEvery5Seconds = 0.2f;
+
+    // Indexed by LogChannel
+    static const LogChannelPolicy s_policies[] =
+    {
+        { "PrePhysicsStepStarted",   1.0f, kOnce },
+        { "PrePhysicsStepHeartbeat", 1.0f, kEvery5Seconds },
+        { "CombatNoTarget",          1.0f, kEvery2Seconds },
+        { "CollisionTimeout",        1.0f, kEverySecond },
+        { "ShieldCollisionTimeout",  1.0f, kEverySecond },
+        { "AutoEquipResetLeft",      1.0f, kEvery5Seconds },
+        { "AutoEquipResetRight",     1.0f, kEvery5Seconds },
+
+        { "GeometryFirstUpdate",     1.0f, kOnce },
+        { "GeometryHandedness",      1.0f, kEvery5Seconds },
+        { "GeometryPendingReequip",  1.0f, kOnce },
+        { "GeometryBothValid",       1.0f, kOnce },
+        { "GeometryHiggsTracking",   1.0f, kOnce },
+        { "GeometryHiggsDistance",   1.0f, kEverySecond },
+        { "GeometryGracePeriod",     1.0f, kEvery5Seconds },
+        { "GeometryCloseCombatSkip", 1.0f, kEvery5Seconds },
+        { "GeometryTriggerSkip",     1.0f, kEvery5Seconds },
+        { "GeometryCooldownSkip",    1.0f, kEvery5Seconds },
+        { "GeometryInvalid",         1.0f, kEvery5Seconds },
+        { "GeometryScaling",         1.0f, kEvery5Seconds },
+        { "GeometryImminent",        1.0f, kEverySecond },
+        { "HiggsGeometryInvalid",    1.0f, kEvery5Seconds },
+        { "HiggsGeometryUpdate",     1.0f, kEvery5Seconds },
+        { "WeaponNodeNoRoot",        1.0f, kEvery5Seconds },
+        { "WeaponNodeSearch",        1.0f, kOnce },
+        { "WeaponNodeNotFoundLeft",  1.0f, kOnce },
+        { "WeaponNodeNotFoundRight", 1.0f, kOnce },
+        { "HandNodeFailedLeft",      1.0f, kOnce },
+        { "HandNodeFailedRight",     1.0f, kOnce },
+        { "HandNoWeaponLeft",        1.0f, kOnce },
+        { "HandNoWeaponRight",       1.0f, kOnce },
+        { "HandGeometryFoundLeft",   1.0f, kOnce },
+        { "HandGeometryFoundRight",  1.0f, kOnce },
+
+        { "ShieldFirstUpdate",       1.0f, kOnce },
+        { "ShieldEquipState",        1.0f, kEvery5Seconds },
+        { "ShieldCloseCombatSkip",   1.0f, kEvery5Seconds },
+        { "ShieldCooldownSkip",      1.0f, kEvery5Seconds },
+        { "ShieldCollisionState",    1.0f, kEvery2Seconds },
+    };
+    static_assert(sizeof(s_policies) / sizeof(s_policies[0]) == (size_t)LogChannel::Count,
+        "LogChannel: every channel needs a policy");
+
+    struct LogChannelState
+    {
+        uint32_t generation = 0;    // Reset generation this bucket was last filled for
+        float tokens = 0.0f;
+        double lastRefill = 0.0;
+        uint32_t suppressed = 0;    // Not yet reported
+    };
+
+    // Starts ahead of every channel so each one fills its bucket on first use
+    static std::atomic<uint32_t> s_generation{ 1 };
+    static LogChannelState s_states[(size_t)LogChannel::Count];
+
+    bool LogChannelAllow(LogChannel channel)
+    {
+        size_t index = (size_t)channel;
+        if (index >= (size_t)LogChannel::Count)
+            return false;
+
+        const LogChannelPolicy& policy = s_policies[index];
+        LogChannelState& state = s_states[index];
+        double now = GetStepClock()->Now();
+
+        uint32_t generation = s_generation.load(std::memory_order_relaxed);
+        if (state.generation != generation)
+        {
+            if (state.suppressed > 0)
+                ALOG_DEBUG("LogChannel %s: %u messages suppressed before reset", policy.name, state.suppressed);
+
+            state.generation = generation;
+            state.tokens = policy.burst;
+            state.lastRefill = now;
+            state.suppressed = 0;
+        }
+        else if (policy.perSecond > 0.0f)
+        {
+            state.tokens += (float)(now - state.lastRefill) * policy.perSecond;
+            if (state.tokens > policy.burst)
+                state.tokens = policy.burst;
+            state.lastRefill = now;
+        }
+
+        if (state.tokens < 1.0f)
+        {
+            state.suppressed++;
+            return false;
+        }
+
+        state.tokens -= 1.0f;
+        if (state.suppressed > 0)
+        {
+            ALOG_DEBUG("LogChannel %s: %u similar messages suppressed", policy.name, state.suppressed);
+            state.suppressed = 0;
+        }
+        return true;
+    }
+
+    void ResetLogChannels()
+    {
+        s_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+// ============================================
+// LogChannel - rate-limited named log channels for per-step diagnostics
+// ============================================
+// Replaces function-static "logged once" flags and "every N frames" counters. Each
+// channel has a token bucket: a message takes a token, tokens refill at the channel's
+// rate up to its burst, and a message that finds the bucket empty is counted instead of
+// logged. The next message that gets through reports how many were suppressed in between
+// (at debug level, whatever the channel's own level).
+//
+//   ALOG_CHANNEL(DEBUG, LogChannel::GeometryCooldownSkip, "fmt", ...)
+//       One async line, subject to the level and the channel's bucket.
+//   if (LOG_CHANNEL_ENABLED(DEBUG, LogChannel::GeometryHiggsTracking)) { ALOG_DEBUG(...); ... }
+//       Several lines for one token.
+//
+// The bucket is only consulted once the level has passed, so a level that is compiled
+// out or off in the INI costs nothing and takes no tokens. Channels with no refill rate
+// log once until ResetLogChannels (ClearAllState on death or load) refills every bucket.
+//
+// A channel belongs to whichever thread logs to it - no locking. ResetLogChannels can be
+// called from any thread; each channel picks the reset up the next time it is used.
+
+#include "Logging.h"
+#include <cstdint>
+
+namespace FalseEdgeVR
+{
+    enum class LogChannel : uint8_t
+    {
+        // VRInputHandler
+        PrePhysicsStepStarted,
+        PrePhysicsStepHeartbeat,
+        CombatNoTarget,
+        CollisionTimeout,
+        ShieldCollisionTimeout,
+        AutoEquipResetLeft,
+        AutoEquipResetRight,
+
+        // WeaponGeometryTracker
+        GeometryFirstUpdate,
+        GeometryHandedness,
+        GeometryPendingReequip,
+        GeometryBothValid,
+        GeometryHiggsTracking,
+        GeometryHiggsDistance,
+        GeometryGracePeriod,
+        GeometryCloseCombatSkip,
+        GeometryTriggerSkip,
+        GeometryCooldownSkip,
+        GeometryInvalid,
+        GeometryScaling,
+        GeometryImminent,
+        HiggsGeometryInvalid,
+        HiggsGeometryUpdate,
+        WeaponNodeNoRoot,
+        WeaponNodeSearch,
+        WeaponNodeNotFoundLeft,
+        WeaponNodeNotFoundRight,
+        HandNodeFailedLeft,
+        HandNodeFailedRight,
+        HandNoWeaponLeft,
+        HandNoWeaponRight,
+        HandGeometryFoundLeft,
+        HandGeometryFoundRight,
+
+        // ShieldCollisionTracker
+        ShieldFirstUpdate,
+        ShieldEquipState,
+        ShieldCloseCombatSkip,
+        ShieldCooldownSkip,
+        ShieldCollisionState,
+
+        Count
+    };
+
+    // Takes a token from the channel's bucket. False if it is empty (the message is
+    // counted as suppressed and should not be logged).
+    bool LogChannelAllow(LogChannel channel);
+
+    // Refills every bucket. Any thread. Each channel logs the count it had suppressed
+    // since its last message the next time it is used.
+    void ResetLogChannels();
+}
+
+#define LOG_CHANNEL_ENABLED(level, channel) \
+    (FALSEEDGE_LOGLEVEL_##level <= FALSEEDGE_LOG_LEVEL && \
+     FALSEEDGE_LOGLEVEL_##level <= FalseEdgeVR::logging && \
+     FalseEdgeVR::LogChannelAllow(channel))
+
+#define ALOG_CHANNEL(level, channel, fmt, ...) \
+    do { if (LOG_CHANNEL_ENABLED(level, channel)) ASYNC_MESSAGE(fmt, ##__VA_ARGS__); } while (0)
@@ -0,0 +1,79 @@
+#pragma once
+
+// ============================================
+// Logging - leveled log macros with a compile-time ceiling
+// ============================================
+// Levels match the Logging= INI setting: 0 errors, 1 warnings, 2 info, 3 debug, 4 trace.
+//
+//   LOG_ERROR / LOG_WARN / LOG_INFO / LOG_DEBUG / LOG_TRACE (fmt, ...)
+//       Written synchronously with _MESSAGE (under LogFileLock) - setup, load and menu-time code.
+//   ALOG_ERROR / ALOG_WARN / ALOG_INFO / ALOG_DEBUG / ALOG_TRACE (fmt, ...)
+//       Queued for the AsyncLog writer thread - physics step, HIGGS callbacks and event
+//       sinks, where the caller must not format or touch the file.
+//
+// Levels above FALSEEDGE_LOG_LEVEL are removed by the preprocessor: the call, its
+// arguments and the level check all compile to nothing. Define FALSEEDGE_LOG_LEVEL in
+// the project to override; by default release builds keep up to info and debug builds
+// keep everything. Levels that are compiled in are still filtered by Logging= at runtime.
+
+#include "common/IDebugLog.h"
+#include "AsyncLog.h"
+
+#define FALSEEDGE_LOGLEVEL_ERROR 0
+#define FALSEEDGE_LOGLEVEL_WARN  1
+#define FALSEEDGE_LOGLEVEL_INFO  2
+#define FALSEEDGE_LOGLEVEL_DEBUG 3
+#define FALSEEDGE_LOGLEVEL_TRACE 4
+
+#ifndef FALSEEDGE_LOG_LEVEL
+    #ifdef NDEBUG
+        #define FALSEEDGE_LOG_LEVEL FALSEEDGE_LOGLEVEL_INFO
+    #else
+        #define FALSEEDGE_LOG_LEVEL FALSEEDGE_LOGLEVEL_TRACE
+    #endif
+#endif
+
+namespace FalseEdgeVR
+{
+    extern int logging;     // Runtime level from the INI (see config.cpp)
+}
+
+#define FALSEEDGE_LOG_SYNC(level, fmt, ...) \
+    do { if ((level) <= FalseEdgeVR::logging) { FalseEdgeVR::LogFileLock logFileLock; _MESSAGE(fmt, ##__VA_ARGS__); } } while (0)
+#define FALSEEDGE_LOG_ASYNC(level, fmt, ...) \
+    do { if ((level) <= FalseEdgeVR::logging) ASYNC_MESSAGE(fmt, ##__VA_ARGS__); } while (0)
+
+#define LOG_ERROR(fmt, ...) FALSEEDGE_LOG_SYNC(FALSEEDGE_LOGLEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define ALOG_ERROR(fmt, ...) FALSEEDGE_LOG_ASYNC(FALSEEDGE_LOGLEVEL_ERROR, fmt, ##__VA_ARGS__)
+
+#if FALSEEDGE_LOG_LEVEL >= FALSEEDGE_LOGLEVEL_WARN
+    #define LOG_WARN(fmt, ...) FALSEEDGE_LOG_SYNC(FALSEEDGE_LOGLEVEL_WARN, fmt, ##__VA_ARGS__)
+    #define ALOG_WARN(fmt, ...) FALSEEDGE_LOG_ASYNC(FALSEEDGE_LOGLEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+    #define LOG_WARN(fmt, ...) ((void)0)
+    #define ALOG_WARN(fmt, ...) ((void)0)
+#endif
+
+#if FALSEEDGE_LOG_LEVEL >= FALSEEDGE_LOGLEVEL_INFO
+    #define LOG_INFO(fmt, ...) FALSEEDGE_LOG_SYNC(FALSEEDGE_LOGLEVEL_INFO, fmt, ##__VA_ARGS__)
+    #define ALOG_INFO(fmt, ...) FALSEEDGE_LOG_ASYNC(FALSEEDGE_LOGLEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+    #define LOG_INFO(fmt, ...) ((void)0)
+    #define ALOG_INFO(fmt, ...) ((void)0)
+#endif
+
+#if FALSEEDGE_LOG_LEVEL >= FALSEEDGE_LOGLEVEL_DEBUG
+    #define LOG_DEBUG(fmt, ...) FALSEEDGE_LOG_SYNC(FALSEEDGE_LOGLEVEL_DEBUG, fmt, ##__VA_ARGS__)
+    #define ALOG_DEBUG(fmt, ...) FALSEEDGE_LOG_ASYNC(FALSEEDGE_LOGLEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+    #define LOG_DEBUG(fmt, ...) ((void)0)
+    #define ALOG_DEBUG(fmt, ...) ((void)0)
+#endif
+
+#if FALSEEDGE_LOG_LEVEL >= FALSEEDGE_LOGLEVEL_TRACE
+    #define LOG_TRACE(fmt, ...) FALSEEDGE_LOG_SYNC(FALSEEDGE_LOGLEVEL_TRACE, fmt, ##__VA_ARGS__)
+    #define ALOG_TRACE(fmt, ...) FALSEEDGE_LOG_ASYNC(FALSEEDGE_LOGLEVEL_TRACE, fmt, ##__VA_ARGS__)
+#else
+    #define LOG_TRACE(fmt, ...) ((void)0)
+    #define ALOG_TRACE(fmt, ...) ((void)0)
+#endif
@@ -0,0 +1,96 @@
+#include "NodeCache.h"
+#include "Engine.h"
+#include <cstring>
+
+namespace FalseEdgeVR
+{
+    NodeCache* NodeCache::GetSingleton()
+    {
+        static NodeCache instance;
+        return &instance;
+    }
+
+    NodeCache::Entry* NodeCache::FindEntry(NiNode* rootNode, const char* name)
+    {
+        for (int i = 0; i < m_count; i++)
+        {
+            Entry& entry = m_entries[i];
+            if (entry.root == rootNode && entry.name == name)
+                return &entry;
+        }
+
+        // Same name from a different literal
+        for (int i = 0; i < m_count; i++)
+        {
+            Entry& entry = m_entries[i];
+            if (entry.root == rootNode && strcmp(entry.name, name) == 0)
+                return &entry;
+        }
+        return nullptr;
+    }
+
+    NiAVObject* NodeCache::Find(NiNode* rootNode, const char* name)
+    {
+        if (!rootNode || !name)
+            return nullptr;
+
+        Entry* entry = FindEntry(rootNode, name);
+
+        // A node detached from the tree (weapon 3D swapped out under us) is looked up again
+        if (entry && entry->node && entry->node->m_parent)
+        {
+            m_hits++;
+            return entry->node;
+        }
+
+        BSFixedString nodeNameStr(name);
+        NiAVObject* node = rootNode->GetObjectByName(&nodeNameStr.data);
+        m_lookups++;
+
+        if (!node)
+            return nullptr;
+
+        if (!entry)
+        {
+            if (m_count >= MAX_ENTRIES)
+                return node;    // Full - still correct, just not cached
+
+            entry = &m_entries[m_count++];
+            entry->root = rootNode;
+            entry->name = name;
+        }
+        entry->node = node;
+        return node;
+    }
+
+    void NodeCache::Validate(const FrameContext& frame)
+    {
+        if (frame.rootNode == m_rootNode &&
+            frame.leftEquipped == m_leftEquipped &&
+            frame.rightEquipped == m_rightEquipped)
+            return;
+
+        if (m_count > 0)
+        {
+            ALOG_INFO("NodeCache: Invalidated (%s changed) - %d entries dropped",
+                frame.rootNode != m_rootNode ? "root node" : "equipment", m_count);
+        }
+
+        Invalidate();
+        m_rootNode = frame.rootNode;
+        m_leftEquipped = frame.leftEquipped;
+        m_rightEquipped = frame.rightEquipped;
+    }
+
+    void NodeCache::Invalidate()
+    {
+        for (int i = 0; i < m_count; i++)
+            m_entries[i] = Entry();
+        m_count = 0;
+
+        // Forces the next Validate to re-record what the entries belong to
+        m_rootNode = nullptr;
+        m_leftEquipped = nullptr;
+        m_rightEquipped = nullptr;
+    }
+}
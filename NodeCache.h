@@ -0,0 +1,68 @@
+#pragma once
+
+// ============================================
+// NodeCache - named node lookups under the player's root
+// ============================================
+// GetObjectByName interns a BSFixedString and walks the whole skeleton. The nodes the
+// trackers look up every step (weapon/shield offset nodes, hand nodes) only move when the
+// player's 3D is rebuilt or the equipment changes, so each (root, name) pair is resolved
+// once and reused until one of those happens.
+//
+// Names are compared by pointer first - callers pass string literals - and by strcmp if the
+// pointer differs. Misses are not cached, so a node shows up as soon as its 3D is attached.
+// Physics-step thread only.
+
+#include "skse64/NiNodes.h"
+#include "skse64/NiObjects.h"
+#include "skse64/GameForms.h"
+#include "FrameContext.h"
+
+namespace FalseEdgeVR
+{
+    class NodeCache
+    {
+    public:
+        static NodeCache* GetSingleton();
+
+        // Cached rootNode->GetObjectByName(name); nullptr if the node doesn't exist (yet)
+        NiAVObject* Find(NiNode* rootNode, const char* name);
+
+        // Drops every entry if the root node or an equipped form changed since the last step.
+        // Call right after BeginFrameContext / RefreshFrameContext.
+        void Validate(const FrameContext& frame);
+
+        // Drops every entry (3D reload, death, load)
+        void Invalidate();
+
+        UInt32 GetLookupCount() const { return m_lookups; }     // Tree walks since startup
+        UInt32 GetHitCount() const { return m_hits; }
+
+    private:
+        NodeCache() = default;
+        NodeCache(const NodeCache&) = delete;
+        NodeCache& operator=(const NodeCache&) = delete;
+
+        struct Entry
+        {
+            NiNode* root = nullptr;
+            const char* name = nullptr;
+            NiPointer<NiAVObject> node;
+        };
+
+        // Two hands x (weapon offset, shield offset, hand) plus a few one-off names
+        static const int MAX_ENTRIES = 16;
+
+        Entry* FindEntry(NiNode* rootNode, const char* name);
+
+        Entry m_entries[MAX_ENTRIES];
+        int m_count = 0;
+
+        // What the entries were resolved against
+        NiNode* m_rootNode = nullptr;
+        TESForm* m_leftEquipped = nullptr;
+        TESForm* m_rightEquipped = nullptr;
+
+        UInt32 m_lookups = 0;
+        UInt32 m_hits = 0;
+    };
+}
@@ -0,0 +1,202 @@
+#include "ScopedTimer.h"
+#include "Logging.h"
+#include <chrono>
+
+namespace FalseEdgeVR
+{
+    // ============================================
+    // LatencyHistogram
+    // ============================================
+
+    static int HighestBit(uint64_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return (int)index;
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    int LatencyHistogram::BucketIndex(uint64_t value)
+    {
+        // Below kSubBuckets every value has its own bucket
+        if (value < (uint64_t)kSubBuckets)
+            return (int)value;
+
+        int exponent = HighestBit(value);
+        if (exponent > kMaxExponent)
+            return kBucketCount - 1;
+
+        int sub = (int)(value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+        return kSubBuckets + (exponent - kSubBucketBits) * kSubBuckets + sub;
+    }
+
+    uint64_t LatencyHistogram::BucketUpperBound(int index)
+    {
+        if (index < kSubBuckets)
+            return (uint64_t)index;
+
+        int exponent = (index - kSubBuckets) / kSubBuckets + kSubBucketBits;
+        int sub = (index - kSubBuckets) % kSubBuckets;
+        uint64_t width = 1ull << (exponent - kSubBucketBits);
+        return (1ull << exponent) + sub * width + width - 1;
+    }
+
+    void LatencyHistogram::Record(uint64_t value)
+    {
+        std::atomic<uint32_t>& bucket = m_buckets[BucketIndex(value)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        m_count.store(m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        m_total.store(m_total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        if (value > m_max.load(std::memory_order_relaxed))
+            m_max.store(value, std::memory_order_relaxed);
+    }
+
+    void LatencyHistogram::Reset()
+    {
+        for (std::atomic<uint32_t>& bucket : m_buckets)
+            bucket.store(0, std::memory_order_relaxed);
+        m_count.store(0, std::memory_order_relaxed);
+        m_total.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::Percentile(double fraction, uint64_t count) const
+    {
+        // Smallest bucket with at least fraction of the samples at or below it
+        uint64_t target = (uint64_t)(fraction * (double)count + 0.5);
+        if (target < 1)
+            target = 1;
+
+        uint64_t seen = 0;
+        for (int i = 0; i < kBucketCount; i++)
+        {
+            seen += m_buckets[i].load(std::memory_order_relaxed);
+            if (seen >= target)
+                return BucketUpperBound(i);
+        }
+        return BucketUpperBound(kBucketCount - 1);
+    }
+
+    LatencyHistogram::Summary LatencyHistogram::Summarize() const
+    {
+        Summary summary;
+        summary.count = m_count.load(std::memory_order_relaxed);
+        if (summary.count == 0)
+            return summary;
+
+        summary.mean = (double)m_total.load(std::memory_order_relaxed) / (double)summary.count;
+        summary.max = m_max.load(std::memory_order_relaxed);
+
+        // A bucket's upper bound can overshoot the largest value actually seen
+        summary.p50 = Percentile(0.50, summary.count);
+        summary.p95 = Percentile(0.95, summary.count);
+        summary.p99 = Percentile(0.99, summary.count);
+        if (summary.p50 > summary.max) summary.p50 = summary.max;
+        if (summary.p95 > summary.max) summary.p95 = summary.max;
+        if (summary.p99 > summary.max) summary.p99 = summary.max;
+        return summary;
+    }
+
+    // ============================================
+    // Sections
+    // ============================================
+
+    static const char* s_sectionNames[] =
+    {
+        "PrePhysicsStep",
+        "PostVrikPostHiggs",
+        "HiggsQueries",
+        "WeaponGeometry",
+        "ShieldCollision",
+        "CombatTracking",
+    };
+    static_assert(sizeof(s_sectionNames) / sizeof(s_sectionNames[0]) == (size_t)TimedSection::Count,
+        "ScopedTimer: every section needs a name");
+
+    struct SectionTimes
+    {
+        LatencyHistogram histogram;
+        std::atomic<uint32_t> generation{ 0 };  // Report window this histogram belongs to
+    };
+
+    static SectionTimes s_sections[(size_t)TimedSection::Count];
+
+    // Bumped by each report; the writer clears a section's histogram when it sees a new one
+    static std::atomic<uint32_t> s_generation{ 0 };
+
+    // Tick rate reference
+    static uint64_t s_referenceTicks = 0;
+    static std::chrono::steady_clock::time_point s_referenceTime;
+    static std::chrono::steady_clock::time_point s_windowStart;
+
+    void StartHotPathTimers()
+    {
+        s_referenceTime = std::chrono::steady_clock::now();
+        s_referenceTicks = ReadTimerTicks();
+        s_windowStart = s_referenceTime;
+    }
+
+    void RecordHotPathTicks(TimedSection section, uint64_t ticks)
+    {
+        size_t index = (size_t)section;
+        if (index >= (size_t)TimedSection::Count)
+            return;
+
+        SectionTimes& times = s_sections[index];
+        uint32_t generation = s_generation.load(std::memory_order_relaxed);
+        if (times.generation.load(std::memory_order_relaxed) != generation)
+        {
+            times.histogram.Reset();
+            times.generation.store(generation, std::memory_order_relaxed);
+        }
+        times.histogram.Record(ticks);
+    }
+
+    double GetTimerTicksPerMillisecond()
+    {
+        double sinceReference = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_referenceTime).count();
+        uint64_t ticks = ReadTimerTicks() - s_referenceTicks;
+        if (sinceReference <= 0.0 || ticks == 0)
+            return 0.0;
+        return (double)ticks / sinceReference;
+    }
+
+    void LogHotPathTimers()
+    {
+        auto now = std::chrono::steady_clock::now();
+        double sinceReference = std::chrono::duration<double>(now - s_referenceTime).count();
+        uint64_t ticks = ReadTimerTicks() - s_referenceTicks;
+        if (sinceReference <= 0.0 || ticks == 0)
+            return;
+
+        // Invariant TSC - the average rate since load is as good as any
+        double ticksPerMicrosecond = (double)ticks / (sinceReference * 1000000.0);
+        double window = std::chrono::duration<double>(now - s_windowStart).count();
+
+        ALOG_INFO("HotPathTimers: === Latency over %.1f s (timestamp counter %.0f MHz) ===", window, ticksPerMicrosecond);
+        for (size_t i = 0; i < (size_t)TimedSection::Count; i++)
+        {
+            const SectionTimes& times = s_sections[i];
+            if (times.generation.load(std::memory_order_relaxed) != s_generation.load(std::memory_order_relaxed))
+                continue;   // Nothing recorded this window
+
+            LatencyHistogram::Summary summary = times.histogram.Summarize();
+            if (summary.count == 0)
+                continue;
+
+            ALOG_INFO("HotPathTimers:   %-18s n=%-7llu mean=%.1f us  p50=%.1f us  p95=%.1f us  p99=%.1f us  max=%.1f us",
+                s_sectionNames[i], (unsigned long long)summary.count,
+                summary.mean / ticksPerMicrosecond,
+                summary.p50 / ticksPerMicrosecond,
+                summary.p95 / ticksPerMicrosecond,
+                summary.p99 / ticksPerMicrosecond,
+                summary.max / ticksPerMicrosecond);
+        }
+
+        s_generation.fetch_add(1, std::memory_order_relaxed);
+        s_windowStart = now;
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+// ============================================
+// ScopedTimer - per-subsystem latency histograms for the physics step
+// ============================================
+// A ScopedTimer reads the CPU timestamp counter when it is constructed and again when it
+// goes out of scope, and adds the difference to its section's histogram. That costs two
+// rdtsc reads and a bucket increment - cheap enough to leave on permanently.
+//
+// Histograms are log-linear: sixteen linear sub-buckets per power of two, so every bucket
+// is within about 6% of the values in it whatever the scale. Counts are in raw ticks; the
+// tick rate is measured against the steady clock when a report is written.
+//
+// LogHotPathTimers writes count, mean, p50, p95, p99 and max per section and starts a
+// new window. Each section is recorded from one thread at a time (the step thread, or
+// the post-VRIK/post-HIGGS callback for the pose tasks); reports can come from any thread.
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#else
+    #include <x86intrin.h>
+#endif
+
+namespace FalseEdgeVR
+{
+    enum class TimedSection : uint8_t
+    {
+        PrePhysicsStep,         // All of OnPrePhysicsStep
+        PostVrikPostHiggs,      // Pose tasks run from the post-VRIK/post-HIGGS callback (GeometryPhase=1)
+        HiggsQueries,           // Grabbed-object queries in BeginFrameContext
+        WeaponGeometry,         // WeaponGeometry task (recorded by its FrameScheduler)
+        ShieldCollision,        // ShieldCollision task (recorded by its FrameScheduler)
+        CombatTracking,         // CombatTracking task (recorded by its FrameScheduler)
+
+        Count
+    };
+
+    class LatencyHistogram
+    {
+    public:
+        static const int kSubBucketBits = 4;
+        static const int kSubBuckets = 1 << kSubBucketBits;
+        static const int kMaxExponent = 40;     // Larger values share the last bucket (minutes at GHz rates)
+        static const int kBucketCount = kSubBuckets + (kMaxExponent - kSubBucketBits + 1) * kSubBuckets;
+
+        struct Summary
+        {
+            uint64_t count = 0;
+            double mean = 0.0;
+            uint64_t p50 = 0;
+            uint64_t p95 = 0;
+            uint64_t p99 = 0;
+            uint64_t max = 0;
+        };
+
+        // Writer thread only
+        void Record(uint64_t value);
+        void Reset();
+
+        // Any thread; approximate while the writer is recording
+        Summary Summarize() const;
+
+    private:
+        static int BucketIndex(uint64_t value);
+        static uint64_t BucketUpperBound(int index);
+        uint64_t Percentile(double fraction, uint64_t count) const;
+
+        // Single writer - plain load/store increments, atomic only so readers see whole values
+        std::atomic<uint32_t> m_buckets[kBucketCount] = {};
+        std::atomic<uint64_t> m_count{ 0 };
+        std::atomic<uint64_t> m_total{ 0 };
+        std::atomic<uint64_t> m_max{ 0 };
+    };
+
+    inline uint64_t ReadTimerTicks()
+    {
+        return __rdtsc();
+    }
+
+    // Reference point for the tick rate - call once at plugin load
+    void StartHotPathTimers();
+
+    // Adds one measurement (in ticks) to a section
+    void RecordHotPathTicks(TimedSection section, uint64_t ticks);
+
+    // Timestamp-counter rate, averaged since StartHotPathTimers (0 until time has passed)
+    double GetTimerTicksPerMillisecond();
+
+    // Logs every section's percentiles since the last report, then starts a new window
+    void LogHotPathTimers();
+
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(TimedSection section) : m_section(section), m_start(ReadTimerTicks()) {}
+        ~ScopedTimer() { RecordHotPathTicks(m_section, ReadTimerTicks() - m_start); }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        TimedSection m_section;
+        uint64_t m_start;
+    };
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// ============================================
+// SeqLockSnapshot - single-writer snapshot readable from any thread
+// ============================================
+// The writer (the physics step) publishes a finished value once per step; readers on
+// any thread copy out the latest one without taking a lock.
+//
+// Two slots, each with its own sequence counter (odd while being written). Publish
+// always writes the slot readers are NOT pointed at, then flips the pointer, so a
+// reader only has to retry if the writer laps it twice during one copy - in practice
+// never. A copy whose sequence changed underneath it is discarded and retried, so
+// readers never see a half-written value.
+//
+// T must be trivially copyable (plain data - it is copied with memcpy).
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace FalseEdgeVR
+{
+    template <typename T>
+    class SeqLockSnapshot
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLockSnapshot copies T with memcpy");
+
+    public:
+        // Writer thread only
+        void Publish(const T& value)
+        {
+            uint32_t count = m_published.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[count & 1];
+
+            uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+            slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::memcpy(&slot.data, &value, sizeof(T));
+
+            slot.sequence.store(sequence + 2, std::memory_order_release);
+            m_published.store(count + 1, std::memory_order_release);
+        }
+
+        // Any thread. False until the first Publish.
+        bool Read(T& out) const
+        {
+            for (;;)
+            {
+                uint32_t count = m_published.load(std::memory_order_acquire);
+                if (count == 0)
+                    return false;
+
+                const Slot& slot = m_slots[(count - 1) & 1];
+                uint32_t before = slot.sequence.load(std::memory_order_acquire);
+                if (before & 1)
+                    continue;
+
+                std::memcpy(&out, &slot.data, sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (slot.sequence.load(std::memory_order_relaxed) == before)
+                    return true;
+            }
+        }
+
+        // Number of values published so far
+        uint32_t GetPublishCount() const { return m_published.load(std::memory_order_acquire); }
+
+    private:
+        struct Slot
+        {
+            std::atomic<uint32_t> sequence{ 0 };
+            T data;
+        };
+
+        Slot m_slots[2];
+        std::atomic<uint32_t> m_published{ 0 };
+    };
+}
@@ -1,6 +1,8 @@
 #include "ShieldCollision.h"
 #include "Engine.h"
 #include "VRInputHandler.h"
+#include "NodeCache.h"
+#include "LogChannel.h"
 #include "skse64/GameRTTI.h"
 #include "skse64/NiNodes.h"
 #include <cmath>
@@ -8,6 +10,13 @@
 
 namespace FalseEdgeVR
 {
+    // Shield face sanity limits (unscaled semi-axis) - outside these the bounds are not a shield face
+    static const float MIN_SHAPE_FACE_RADIUS = 4.0f;
+    static const float MAX_SHAPE_FACE_RADIUS = 120.0f;
+    
+    // Steps to keep retrying the mesh bounds before settling for the ShieldRadius circle
+    static const UInt8 MAX_SHAPE_MESH_ATTEMPTS = 30;
+
   // ============================================
   // ShieldCollisionTracker Implementation
     // ============================================
@@ -23,7 +32,7 @@ return &instance;
         if (m_initialized)
    return;
 
-        _MESSAGE("ShieldCollisionTracker: Initializing...");
+        ALOG_INFO("ShieldCollisionTracker: Initializing...");
         
         m_leftHandShield.Clear();
  m_rightHandShield.Clear();
@@ -36,44 +45,40 @@ return &instance;
         m_collisionThreshold = shieldCollisionThreshold;
         m_imminentThreshold = shieldImminentThreshold;
 
- _MESSAGE("ShieldCollisionTracker: Collision threshold: %.2f, Imminent threshold: %.2f",
+ ALOG_INFO("ShieldCollisionTracker: Collision threshold: %.2f, Imminent threshold: %.2f",
    m_collisionThreshold, m_imminentThreshold);
         
    m_initialized = true;
-  _MESSAGE("ShieldCollisionTracker: Initialized successfully");
+  ALOG_INFO("ShieldCollisionTracker: Initialized successfully");
     }
 
-    void ShieldCollisionTracker::Update(float deltaTime)
+    void ShieldCollisionTracker::Update(const FrameContext& frame)
     {
         if (!m_initialized)
       return;
 
-        PlayerCharacter* player = *g_thePlayer;
-        if (!player || !player->loadedState)
+        if (!frame.HasPlayer())
             return;
 
+        m_lastDeltaTime = frame.deltaTime;
+        m_stepCollision.Clear();
+        m_stepPairTest = PairTestResult::NotTested;
+
  // Log first update call to confirm tracker is running
-        static bool loggedFirstUpdate = false;
-        if (!loggedFirstUpdate)
-        {
-  _MESSAGE("ShieldCollisionTracker::Update - First update call!");
-            loggedFirstUpdate = true;
-        }
+        ALOG_CHANNEL(DEBUG, LogChannel::ShieldFirstUpdate, "ShieldCollisionTracker::Update - First update call!");
 
   const PlayerEquipState& equipState = EquipManager::GetSingleton()->GetEquipState();
         
-        // Check directly what the player has equipped - this is always accurate
-        TESForm* leftEquipped = player->GetEquippedObject(true);
-TESForm* rightEquipped = player->GetEquippedObject(false);
-   bool directLeftIsShield = leftEquipped && EquipManager::IsShield(leftEquipped);
- bool directRightIsShield = rightEquipped && EquipManager::IsShield(rightEquipped);
+        // What the player has equipped this step (direct engine read in the frame context, not EquipManager state)
+        bool directLeftIsShield = frame.leftIsShield;
+ bool directRightIsShield = frame.rightIsShield;
       
         // If we detect a mismatch between direct check and EquipManager, force update
         bool equipManagerKnowsShield = (equipState.leftHand.type == WeaponType::Shield) || 
      (equipState.rightHand.type == WeaponType::Shield);
  if ((directLeftIsShield || directRightIsShield) && !equipManagerKnowsShield)
 {
-    _MESSAGE("ShieldCollisionTracker: EquipManager mismatch - forcing UpdateEquipmentState");
+    ALOG_INFO("ShieldCollisionTracker: EquipManager mismatch - forcing UpdateEquipmentState");
   EquipManager::GetSingleton()->UpdateEquipmentState();
         }
 
@@ -92,12 +97,12 @@ TESForm* rightEquipped = player->GetEquippedObject(false);
         {
             if (m_shieldInLeftHand)
             {
-  UpdateShieldGeometry(true, deltaTime);
+  UpdateShieldGeometry(true, frame);
                 m_rightHandShield.Clear();
             }
             else
        {
-       UpdateShieldGeometry(false, deltaTime);
+       UpdateShieldGeometry(false, frame);
          m_leftHandShield.Clear();
     }
         }
@@ -107,22 +112,18 @@ TESForm* rightEquipped = player->GetEquippedObject(false);
             m_rightHandShield.Clear();
         }
         
-      // Debug logging - every 500 frames
-        static int debugLogCounter = 0;
-        debugLogCounter++;
-        if (debugLogCounter % 500 == 1)
-        {
-            _MESSAGE("ShieldCollisionTracker: Debug - Left hand: type=%d isEquipped=%s, Right hand: type=%d isEquipped=%s, m_hasShield=%s, directShield=%s",
+      // Debug logging - periodic
+        ALOG_CHANNEL(DEBUG, LogChannel::ShieldEquipState,
+            "ShieldCollisionTracker: Debug - Left hand: type=%d isEquipped=%s, Right hand: type=%d isEquipped=%s, m_hasShield=%s, directShield=%s",
         (int)currentEquipState.leftHand.type, currentEquipState.leftHand.isEquipped ? "YES" : "NO",
       (int)currentEquipState.rightHand.type, currentEquipState.rightHand.isEquipped ? "YES" : "NO",
  m_hasShield ? "YES" : "NO",
    (directLeftIsShield || directRightIsShield) ? "YES" : "NO");
-        }
         
         // Check weapon hand has HIGGS-grabbed weapon (from our shield collision avoidance)
        // Weapon hand is OPPOSITE of shield hand
         bool weaponHandIsLeft = !m_shieldInLeftHand;
-        bool weaponVRControllerIsLeft = GameHandToVRController(weaponHandIsLeft);
+        bool weaponVRControllerIsLeft = frame.GameHandToController(weaponHandIsLeft);
    bool weaponHandHiggsGrabbed = false;
         TESObjectREFR* higgsHeldWeapon = nullptr;
  
@@ -133,14 +134,10 @@ TESForm* rightEquipped = player->GetEquippedObject(false);
         if (higgsHeldWeapon)
 {
         // Check if HIGGS is actually holding it
-         if (higgsInterface)
-          {
-           TESObjectREFR* currentlyHeld = higgsInterface->GetGrabbedObject(weaponVRControllerIsLeft);
-                if (currentlyHeld == higgsHeldWeapon)
+                if (frame.GrabbedByController(weaponVRControllerIsLeft) == higgsHeldWeapon)
       {
    weaponHandHiggsGrabbed = true;
  }
-    }
       }
         }
         
@@ -154,13 +151,13 @@ TESForm* rightEquipped = player->GetEquippedObject(false);
          if (m_shieldInLeftHand)
         {
                 // Shield in left hand - check right hand for weapon (using direct check)
-                bool directRightIsWeapon = rightEquipped && EquipManager::IsWeapon(rightEquipped);
+                bool directRightIsWeapon = frame.rightIsWeapon;
   hasWeaponToCheck = directRightIsWeapon;
  }
        else
   {
       // Shield in right hand - check left hand for weapon (using direct check)
-           bool directLeftIsWeapon = leftEquipped && EquipManager::IsWeapon(leftEquipped);
+           bool directLeftIsWeapon = frame.leftIsWeapon;
            hasWeaponToCheck = directLeftIsWeapon;
         }
     
@@ -172,6 +169,7 @@ TESForm* rightEquipped = player->GetEquippedObject(false);
     
    ShieldCollisionResult collision;
         bool detected = CheckWeaponShieldCollision(collision, weaponHandHiggsGrabbed);
+        m_stepCollision = collision;
        
   m_weaponContactingShield = collision.isColliding;
        m_collisionImminent = collision.isImminent;
@@ -189,13 +187,13 @@ m_lastCollision = collision;
      // Log collision event and notify VRInputHandler (only on initial contact)
    if (!m_wasContacting)
  {
-         _MESSAGE("ShieldCollision: === WEAPON TOUCHING SHIELD === (HIGGS grabbed: %s)",
+         ALOG_INFO("ShieldCollision: === WEAPON TOUCHING SHIELD === (HIGGS grabbed: %s)",
   weaponHandHiggsGrabbed ? "YES" : "NO");
-_MESSAGE("  Collision Point: (%.2f, %.2f, %.2f)",
+ALOG_INFO("  Collision Point: (%.2f, %.2f, %.2f)",
      collision.collisionPoint.x,
             collision.collisionPoint.y,
    collision.collisionPoint.z);
-      _MESSAGE("  Distance: %.2f", collision.closestDistance);
+      ALOG_INFO("  Distance: %.2f", collision.closestDistance);
    
      // Notify VRInputHandler for collision tracking
   if (weaponHandHiggsGrabbed)
@@ -221,40 +219,27 @@ _MESSAGE("  Collision Point: (%.2f, %.2f, %.2f)",
      // Check if we're in close combat mode - if so, don't trigger unequip
     if (VRInputHandler::GetSingleton()->IsInCloseCombatMode())
       {
-      static bool loggedCloseCombatSkip = false;
-      if (!loggedCloseCombatSkip)
-           {
-          _MESSAGE("ShieldCollision: Collision imminent but CLOSE COMBAT MODE active - skipping unequip");
-        loggedCloseCombatSkip = true;
-             }
+          ALOG_CHANNEL(DEBUG, LogChannel::ShieldCloseCombatSkip, "ShieldCollision: Collision imminent but CLOSE COMBAT MODE active - skipping unequip");
      }
   else
     {
-           static bool loggedCloseCombatSkip = false;
-   loggedCloseCombatSkip = false;
-     
-   _MESSAGE("ShieldCollision: WEAPON-SHIELD COLLISION IMMINENT!%s", withinBackupOnly ? " (BACKUP THRESHOLD - bypassing cooldown)" : "");
-            _MESSAGE("  Distance: %.2f, Time to collision: %.3f sec",
+   ALOG_DEBUG("ShieldCollision: WEAPON-SHIELD COLLISION IMMINENT!%s", withinBackupOnly ? " (BACKUP THRESHOLD - bypassing cooldown)" : "");
+            ALOG_DEBUG("  Distance: %.2f, Time to collision: %.3f sec",
   collision.closestDistance,
      collision.timeToCollision);
    
     // Unequip the WEAPON hand and have HIGGS grab it
             // In right-handed mode: weapon = RIGHT game hand
     // In left-handed mode: weapon = LEFT game hand
-   _MESSAGE("ShieldCollision: Triggering game %s hand unequip + HIGGS grab to prevent collision!",
+   ALOG_INFO("ShieldCollision: Triggering game %s hand unequip + HIGGS grab to prevent collision!",
        weaponHandIsLeft ? "LEFT" : "RIGHT");
-  EquipManager::GetSingleton()->ForceUnequipAndGrab(weaponHandIsLeft);
+  EquipManager::GetSingleton()->ForceUnequipAndGrab(weaponHandIsLeft, frame);
         }
           }
     else if (!m_wasImminent && !m_wasContacting && weaponHandOnCooldown && !withinBackupOnly)
     {
-     // Log that we skipped due to cooldown (only once per cooldown period)
-   static bool loggedCooldownSkip = false;
-      if (!loggedCooldownSkip)
-  {
-  _MESSAGE("ShieldCollision: Collision imminent but %s hand on cooldown - allowing blade to slide against shield", weaponHandIsLeft ? "LEFT" : "RIGHT");
-  loggedCooldownSkip = true;
-   }
+     // Log that we skipped due to cooldown
+  ALOG_CHANNEL(DEBUG, LogChannel::ShieldCooldownSkip, "ShieldCollision: Collision imminent but %s hand on cooldown - allowing blade to slide against shield", weaponHandIsLeft ? "LEFT" : "RIGHT");
       }
       }
         else
@@ -262,9 +247,9 @@ _MESSAGE("  Collision Point: (%.2f, %.2f, %.2f)",
      // Weapon no longer contacting or imminent
         if (m_wasContacting)
             {
-       _MESSAGE("ShieldCollision: === WEAPON NO LONGER TOUCHING SHIELD === (HIGGS grabbed: %s)",
+       ALOG_INFO("ShieldCollision: === WEAPON NO LONGER TOUCHING SHIELD === (HIGGS grabbed: %s)",
       weaponHandHiggsGrabbed ? "YES" : "NO");
- _MESSAGE("  Current distance: %.2f (threshold: %.2f)", 
+ ALOG_INFO("  Current distance: %.2f (threshold: %.2f)", 
    collision.closestDistance, m_collisionThreshold);
      }
              
@@ -288,27 +273,28 @@ _MESSAGE("  Collision Point: (%.2f, %.2f, %.2f)",
    }
     }
 
-    void ShieldCollisionTracker::UpdateShieldGeometry(bool isLeftHand, float deltaTime)
+    void ShieldCollisionTracker::UpdateShieldGeometry(bool isLeftHand, const FrameContext& frame)
     {
      ShieldGeometry& geometry = isLeftHand ? m_leftHandShield : m_rightHandShield;
         
      // Store previous position for velocity calculation
         geometry.prevCenterPosition = geometry.centerPosition;
+        geometry.prevNormal = geometry.normal;
         
         // Get the shield node
-        NiAVObject* shieldNode = GetShieldNode(isLeftHand);
+        NiAVObject* shieldNode = GetShieldNode(frame.rootNode, isLeftHand);
         if (!shieldNode)
         {
   geometry.isValid = false;
           return;
    }
  
-        // Get shield center from world transform
-        geometry.centerPosition = NiPoint3(
-   shieldNode->m_worldTransform.pos.x,
-       shieldNode->m_worldTransform.pos.y,
-    shieldNode->m_worldTransform.pos.z
-        );
+        // Face shape is cached per shield form - steady state is one lookup plus one transform
+        const ShieldShape& shape = GetShieldShape(shieldNode, frame.Equipped(isLeftHand));
+        
+        // Shield center is the face center, carried along by the node's world transform
+        const NiTransform& nodeFrame = shieldNode->m_worldTransform;
+        geometry.centerPosition = LocalToWorld(nodeFrame, shape.centerOffset);
         
         // Get shield facing direction (normal)
         // The shield's local Z axis typically points outward (facing direction)
@@ -322,10 +308,16 @@ _MESSAGE("  Collision Point: (%.2f, %.2f, %.2f)",
         );
         geometry.normal = Normalize(geometry.normal);
         
-        // Set shield radius from config (focuses on shield face, not edges)
-        geometry.radius = shieldRadius;
+        // Face ellipse axes are the node's local X and Y, sized by the cached shape
+        NiMatrix33& faceRot = shieldNode->m_worldTransform.rot;
+        geometry.axisU = Normalize(NiPoint3(faceRot.data[0][0], faceRot.data[1][0], faceRot.data[2][0]));
+        geometry.axisV = Normalize(NiPoint3(faceRot.data[0][1], faceRot.data[1][1], faceRot.data[2][1]));
+        geometry.radiusU = shape.radiusX * nodeFrame.scale;
+        geometry.radiusV = shape.radiusY * nodeFrame.scale;
+        geometry.radius = (geometry.radiusU > geometry.radiusV) ? geometry.radiusU : geometry.radiusV;
      
         // Calculate velocity
+        float deltaTime = frame.deltaTime;
         if (deltaTime > 0.0f && (geometry.prevCenterPosition.x != 0.0f || 
       geometry.prevCenterPosition.y != 0.0f || 
             geometry.prevCenterPosition.z != 0.0f))
@@ -338,27 +330,91 @@ geometry.velocity.z = (geometry.centerPosition.z - geometry.prevCenterPosition.z
         geometry.isValid = true;
     }
 
-    NiAVObject* ShieldCollisionTracker::GetShieldNode(bool isLeftHand)
+    NiAVObject* ShieldCollisionTracker::GetShieldNode(NiNode* rootNode, bool isLeftHand)
     {
-        PlayerCharacter* player = *g_thePlayer;
-        if (!player || !player->loadedState)
-       return nullptr;
-
-   NiNode* rootNode = player->GetNiRootNode(0); // First person root
-   if (!rootNode)
-        {
-            rootNode = player->GetNiRootNode(1); // Third person root
-      }
-   
         if (!rootNode)
      return nullptr;
 
  const char* nodeName = GetShieldOffsetNodeName(isLeftHand);
   
-        BSFixedString nodeNameStr(nodeName);
-        NiAVObject* shieldNode = rootNode->GetObjectByName(&nodeNameStr.data);
-  
-        return shieldNode;
+        return NodeCache::GetSingleton()->Find(rootNode, nodeName);
+    }
+
+    const ShieldShape& ShieldCollisionTracker::GetShieldShape(NiAVObject* shieldNode, TESForm* shield)
+    {
+        // Unknown form - plain ShieldRadius circle at the node origin, not cached
+        static ShieldShape fallbackShape;
+        if (!shield)
+        {
+            fallbackShape.centerOffset = NiPoint3(0, 0, 0);
+            fallbackShape.radiusX = fallbackShape.radiusY = shieldRadius;
+            return fallbackShape;
+        }
+        
+        // Steady state: one probe into the flat map
+        ShieldShape* cached = m_shieldShapes.Find(shield->formID);
+        if (cached && (cached->fromMesh || cached->meshAttempts >= MAX_SHAPE_MESH_ATTEMPTS))
+            return *cached;
+        
+        ShieldShape shape = cached ? *cached : ShieldShape();
+        
+        // Local box around the shield's vertices. Shapes without CPU-side vertices fall back to the
+        // leaf bound spheres projected onto the face plane - each covers a disc of its radius in local XY.
+        NiPoint3 boxMin, boxMax;
+        bool fromVertices = CollectLocalVertexExtents(shieldNode, boxMin, boxMax);
+        int boundCount = 0;
+        if (!fromVertices)
+        {
+            LocalBoundSphere bounds[MAX_LOCAL_BOUNDS];
+            boundCount = CollectLocalBounds(shieldNode, bounds, MAX_LOCAL_BOUNDS);
+            for (int i = 0; i < boundCount; i++)
+            {
+                const LocalBoundSphere& bound = bounds[i];
+                boxMin.x = (bound.center.x - bound.radius < boxMin.x) ? bound.center.x - bound.radius : boxMin.x;
+                boxMin.y = (bound.center.y - bound.radius < boxMin.y) ? bound.center.y - bound.radius : boxMin.y;
+                boxMin.z = (bound.center.z < boxMin.z) ? bound.center.z : boxMin.z;
+                boxMax.x = (bound.center.x + bound.radius > boxMax.x) ? bound.center.x + bound.radius : boxMax.x;
+                boxMax.y = (bound.center.y + bound.radius > boxMax.y) ? bound.center.y + bound.radius : boxMax.y;
+                boxMax.z = (bound.center.z > boxMax.z) ? bound.center.z : boxMax.z;
+            }
+        }
+        
+        // Ellipse inscribed in the box's face (local XY). Bound spheres overhang the mesh, so that box is shrunk.
+        float faceScale = fromVertices ? 1.0f : shieldShapeScale;
+        float radiusX = (boxMax.x - boxMin.x) * 0.5f * faceScale;
+        float radiusY = (boxMax.y - boxMin.y) * 0.5f * faceScale;
+        
+        if ((fromVertices || boundCount > 0) &&
+            radiusX >= MIN_SHAPE_FACE_RADIUS && radiusX <= MAX_SHAPE_FACE_RADIUS &&
+            radiusY >= MIN_SHAPE_FACE_RADIUS && radiusY <= MAX_SHAPE_FACE_RADIUS)
+        {
+            shape.centerOffset = NiPoint3(
+                (boxMin.x + boxMax.x) * 0.5f,
+                (boxMin.y + boxMax.y) * 0.5f,
+                (boxMin.z + boxMax.z) * 0.5f);
+            shape.radiusX = radiusX;
+            shape.radiusY = radiusY;
+            shape.fromMesh = true;
+            
+            ALOG_INFO("ShieldCollisionTracker: Shield shape %08X from mesh %s - ellipse %.1f x %.1f (ShieldRadius %.1f), center offset (%.1f, %.1f, %.1f)",
+                shield->formID, fromVertices ? "vertices" : "bounds", radiusX, radiusY, shieldRadius,
+                shape.centerOffset.x, shape.centerOffset.y, shape.centerOffset.z);
+        }
+        else
+        {
+            // 3D not loaded yet (or no usable bounds) - ShieldRadius circle, try again next step
+            shape.centerOffset = NiPoint3(0, 0, 0);
+            shape.radiusX = shape.radiusY = shieldRadius;
+            shape.meshAttempts++;
+            
+            if (shape.meshAttempts >= MAX_SHAPE_MESH_ATTEMPTS)
+            {
+                ALOG_INFO("ShieldCollisionTracker: Shield shape %08X - no usable mesh bounds, using ShieldRadius %.1f",
+                    shield->formID, shieldRadius);
+            }
+        }
+        
+        return m_shieldShapes.Insert(shield->formID, shape);
     }
 
     const char* ShieldCollisionTracker::GetShieldOffsetNodeName(bool isLeftHand)
@@ -419,25 +475,56 @@ return false;
         outResult.isLeftHandWeapon = weaponIsLeftHand;
  outResult.isLeftHandShield = m_shieldInLeftHand;
         
-        // Calculate closest distance from weapon blade to shield disc
+        // Broadphase: bounding spheres around the weapon and the shield disc, swept over a step
+        // either side of now. Further apart than the largest threshold means nothing below can fire.
+        float triggerDistance = (m_imminentThreshold > shieldImminentThresholdBackup) ? m_imminentThreshold : shieldImminentThresholdBackup;
+        if (m_collisionThreshold > triggerDistance)
+            triggerDistance = m_collisionThreshold;
+        
+        m_broadphaseTests++;
+        if (CollisionMath::BoundingSphereGap(BladeSweptBounds(weapon, m_lastDeltaTime),
+                CollisionMath::DiscBounds(ToVec3(shield.centerPosition), shield.radius, ShieldStepMotion(shield, m_lastDeltaTime))) > triggerDistance)
+        {
+            m_broadphaseRejects++;
+            m_stepPairTest = PairTestResult::Rejected;
+            outResult.closestDistance = CollisionMath::BoundingSphereGap(
+                CollisionMath::CapsuleBounds(ToCapsule(weapon), 0.0f),
+                CollisionMath::DiscBounds(ToVec3(shield.centerPosition), shield.radius, 0.0f));
+            return false;
+        }
+        m_stepPairTest = PairTestResult::Narrowphase;
+        
+        // Calculate closest distance from weapon blade to shield face
         float bladeParam;
   NiPoint3 bladePoint, shieldPoint;
         
-      float distance = ClosestDistanceBladeToShield(
-            weapon.basePosition, weapon.tipPosition,
-            shield.centerPosition, shield.normal, shield.radius,
+      float axisDistance = ClosestDistanceBladeToShield(
+            weapon.basePosition, weapon.tipPosition, shield,
             bladeParam, bladePoint, shieldPoint
         );
         
+        // The weapon is a capsule - measure from its surface (for a sword, its axis as before)
+        float weaponRadius = CollisionRadius(weapon);
+        float distance = axisDistance - weaponRadius;
+        
+        NiPoint3 weaponSurfacePoint = bladePoint;
+        if (axisDistance > 0.0001f)
+        {
+            float toSurface = weaponRadius / axisDistance;
+            weaponSurfacePoint.x += (shieldPoint.x - bladePoint.x) * toSurface;
+            weaponSurfacePoint.y += (shieldPoint.y - bladePoint.y) * toSurface;
+            weaponSurfacePoint.z += (shieldPoint.z - bladePoint.z) * toSurface;
+        }
+        
     outResult.closestDistance = distance;
         outResult.weaponParameter = bladeParam;
-        outResult.weaponContactPoint = bladePoint;
+        outResult.weaponContactPoint = weaponSurfacePoint;
         outResult.shieldContactPoint = shieldPoint;
         
   // Calculate collision point (midpoint)
-        outResult.collisionPoint.x = (bladePoint.x + shieldPoint.x) * 0.5f;
-        outResult.collisionPoint.y = (bladePoint.y + shieldPoint.y) * 0.5f;
-        outResult.collisionPoint.z = (bladePoint.z + shieldPoint.z) * 0.5f;
+        outResult.collisionPoint.x = (weaponSurfacePoint.x + shieldPoint.x) * 0.5f;
+        outResult.collisionPoint.y = (weaponSurfacePoint.y + shieldPoint.y) * 0.5f;
+        outResult.collisionPoint.z = (weaponSurfacePoint.z + shieldPoint.z) * 0.5f;
         
         // Calculate impact angle (angle between blade direction and shield normal)
         NiPoint3 bladeDir;
@@ -477,9 +564,29 @@ return false;
         }
         
     float closingVelocity = Dot(relVel, separationDir);
+        outResult.closingVelocity = closingVelocity;
         
         // Estimate time to collision
      outResult.timeToCollision = EstimateTimeToCollision(distance, closingVelocity);
+
+        // Continuous (swept) collision - exact time of impact along the weapon's path relative to
+        // the shield, so neither a fast swing nor a shield bash can pass through between two steps
+        if (shieldContinuousCollision && m_lastDeltaTime > 0.0f && distance > m_collisionThreshold)
+        {
+            float horizon = (shieldTimeToCollisionThreshold > m_lastDeltaTime) ? shieldTimeToCollisionThreshold : m_lastDeltaTime;
+
+            CollisionMath::TimeOfImpactResult impact;
+            if (CollisionMath::SweptSegmentEllipseTimeOfImpact(SweepRelativeToShield(weapon, shield), ToEllipse(shield),
+                m_collisionThreshold + weaponRadius, horizon, impact))
+            {
+                outResult.timeToCollision = impact.time;
+                outResult.isSweptImpact = (impact.time <= m_lastDeltaTime);
+            }
+            else if (!impact.exhausted)
+            {
+                outResult.timeToCollision = -1.0f;
+            }
+        }
      
      // Check if weapon is in front of shield face (not behind or to the side)
         // Calculate vector from shield center to blade contact point
@@ -500,155 +607,40 @@ return false;
         // Check collision states - only trigger if weapon is in front of shield face
         outResult.isColliding = (distance <= m_collisionThreshold) && weaponInFrontOfShield;
       outResult.isImminent = !outResult.isColliding && 
-   (distance <= m_imminentThreshold) && 
-   isApproaching &&         // Only imminent if approaching with meaningful velocity
+   (((distance <= m_imminentThreshold) && 
+   isApproaching) ||         // Only imminent if approaching with meaningful velocity
+            outResult.isSweptImpact) &&  // ...or the swept test reaches the shield before the next step
             weaponInFrontOfShield;       // Only imminent if in front of shield
         
         // Debug logging for troubleshooting
-        static int debugCounter = 0;
-        debugCounter++;
-      if (debugCounter % 200 == 0)
-        {
-       _MESSAGE("ShieldCollision: dist=%.2f, closingVel=%.2f, frontDot=%.2f, inFront=%s, approaching=%s, imminent=%s",
+       ALOG_CHANNEL(DEBUG, LogChannel::ShieldCollisionState,
+           "ShieldCollision: dist=%.2f, closingVel=%.2f, frontDot=%.2f, inFront=%s, approaching=%s, imminent=%s",
   distance, closingVelocity, frontFaceDot,
                 weaponInFrontOfShield ? "YES" : "NO",
       isApproaching ? "YES" : "NO",
    outResult.isImminent ? "YES" : "NO");
-   }
     
   return outResult.isColliding || outResult.isImminent;
     }
 
     float ShieldCollisionTracker::EstimateTimeToCollision(float distance, float closingVelocity)
     {
-        // If not approaching (velocity <= 0) or already colliding, return -1
-        if (closingVelocity <= 0.0f || distance <= m_collisionThreshold)
-            return -1.0f;
-        
-        // Time = distance / velocity
-        float timeToCollision = (distance - m_collisionThreshold) / closingVelocity;
-        
-        // Cap at a reasonable maximum (e.g., 2 seconds)
-        if (timeToCollision > 2.0f)
-        return -1.0f;
-        
-        return timeToCollision;
+        return CollisionMath::EstimateTimeToCollision(distance, closingVelocity, m_collisionThreshold);
     }
 
     float ShieldCollisionTracker::ClosestDistanceBladeToShield(
-        const NiPoint3& bladeBase, const NiPoint3& bladeTip,
-        const NiPoint3& shieldCenter, const NiPoint3& shieldNormal, float shieldRadius,
+        const NiPoint3& bladeBase, const NiPoint3& bladeTip, const ShieldGeometry& shield,
         float& outBladeParam, NiPoint3& outBladePoint, NiPoint3& outShieldPoint)
     {
-        // We model the shield as a disc (circle in 3D space)
-        // Find the closest point on the blade segment to the shield disc
-        
-        NiPoint3 bladeDir;
- bladeDir.x = bladeTip.x - bladeBase.x;
-      bladeDir.y = bladeTip.y - bladeBase.y;
-        bladeDir.z = bladeTip.z - bladeBase.z;
-      
-        float bladeLength = Length(bladeDir);
-        if (bladeLength < 0.0001f)
-        {
- // Degenerate blade - treat as point
-        outBladeParam = 0.0f;
-          outBladePoint = bladeBase;
-    outShieldPoint = ClampPointToDisc(bladeBase, shieldCenter, shieldNormal, shieldRadius);
-  
-      NiPoint3 diff;
-      diff.x = outBladePoint.x - outShieldPoint.x;
-  diff.y = outBladePoint.y - outShieldPoint.y;
-      diff.z = outBladePoint.z - outShieldPoint.z;
-    return Length(diff);
-        }
-     
-        // Sample multiple points along the blade and find closest to shield
-        // This is a simplified approach - a more accurate method would solve analytically
-    float minDist = FLT_MAX;
-   float bestParam = 0.0f;
-        NiPoint3 bestBladePoint, bestShieldPoint;
-        
-    const int numSamples = 10;
-        for (int i = 0; i <= numSamples; i++)
-        {
-     float t = (float)i / (float)numSamples;
-            
-            NiPoint3 bladePoint;
-     bladePoint.x = bladeBase.x + t * bladeDir.x;
-   bladePoint.y = bladeBase.y + t * bladeDir.y;
-        bladePoint.z = bladeBase.z + t * bladeDir.z;
-          
-            // Project blade point onto shield plane, then clamp to disc
-            NiPoint3 shieldPoint = ClampPointToDisc(bladePoint, shieldCenter, shieldNormal, shieldRadius);
-       
-            NiPoint3 diff;
-            diff.x = bladePoint.x - shieldPoint.x;
-          diff.y = bladePoint.y - shieldPoint.y;
-            diff.z = bladePoint.z - shieldPoint.z;
-     float dist = Length(diff);
-
-       if (dist < minDist)
- {
-         minDist = dist;
-  bestParam = t;
-    bestBladePoint = bladePoint;
-      bestShieldPoint = shieldPoint;
-            }
-        }
-        
-        outBladeParam = bestParam;
-        outBladePoint = bestBladePoint;
-        outShieldPoint = bestShieldPoint;
-        
-        return minDist;
-}
-
-    NiPoint3 ShieldCollisionTracker::ProjectPointOntoPlane(
-    const NiPoint3& point, const NiPoint3& planePoint, const NiPoint3& planeNormal)
-    {
-        NiPoint3 diff;
-        diff.x = point.x - planePoint.x;
-        diff.y = point.y - planePoint.y;
-        diff.z = point.z - planePoint.z;
-        
-        float dist = Dot(diff, planeNormal);
-        
-        NiPoint3 result;
-        result.x = point.x - dist * planeNormal.x;
-        result.y = point.y - dist * planeNormal.y;
-     result.z = point.z - dist * planeNormal.z;
-      
-     return result;
-    }
-
-    NiPoint3 ShieldCollisionTracker::ClampPointToDisc(
-        const NiPoint3& point, const NiPoint3& center, const NiPoint3& normal, float radius)
-    {
-        // First project point onto the plane containing the disc
-NiPoint3 projected = ProjectPointOntoPlane(point, center, normal);
-        
- // Then clamp to disc radius
-        NiPoint3 toProjected;
-  toProjected.x = projected.x - center.x;
-    toProjected.y = projected.y - center.y;
-        toProjected.z = projected.z - center.z;
-        
-        float distFromCenter = Length(toProjected);
-        
-   if (distFromCenter <= radius)
-   {
-            return projected;  // Point is within disc
-        }
- 
-     // Clamp to edge of disc
-        NiPoint3 direction = Normalize(toProjected);
-        NiPoint3 result;
-    result.x = center.x + direction.x * radius;
-        result.y = center.y + direction.y * radius;
-        result.z = center.z + direction.z * radius;
-     
-   return result;
+        // We model the shield face as a flat ellipse sized from the shield's mesh
+        CollisionMath::Vec3 bladePoint, shieldPoint;
+        float distance = CollisionMath::ClosestDistanceSegmentToEllipse(
+            ToVec3(bladeBase), ToVec3(bladeTip), ToEllipse(shield),
+            outBladeParam, bladePoint, shieldPoint);
+
+        outBladePoint = ToNiPoint3(bladePoint);
+        outShieldPoint = ToNiPoint3(shieldPoint);
+        return distance;
     }
 
     // ============================================
@@ -701,12 +693,12 @@ NiPoint3 projected = ProjectPointOntoPlane(point, center, normal);
          const ShieldGeometry& shield = m_shieldInLeftHand ? m_leftHandShield : m_rightHandShield;
     if (shield.isValid)
      {
-      _MESSAGE("ShieldCollision: Shield in %s hand - Center(%.2f, %.2f, %.2f) Radius: %.2f",
+      ALOG_INFO("ShieldCollision: Shield in %s hand - Center(%.2f, %.2f, %.2f) Ellipse: %.2f x %.2f",
           m_shieldInLeftHand ? "Left" : "Right",
               shield.centerPosition.x,
           shield.centerPosition.y,
    shield.centerPosition.z,
-      shield.radius);
+      shield.radiusU, shield.radiusV);
    }
   }
     }
@@ -720,8 +712,8 @@ NiPoint3 projected = ProjectPointOntoPlane(point, center, normal);
         ShieldCollisionTracker::GetSingleton()->Initialize();
     }
 
-    void UpdateShieldCollision(float deltaTime)
+    void UpdateShieldCollision(const FrameContext& frame)
     {
-        ShieldCollisionTracker::GetSingleton()->Update(deltaTime);
+        ShieldCollisionTracker::GetSingleton()->Update(frame);
     }
 }
@@ -16,12 +16,17 @@ namespace FalseEdgeVR
     {
         NiPoint3 centerPosition;    // World position of shield center
         NiPoint3 normal;            // Shield facing direction (normal)
+        NiPoint3 axisU;             // In-plane unit axis of the face ellipse (node local X)
+        NiPoint3 axisV;             // In-plane unit axis of the face ellipse (node local Y)
         NiPoint3 velocity;          // Velocity of shield center
-        float radius;              // Approximate shield radius
+        float radiusU;              // Face ellipse semi-axis along axisU
+        float radiusV;              // Face ellipse semi-axis along axisV
+        float radius;              // Bounding radius of the face (larger semi-axis)
         bool isValid;               // Whether the geometry data is valid
    
      // Previous frame position for velocity calculation
    NiPoint3 prevCenterPosition;
+        NiPoint3 prevNormal;        // Previous frame normal (rim motion for the broadphase)
         
         void Clear()
  {
@@ -29,7 +34,12 @@ namespace FalseEdgeVR
  normal = NiPoint3(0, 0, 0);
             velocity = NiPoint3(0, 0, 0);
             prevCenterPosition = NiPoint3(0, 0, 0);
+            prevNormal = NiPoint3(0, 0, 0);
+            axisU = NiPoint3(1, 0, 0);
+            axisV = NiPoint3(0, 1, 0);
       radius = 25.0f;  // Default shield radius
+            radiusU = radius;
+            radiusV = radius;
        isValid = false;
       }
  
@@ -39,6 +49,51 @@ namespace FalseEdgeVR
         }
     };
 
+    // Shield face as a planar ellipse
+    inline CollisionMath::PlanarEllipse ToEllipse(const ShieldGeometry& shield)
+    {
+        return { ToVec3(shield.centerPosition), ToVec3(shield.normal), ToVec3(shield.axisU), ToVec3(shield.axisV),
+                 shield.radiusU, shield.radiusV };
+    }
+    
+    // Face shape of one shield model in its node's local frame. Built once per FormID from the
+    // vertex extents of the shield's 3D (its leaf bounds if the vertices aren't readable), so kite
+    // shields get a tall ellipse and bucklers a small one.
+    struct ShieldShape
+    {
+        NiPoint3 centerOffset;      // Face center relative to the node origin (local space, unscaled)
+        float radiusX = 0.0f;       // Semi-axis along local X, unscaled
+        float radiusY = 0.0f;       // Semi-axis along local Y, unscaled
+        bool fromMesh = false;      // false = ShieldRadius circle while the 3D isn't loaded
+        UInt8 meshAttempts = 0;     // Failed mesh reads so far (gives up after a few)
+    };
+    
+    // Weapon moving relative to the shield, so the shield can be swept against as if it stood
+    // still. Shield rotation is left out; ShieldStepMotion covers it in the broadphase.
+    inline CollisionMath::SweptSegment SweepRelativeToShield(const BladeGeometry& weapon, const ShieldGeometry& shield)
+    {
+        CollisionMath::Vec3 shieldVelocity = ToVec3(shield.velocity);
+        return { ToVec3(weapon.basePosition), ToVec3(weapon.tipPosition),
+                 ToVec3(weapon.baseVelocity) - shieldVelocity, ToVec3(weapon.tipVelocity) - shieldVelocity };
+    }
+    
+    // How far any point of the shield disc can move within one step either side of now.
+    // The rim moves by the center's displacement plus radius * |normal change| when the shield tilts.
+    inline float ShieldStepMotion(const ShieldGeometry& shield, float deltaTime)
+    {
+        float motion = CollisionMath::Length(ToVec3(shield.velocity)) * deltaTime;
+        bool hasPrevious = shield.prevNormal.x != 0.0f || shield.prevNormal.y != 0.0f || shield.prevNormal.z != 0.0f;
+        if (hasPrevious)
+        {
+            float lastMoved = CollisionMath::Length(ToVec3(shield.centerPosition) - ToVec3(shield.prevCenterPosition)) +
+                shield.radius * CollisionMath::Length(ToVec3(shield.normal) - ToVec3(shield.prevNormal));
+            float stepBound = CollisionMath::MaxNextStepDisplacement(lastMoved, bladeMaxAcceleration, deltaTime);
+            if (stepBound > motion)
+                motion = stepBound;
+        }
+        return motion;
+    }
+    
   // Shield collision result data
     struct ShieldCollisionResult
     {
@@ -47,11 +102,13 @@ namespace FalseEdgeVR
         NiPoint3 collisionPoint;        // World position where contact occurs
         NiPoint3 weaponContactPoint;    // Point on weapon where contact occurs
         NiPoint3 shieldContactPoint;    // Point on shield where contact occurs
-     float closestDistance;     // Distance from weapon to shield surface
+     float closestDistance;     // Distance from weapon capsule surface to shield surface
         float weaponParameter;          // Parameter (0-1) along weapon blade
         float relativeVelocity;         // Relative velocity at collision
+        float closingVelocity;          // Relative velocity along the gap (positive = weapon approaching the shield)
    float impactAngle;  // Angle of weapon relative to shield normal (degrees)
    float timeToCollision;          // Estimated time until collision
+        bool isSweptImpact;             // Swept test: weapon reaches the shield before the next step
         bool isLeftHandWeapon;          // Which hand holds the weapon
   bool isLeftHandShield;        // Which hand holds the shield
     
@@ -65,8 +122,10 @@ namespace FalseEdgeVR
             closestDistance = FLT_MAX;
      weaponParameter = 0.0f;
           relativeVelocity = 0.0f;
+            closingVelocity = 0.0f;
             impactAngle = 0.0f;
          timeToCollision = -1.0f;
+            isSweptImpact = false;
             isLeftHandWeapon = false;
       isLeftHandShield = false;
         }
@@ -90,7 +149,7 @@ namespace FalseEdgeVR
         void Initialize();
         
    // Update shield geometry and check collisions - call this each frame
-        void Update(float deltaTime);
+        void Update(const FrameContext& frame);
       
       // Get shield geometry for a specific hand
         const ShieldGeometry& GetShieldGeometry(bool isLeftHand) const;
@@ -117,6 +176,10 @@ namespace FalseEdgeVR
       // Check if collision is imminent
         bool IsCollisionImminent() const { return m_collisionImminent; }
         
+        // This step's weapon-vs-shield test: its result (cleared if it did not run) and how far it got
+        const ShieldCollisionResult& GetStepCollisionResult() const { return m_stepCollision; }
+        PairTestResult GetStepPairTest() const { return m_stepPairTest; }
+        
         // Set collision threshold distance (default ~8 units)
   void SetCollisionThreshold(float threshold) { m_collisionThreshold = threshold; }
       float GetCollisionThreshold() const { return m_collisionThreshold; }
@@ -128,6 +191,13 @@ namespace FalseEdgeVR
         // Register callback for shield collision events
         void SetCollisionCallback(ShieldCollisionCallback callback) { m_collisionCallback = callback; }
         
+        // Broadphase stats (weapon/shield pairs tested / rejected by the bounding-sphere test)
+        UInt32 GetBroadphaseTestCount() const { return m_broadphaseTests; }
+        UInt32 GetBroadphaseRejectCount() const { return m_broadphaseRejects; }
+        
+        // Start a new stats window (logged with the pose scheduler's report)
+        void ResetPipelineStats() { m_broadphaseTests = m_broadphaseRejects = 0; }
+        
     private:
         ShieldCollisionTracker() = default;
         ~ShieldCollisionTracker() = default;
@@ -135,33 +205,29 @@ namespace FalseEdgeVR
  ShieldCollisionTracker& operator=(const ShieldCollisionTracker&) = delete;
         
   // Update geometry for shield
-        void UpdateShieldGeometry(bool isLeftHand, float deltaTime);
+        void UpdateShieldGeometry(bool isLeftHand, const FrameContext& frame);
      
      // Update geometry for HIGGS-grabbed weapon
         void UpdateHiggsGrabbedWeaponGeometry(TESObjectREFR* grabbedRef, float deltaTime);
  
-        // Get the shield node from player skeleton
-        NiAVObject* GetShieldNode(bool isLeftHand);
+        // Get the shield node from the player's root node
+        NiAVObject* GetShieldNode(NiNode* rootNode, bool isLeftHand);
         
         // Get the appropriate shield offset node name
         const char* GetShieldOffsetNodeName(bool isLeftHand);
         
-        // Calculate closest distance from blade segment to shield disc
+        // Cached face shape for the shield form (built from the node's mesh bounds on first use)
+        const ShieldShape& GetShieldShape(NiAVObject* shieldNode, TESForm* shield);
+        
+        // Calculate closest distance from blade segment to the shield face ellipse
     float ClosestDistanceBladeToShield(
-   const NiPoint3& bladeBase, const NiPoint3& bladeTip,
-   const NiPoint3& shieldCenter, const NiPoint3& shieldNormal, float shieldRadius,
+   const NiPoint3& bladeBase, const NiPoint3& bladeTip, const ShieldGeometry& shield,
        float& outBladeParam, NiPoint3& outBladePoint, NiPoint3& outShieldPoint
         );
         
         // Estimate time to collision
         float EstimateTimeToCollision(float distance, float closingVelocity);
     
-        // Helper: project point onto plane
-    NiPoint3 ProjectPointOntoPlane(const NiPoint3& point, const NiPoint3& planePoint, const NiPoint3& planeNormal);
-        
-        // Helper: clamp point to disc
-        NiPoint3 ClampPointToDisc(const NiPoint3& point, const NiPoint3& center, const NiPoint3& normal, float radius);
-        
       // Helper functions
         static float Dot(const NiPoint3& a, const NiPoint3& b);
         static float Clamp(float value, float min, float max);
@@ -176,6 +242,8 @@ namespace FalseEdgeVR
      ShieldGeometry m_rightHandShield;
         BladeGeometry m_higgsGrabbedWeapon;   // For tracking HIGGS-grabbed right hand weapon
         ShieldCollisionResult m_lastCollision;
+        ShieldCollisionResult m_stepCollision;
+        PairTestResult m_stepPairTest = PairTestResult::NotTested;
     ShieldCollisionCallback m_collisionCallback = nullptr;
  
         bool m_initialized = false;
@@ -187,11 +255,16 @@ bool m_wasContacting = false;       // Previous frame contact state
         bool m_wasImminent = false;             // Previous frame imminent state
         float m_collisionThreshold = 8.0f;      // Distance threshold for collision
   float m_imminentThreshold = 15.0f;  // Distance threshold for imminent collision
+        float m_lastDeltaTime = 0.0f;           // Step interval, used as the swept collision horizon
+        UInt32 m_broadphaseTests = 0;
+        UInt32 m_broadphaseRejects = 0;
+        
+        FlatFormIDMap<ShieldShape> m_shieldShapes;  // Per shield FormID
     };
     
     // Convenience function to initialize shield collision tracking
     void InitializeShieldCollisionTracker();
     
     // Convenience function to update shield collision (call each frame)
-    void UpdateShieldCollision(float deltaTime);
+    void UpdateShieldCollision(const FrameContext& frame);
 }
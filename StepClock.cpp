@@ -0,0 +1,23 @@
+#include "StepClock.h"
+#include <chrono>
+
+namespace FalseEdgeVR
+{
+    double SteadyStepClock::Now() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static SteadyStepClock s_steadyClock;
+    static IStepClock* s_stepClock = &s_steadyClock;
+
+    IStepClock* GetStepClock()
+    {
+        return s_stepClock;
+    }
+
+    void SetStepClock(IStepClock* clock)
+    {
+        s_stepClock = clock ? clock : &s_steadyClock;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// ============================================
+// StepClock - where OnPrePhysicsStep gets its time from
+// ============================================
+// The step interval comes from the installed clock instead of reading the system clock
+// directly. The default is std::chrono::steady_clock. A harness can install its own
+// IStepClock and advance it by whatever it likes between steps, so the trackers,
+// timers and scheduler run deterministically, and faster than real time.
+
+namespace FalseEdgeVR
+{
+    class IStepClock
+    {
+    public:
+        virtual ~IStepClock() = default;
+
+        // Monotonic time in seconds (arbitrary origin)
+        virtual double Now() const = 0;
+    };
+
+    // Real time
+    class SteadyStepClock : public IStepClock
+    {
+    public:
+        double Now() const override;
+    };
+
+    // Installed clock; never null (falls back to the steady clock)
+    IStepClock* GetStepClock();
+
+    // Install a clock (nullptr restores the steady clock). Not owned - must outlive its use.
+    // Swap clocks between steps, not during one.
+    void SetStepClock(IStepClock* clock);
+}
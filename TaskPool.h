@@ -0,0 +1,106 @@
+#pragma once
+
+// ============================================
+// TaskPool - fixed pool of game-thread task objects
+// ============================================
+// The SKSE task delegates this plugin posts (spell casts, delayed equips/removals,
+// re-equip checks) are small and short-lived. Instead of new/delete for each, they
+// are constructed in place in a per-type pool of up to 64 slots. The slots are tracked
+// by a bitmask, claimed with a CAS and released with one atomic AND, so Create and
+// Dispose are lock-free from any thread. A full pool falls back to the heap.
+//
+// Usage: derive the task from PooledTask<Self> and create it with Self::Create(args).
+// Dispose() (called by SKSE after Run) returns it to the pool.
+
+#include "skse64/gamethreads.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace FalseEdgeVR
+{
+    template <typename T, size_t Capacity = 32>
+    class TaskPool
+    {
+        static_assert(Capacity > 0 && Capacity <= 64, "TaskPool tracks slots in one 64-bit mask");
+
+    public:
+        template <typename... Args>
+        T* Create(Args&&... args)
+        {
+            uint64_t used = m_used.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                uint64_t freeSlots = ~used & kAllSlots;
+                if (freeSlots == 0)
+                    break;
+
+                size_t index = 0;
+                while (!(freeSlots & (1ull << index)))
+                    index++;
+
+                if (m_used.compare_exchange_weak(used, used | (1ull << index), std::memory_order_acquire, std::memory_order_relaxed))
+                    return new (m_storage[index]) T(std::forward<Args>(args)...);
+            }
+
+            // Pool exhausted - still works, just allocates
+            m_heapFallbacks.fetch_add(1, std::memory_order_relaxed);
+            return new T(std::forward<Args>(args)...);
+        }
+
+        void Destroy(T* object)
+        {
+            if (!object)
+                return;
+
+            unsigned char* address = reinterpret_cast<unsigned char*>(object);
+            if (address < m_storage[0] || address >= m_storage[0] + sizeof(m_storage))
+            {
+                delete object;
+                return;
+            }
+
+            size_t index = (address - m_storage[0]) / sizeof(Slot);
+            object->~T();
+            m_used.fetch_and(~(1ull << index), std::memory_order_release);
+        }
+
+        // Objects that did not fit in the pool since startup
+        uint32_t GetHeapFallbackCount() const { return m_heapFallbacks.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr uint64_t kAllSlots = (Capacity == 64) ? ~0ull : ((1ull << Capacity) - 1);
+
+        typedef unsigned char Slot[sizeof(T)];
+
+        alignas(T) unsigned char m_storage[Capacity][sizeof(T)];
+        std::atomic<uint64_t> m_used{ 0 };
+        std::atomic<uint32_t> m_heapFallbacks{ 0 };
+    };
+
+    // Task delegate that lives in TaskPool<T> and returns there on Dispose
+    template <typename T>
+    class PooledTask : public TaskDelegate
+    {
+    public:
+        template <typename... Args>
+        static T* Create(Args&&... args)
+        {
+            return Pool().Create(std::forward<Args>(args)...);
+        }
+
+        virtual void Dispose() override
+        {
+            Pool().Destroy(static_cast<T*>(this));
+        }
+
+    protected:
+        static TaskPool<T>& Pool()
+        {
+            static TaskPool<T> pool;
+            return pool;
+        }
+    };
+}
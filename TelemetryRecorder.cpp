@@ -0,0 +1,129 @@
+#include "TelemetryRecorder.h"
+#include "Logging.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+namespace FalseEdgeVR
+{
+    // ~2.8 seconds of steps at 90 per second (45 KB) - also the most a crash can lose
+    static const uint32_t kRecordsPerBuffer = 256;
+
+    struct TelemetryBuffer
+    {
+        TelemetryRecord records[kRecordsPerBuffer];
+        uint32_t count = 0;
+        std::atomic<bool> full{ false };    // Owned by the writer until it clears this
+    };
+
+    static TelemetryBuffer s_buffers[2];
+    static uint32_t s_activeBuffer = 0;     // Recording thread only
+    static std::atomic<uint32_t> s_droppedRecords{ 0 };
+    static std::atomic<bool> s_writerStarted{ false };
+    static char s_path[512];
+
+    static void HandOffActiveBuffer()
+    {
+        TelemetryBuffer& buffer = s_buffers[s_activeBuffer];
+        if (buffer.count == 0 || buffer.full.load(std::memory_order_acquire))
+            return;
+
+        buffer.full.store(true, std::memory_order_release);
+        s_activeBuffer ^= 1;
+    }
+
+    void RecordTelemetry(const TelemetryRecord& record)
+    {
+        TelemetryBuffer& buffer = s_buffers[s_activeBuffer];
+
+        // Both buffers with the writer - it is a whole buffer behind
+        if (buffer.full.load(std::memory_order_acquire))
+        {
+            s_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.records[buffer.count++] = record;
+        if (buffer.count == kRecordsPerBuffer)
+            HandOffActiveBuffer();
+    }
+
+    void FlushTelemetry()
+    {
+        HandOffActiveBuffer();
+    }
+
+    uint32_t GetTelemetryDropCount()
+    {
+        return s_droppedRecords.load(std::memory_order_relaxed);
+    }
+
+    static void WriterLoop()
+    {
+        FILE* file = fopen(s_path, "wb");
+        if (!file)
+        {
+            ALOG_ERROR("TelemetryRecorder: ERROR: Could not open %s - recording disabled", s_path);
+            return;
+        }
+
+        TelemetryFileHeader header;
+        memcpy(header.magic, "FEVT", 4);
+        header.version = kTelemetryVersion;
+        header.recordSize = sizeof(TelemetryRecord);
+        header.reserved = 0;
+        fwrite(&header, sizeof(header), 1, file);
+        fflush(file);
+        ALOG_INFO("TelemetryRecorder: Recording to %s (%u-byte records)", s_path, (unsigned)sizeof(TelemetryRecord));
+
+        // Buffers are handed over alternately, so taking them alternately keeps the file in step order
+        uint32_t next = 0;
+        uint32_t reportedDrops = 0;
+        for (;;)
+        {
+            TelemetryBuffer& buffer = s_buffers[next];
+            if (!buffer.full.load(std::memory_order_acquire))
+            {
+                // The recording thread never signals (that could block it) - poll while idle
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                continue;
+            }
+
+            fwrite(buffer.records, sizeof(TelemetryRecord), buffer.count, file);
+            fflush(file);
+            buffer.count = 0;
+            buffer.full.store(false, std::memory_order_release);
+            next ^= 1;
+
+            uint32_t drops = s_droppedRecords.load(std::memory_order_relaxed);
+            if (drops != reportedDrops)
+            {
+                ALOG_WARN("TelemetryRecorder: %u records dropped (writer behind), %u total", drops - reportedDrops, drops);
+                reportedDrops = drops;
+            }
+        }
+    }
+
+    void StartTelemetry(const char* path)
+    {
+        if (s_writerStarted.exchange(true))
+            return;
+
+        strncpy(s_path, path, sizeof(s_path) - 1);
+        s_path[sizeof(s_path) - 1] = '\0';
+
+        // Touch every page now so the first records don't fault them in mid-step
+        for (TelemetryBuffer& buffer : s_buffers)
+            memset(buffer.records, 0, sizeof(buffer.records));
+
+        // Lives as long as the process, like the AsyncLog writer
+        std::thread(WriterLoop).detach();
+    }
+
+    bool IsTelemetryStarted()
+    {
+        return s_writerStarted.load(std::memory_order_relaxed);
+    }
+}
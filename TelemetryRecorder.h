@@ -0,0 +1,109 @@
+#pragma once
+
+// ============================================
+// TelemetryRecorder - per-step binary records for collision tuning
+// ============================================
+// With TelemetryRecording=1 every pose step appends one fixed-size TelemetryRecord:
+// blade and shield poses and velocities, what the pair tests found and the collision
+// state machine. Replaying those against different thresholds beats reading the log.
+//
+// The step thread copies each record into one of two preallocated buffers. A full
+// buffer is handed to a background writer thread, and the step carries on in the other.
+// Recording costs a copy of the record - no allocation, no formatting, no file I/O. If
+// the writer is still busy with the other buffer when the current one fills, records
+// are dropped and counted rather than making the step wait.
+//
+// File: one TelemetryFileHeader, then records back to back (little-endian, no padding).
+
+#include <cstdint>
+
+namespace FalseEdgeVR
+{
+    struct TelemetryFileHeader
+    {
+        char magic[4];              // "FEVT"
+        uint32_t version;
+        uint32_t recordSize;        // sizeof(TelemetryRecord)
+        uint32_t reserved;
+    };
+
+    static const uint32_t kTelemetryVersion = 1;
+
+    // TelemetryRecord::flags
+    enum TelemetryFlags : uint32_t
+    {
+        kTelemetry_LeftBladeValid       = 1 << 0,
+        kTelemetry_RightBladeValid      = 1 << 1,
+        kTelemetry_LeftIsDagger         = 1 << 2,
+        kTelemetry_RightIsDagger        = 1 << 3,
+        kTelemetry_ShieldValid          = 1 << 4,
+        kTelemetry_ShieldInLeftHand     = 1 << 5,
+        kTelemetry_BladesInContact      = 1 << 6,
+        kTelemetry_BladesImminent       = 1 << 7,
+        kTelemetry_BladeSweptImpact     = 1 << 8,
+        kTelemetry_BladeTunneled        = 1 << 9,
+        kTelemetry_ShieldContact        = 1 << 10,
+        kTelemetry_ShieldImminent       = 1 << 11,
+        kTelemetry_ShieldSweptImpact    = 1 << 12,
+        kTelemetry_HiggsCollisionActive = 1 << 13,
+        kTelemetry_ShieldCollisionActive = 1 << 14,
+        kTelemetry_LeftOnCooldown       = 1 << 15,
+        kTelemetry_RightOnCooldown      = 1 << 16,
+        kTelemetry_PendingReequipLeft   = 1 << 17,
+        kTelemetry_PendingReequipRight  = 1 << 18,
+        kTelemetry_InCombat             = 1 << 19,
+        kTelemetry_CloseCombatMode      = 1 << 20,
+        kTelemetry_LeftHandedMode       = 1 << 21,
+    };
+
+    // One pose step. Blades are by game hand; positions are world space, velocities are
+    // units per second. Values for a side without valid geometry are zero.
+    struct TelemetryRecord
+    {
+        float time;                     // Step clock seconds since recording started
+        uint32_t frameNumber;           // FrameContext::frameNumber
+        float deltaTime;
+        uint32_t flags;                 // TelemetryFlags
+        uint8_t bladePairTest;          // PairTestResult
+        uint8_t shieldPairTest;         // PairTestResult
+        uint16_t reserved;
+
+        float leftBase[3];
+        float leftTip[3];
+        float leftBaseVelocity[3];
+        float leftTipVelocity[3];
+        float rightBase[3];
+        float rightTip[3];
+        float rightBaseVelocity[3];
+        float rightTipVelocity[3];
+
+        float shieldCenter[3];
+        float shieldNormal[3];
+        float shieldVelocity[3];
+
+        // This step's pair tests. Distance is FLT_MAX when the test did not run, and the
+        // sphere gap (a lower bound) when the broadphase rejected it. Closing velocity is signed:
+        // positive while the pair approaches, negative while it separates.
+        float bladeDistance;
+        float bladeClosingVelocity;
+        float bladeTimeToCollision;     // -1 = not closing
+        float shieldDistance;
+        float shieldClosingVelocity;
+        float shieldTimeToCollision;
+    };
+    static_assert(sizeof(TelemetryRecord) == 176, "TelemetryRecord: layout is part of the file format");
+
+    // Opens the file (truncating it) and starts the writer thread. Only the first call does
+    // anything. The file is opened on the writer thread; failure is logged there.
+    void StartTelemetry(const char* path);
+    bool IsTelemetryStarted();
+
+    // Recording thread only (one thread at a time)
+    void RecordTelemetry(const TelemetryRecord& record);
+
+    // Hands a partly filled buffer to the writer. Recording thread only.
+    void FlushTelemetry();
+
+    // Records dropped since startup
+    uint32_t GetTelemetryDropCount();
+}
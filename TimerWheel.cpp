@@ -0,0 +1,235 @@
+#include "TimerWheel.h"
+
+namespace FalseEdgeVR
+{
+    TimerWheel::TimerWheel()
+    {
+        m_slotHeads.assign(SLOT_COUNT, -1);
+    }
+
+    // Handle = generation in the high 16 bits, node index + 1 in the low 16
+    static TimerHandle MakeHandle(int index, std::uint16_t generation)
+    {
+        return ((TimerHandle)generation << 16) | (TimerHandle)(index + 1);
+    }
+
+    const TimerWheel::Node* TimerWheel::Resolve(TimerHandle handle) const
+    {
+        if (handle == 0)
+            return nullptr;
+
+        int index = (int)(handle & 0xFFFF) - 1;
+        if (index < 0 || index >= (int)m_nodes.size())
+            return nullptr;
+
+        const Node& node = m_nodes[index];
+        if (node.slot < 0 || node.generation != (std::uint16_t)(handle >> 16))
+            return nullptr;
+        return &node;
+    }
+
+    int TimerWheel::AllocNode()
+    {
+        if (m_freeHead >= 0)
+        {
+            int index = m_freeHead;
+            m_freeHead = m_nodes[index].next;
+            return index;
+        }
+
+        if (m_nodes.size() >= 0xFFFF)
+            return -1;
+
+        m_nodes.push_back(Node());
+        return (int)m_nodes.size() - 1;
+    }
+
+    void TimerWheel::FreeNode(int index)
+    {
+        Node& node = m_nodes[index];
+        node.callback = nullptr;
+        node.context = nullptr;
+        node.slot = -1;
+        node.prev = -1;
+        node.generation++;
+        if (node.generation == 0)
+            node.generation = 1;
+
+        node.next = m_freeHead;
+        m_freeHead = index;
+    }
+
+    int TimerWheel::SlotFor(std::uint64_t expiry) const
+    {
+        std::uint64_t delta = expiry > m_now ? expiry - m_now : 0;
+
+        if (delta < (1ull << LEVEL0_BITS))
+            return (int)(expiry & (LEVEL0_SLOTS - 1));
+
+        // Coarser wheels: level n slots span 2^(LEVEL0_BITS + (n-1)*LEVEL_BITS) ticks
+        for (int level = 1; level < LEVELS; level++)
+        {
+            int shift = LEVEL0_BITS + level * LEVEL_BITS;
+            if (delta < (1ull << shift) || level == LEVELS - 1)
+            {
+                int slotInLevel = (int)((expiry >> (shift - LEVEL_BITS)) & (LEVEL_SLOTS - 1));
+                return LEVEL0_SLOTS + (level - 1) * LEVEL_SLOTS + slotInLevel;
+            }
+        }
+        return 0;
+    }
+
+    void TimerWheel::Link(int index)
+    {
+        Node& node = m_nodes[index];
+        int slot = SlotFor(node.expiry);
+
+        node.slot = slot;
+        node.prev = -1;
+        node.next = m_slotHeads[slot];
+        if (node.next >= 0)
+            m_nodes[node.next].prev = index;
+        m_slotHeads[slot] = index;
+    }
+
+    void TimerWheel::Unlink(int index)
+    {
+        Node& node = m_nodes[index];
+        if (node.prev >= 0)
+            m_nodes[node.prev].next = node.next;
+        else
+            m_slotHeads[node.slot] = node.next;
+
+        if (node.next >= 0)
+            m_nodes[node.next].prev = node.prev;
+
+        node.prev = -1;
+        node.next = -1;
+    }
+
+    TimerHandle TimerWheel::Schedule(float delaySeconds, TimerCallback callback, void* context)
+    {
+        if (!callback)
+            return 0;
+
+        int index = AllocNode();
+        if (index < 0)
+            return 0;
+
+        std::uint64_t delayTicks = delaySeconds > 0.0f ? (std::uint64_t)(delaySeconds * 1000.0f + 0.5f) : 0;
+        if (delayTicks < 1)
+            delayTicks = 1;
+        if (delayTicks > MAX_DELAY_TICKS)
+            delayTicks = MAX_DELAY_TICKS;
+
+        Node& node = m_nodes[index];
+        node.expiry = m_now + delayTicks;
+        node.callback = callback;
+        node.context = context;
+        Link(index);
+
+        m_pending++;
+        return MakeHandle(index, node.generation);
+    }
+
+    void TimerWheel::Cancel(TimerHandle& handle)
+    {
+        if (Resolve(handle))
+        {
+            int index = (int)(handle & 0xFFFF) - 1;
+            Unlink(index);
+            FreeNode(index);
+            m_pending--;
+        }
+        handle = 0;
+    }
+
+    bool TimerWheel::IsPending(TimerHandle handle) const
+    {
+        return Resolve(handle) != nullptr;
+    }
+
+    float TimerWheel::Remaining(TimerHandle handle) const
+    {
+        const Node* node = Resolve(handle);
+        if (!node)
+            return 0.0f;
+        return (float)(node->expiry - m_now) / 1000.0f;
+    }
+
+    void TimerWheel::Cascade(int level, int slotInLevel)
+    {
+        int slot = LEVEL0_SLOTS + (level - 1) * LEVEL_SLOTS + slotInLevel;
+
+        // Everything here expires within one slot span - relinking drops it to a finer wheel
+        while (m_slotHeads[slot] >= 0)
+        {
+            int index = m_slotHeads[slot];
+            Unlink(index);
+            Link(index);
+        }
+    }
+
+    void TimerWheel::Advance(float deltaSeconds)
+    {
+        if (deltaSeconds <= 0.0f)
+            return;
+
+        m_carry += deltaSeconds * 1000.0f;
+        std::uint64_t ticks = (std::uint64_t)m_carry;
+        m_carry -= (float)ticks;
+
+        // Nothing pending - just move the clock
+        if (m_pending == 0)
+        {
+            m_now += ticks;
+            return;
+        }
+
+        for (std::uint64_t t = 0; t < ticks; t++)
+        {
+            m_now++;
+
+            // When a wheel wraps, pull the next slot of the coarser wheel down
+            int slot0 = (int)(m_now & (LEVEL0_SLOTS - 1));
+            if (slot0 == 0)
+            {
+                for (int level = 1; level < LEVELS; level++)
+                {
+                    int shift = LEVEL0_BITS + (level - 1) * LEVEL_BITS;
+                    int slotInLevel = (int)((m_now >> shift) & (LEVEL_SLOTS - 1));
+                    Cascade(level, slotInLevel);
+                    if (slotInLevel != 0)
+                        break;
+                }
+            }
+
+            // Fire one at a time so callbacks may schedule or cancel freely
+            while (m_slotHeads[slot0] >= 0)
+            {
+                int index = m_slotHeads[slot0];
+                TimerCallback callback = m_nodes[index].callback;
+                void* context = m_nodes[index].context;
+
+                Unlink(index);
+                FreeNode(index);
+                m_pending--;
+
+                callback(context);
+            }
+        }
+    }
+
+    void TimerWheel::Clear()
+    {
+        for (size_t i = 0; i < m_nodes.size(); i++)
+        {
+            if (m_nodes[i].slot >= 0)
+            {
+                Unlink((int)i);
+                FreeNode((int)i);
+            }
+        }
+        m_pending = 0;
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+// ============================================
+// TimerWheel - hierarchical timing wheel on the step clock
+// ============================================
+// One-shot timers that call back when they expire. Time only moves when Advance() is
+// called (once per physics step), so timers follow game time: they stop in menus and
+// never fire between steps.
+//
+// Four wheels of 256/64/64/64 slots at 1 ms resolution cover about 18 hours. A timer
+// goes into the coarsest wheel that still tells its slot apart and is moved down when
+// that slot comes round. Schedule and Cancel are O(1), and each tick only touches
+// the one slot that expires on that tick.
+//
+// Handles carry a generation count, so cancelling a timer that has already fired (or
+// a handle from a cleared wheel) does nothing.
+// Physics-step thread only.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FalseEdgeVR
+{
+    typedef std::uint32_t TimerHandle;          // 0 = no timer
+    typedef void (*TimerCallback)(void* context);
+
+    class TimerWheel
+    {
+    public:
+        TimerWheel();
+
+        // Calls callback(context) once delaySeconds of step time have passed.
+        // Fires on the next tick at the earliest.
+        TimerHandle Schedule(float delaySeconds, TimerCallback callback, void* context);
+
+        // Stops a pending timer. Safe with 0, fired or stale handles.
+        void Cancel(TimerHandle& handle);
+
+        // Whether the timer is still waiting to fire
+        bool IsPending(TimerHandle handle) const;
+
+        // Seconds until the timer fires (0 if it isn't pending)
+        float Remaining(TimerHandle handle) const;
+
+        // Moves the step clock forward and fires every timer that expires on the way
+        void Advance(float deltaSeconds);
+
+        // Drops every pending timer without firing it
+        void Clear();
+
+        // Step clock in seconds
+        double Now() const { return m_now / 1000.0; }
+
+        size_t GetPendingCount() const { return m_pending; }
+
+    private:
+        static const int LEVEL0_BITS = 8;
+        static const int LEVEL_BITS = 6;
+        static const int LEVELS = 4;
+        static const int LEVEL0_SLOTS = 1 << LEVEL0_BITS;
+        static const int LEVEL_SLOTS = 1 << LEVEL_BITS;
+        static const int SLOT_COUNT = LEVEL0_SLOTS + (LEVELS - 1) * LEVEL_SLOTS;
+        static const std::uint64_t MAX_DELAY_TICKS = (1ull << (LEVEL0_BITS + (LEVELS - 1) * LEVEL_BITS)) - 1;
+
+        struct Node
+        {
+            std::uint64_t expiry = 0;           // Tick the timer fires on
+            TimerCallback callback = nullptr;
+            void* context = nullptr;
+            int prev = -1;
+            int next = -1;
+            int slot = -1;                      // -1 = free
+            std::uint16_t generation = 1;
+        };
+
+        int AllocNode();
+        void FreeNode(int index);
+        void Link(int index);                   // Into the slot its expiry maps to
+        void Unlink(int index);
+        void Cascade(int level, int slotInLevel);
+        int SlotFor(std::uint64_t expiry) const;
+        const Node* Resolve(TimerHandle handle) const;
+
+        std::vector<Node> m_nodes;
+        std::vector<int> m_slotHeads;           // First node per slot, -1 if empty
+        int m_freeHead = -1;
+        size_t m_pending = 0;
+
+        std::uint64_t m_now = 0;                // Current tick (ms)
+        float m_carry = 0.0f;                   // Sub-tick remainder from Advance
+    };
+}
@@ -3,9 +3,17 @@
 #include "WeaponGeometry.h"
 #include "ShieldCollision.h"
 #include "ActivateHook.h"
+#include "FrameContext.h"
+#include "NodeCache.h"
+#include "FrameScheduler.h"
+#include "StepClock.h"
+#include "GameEventQueue.h"
+#include "AsyncLog.h"
+#include "LogChannel.h"
+#include "TelemetryRecorder.h"
+#include "ScopedTimer.h"
 #include "skse64/GameReferences.h"
 #include "skse64/GameVR.h"
-#include <chrono>
 
 namespace FalseEdgeVR
 {
@@ -27,7 +35,7 @@ namespace FalseEdgeVR
         if (m_initialized)
             return;
 
-        _MESSAGE("VRInputHandler: Initializing...");
+        ALOG_INFO("VRInputHandler: Initializing...");
 
         // Register HIGGS callbacks if HIGGS is available
         RegisterHiggsCallbacks();
@@ -35,8 +43,11 @@ namespace FalseEdgeVR
         // Trigger button tracking initialization
         RegisterTriggerCallback();
 
+        // Per-step subsystems
+        RegisterFrameTasks();
+
         m_initialized = true;
-        _MESSAGE("VRInputHandler: Initialized successfully");
+        ALOG_INFO("VRInputHandler: Initialized successfully");
     }
 
     void VRInputHandler::RegisterHiggsCallbacks()
@@ -46,11 +57,11 @@ namespace FalseEdgeVR
 
         if (!higgsInterface)
         {
-            _MESSAGE("VRInputHandler: HIGGS interface not available, skipping callback registration");
+            ALOG_WARN("VRInputHandler: HIGGS interface not available, skipping callback registration");
             return;
         }
 
-        _MESSAGE("VRInputHandler: Registering HIGGS callbacks...");
+        ALOG_INFO("VRInputHandler: Registering HIGGS callbacks...");
 
         // Register grab/drop callbacks
         higgsInterface->AddGrabbedCallback(OnGrabbed);
@@ -66,9 +77,14 @@ namespace FalseEdgeVR
         
         // Register pre-physics step callback for per-frame updates
         higgsInterface->AddPrePhysicsStepCallback(OnPrePhysicsStep);
+        
+        // Runs once VRIK and HIGGS have placed the hands for this frame - stamps the hand
+        // placement time, and samples blade/shield poses when GeometryPhase=1
+        higgsInterface->AddPostVrikPostHiggsCallback(OnPostVrikPostHiggs);
+        m_postVrikCallbackRegistered = true;
 
         m_callbacksRegistered = true;
-        _MESSAGE("VRInputHandler: HIGGS callbacks registered successfully");
+        ALOG_INFO("VRInputHandler: HIGGS callbacks registered successfully");
     }
 
     void VRInputHandler::UpdateGrabListening()
@@ -78,12 +94,12 @@ namespace FalseEdgeVR
     if (shouldListen && !m_isListening)
         {
             m_isListening = true;
-            _MESSAGE("VRInputHandler: Started listening for grab events (weapon or shield equipped)");
+            ALOG_INFO("VRInputHandler: Started listening for grab events (weapon or shield equipped)");
      }
    else if (!shouldListen && m_isListening)
    {
      m_isListening = false;
-            _MESSAGE("VRInputHandler: Stopped listening for grab events (no weapons or shields equipped)");
+            ALOG_INFO("VRInputHandler: Stopped listening for grab events (no weapons or shields equipped)");
         }
     }
 
@@ -116,86 +132,323 @@ namespace FalseEdgeVR
     
     void VRInputHandler::OnPrePhysicsStep(void* world)
     {
-        static int frameCount = 0;
-        static bool loggedOnce = false;
-     
+        ScopedTimer stepTimer(TimedSection::PrePhysicsStep);
         VRInputHandler* handler = GetSingleton();
   
-        // Calculate delta time
-        static auto lastTime = std::chrono::high_resolution_clock::now();
-  auto currentTime = std::chrono::high_resolution_clock::now();
-        float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
-      lastTime = currentTime;
+        // Calculate delta time from the installed step clock (real time unless a harness swapped it)
+        double currentTime = GetStepClock()->Now();
+        float deltaTime = handler->m_hasLastStepTime ? (float)(currentTime - handler->m_lastStepTime) : kMinStepInterval;
+        handler->m_lastStepTime = currentTime;
+        handler->m_hasLastStepTime = true;
         
         // Clamp delta time to reasonable values
-  if (deltaTime > 0.1f) deltaTime = 0.1f;
-        if (deltaTime < 0.0001f) deltaTime = 0.0001f;
-        
-        frameCount++;
+  if (deltaTime > kMaxStepInterval) deltaTime = kMaxStepInterval;
+        if (deltaTime < kMinStepInterval) deltaTime = kMinStepInterval;
         
         // Log once to confirm callback is working
-     if (!loggedOnce)
-     {
-    _MESSAGE("VRInputHandler::OnPrePhysicsStep - Callback is firing! Frame: %d", frameCount);
- loggedOnce = true;
-}
+    ALOG_CHANNEL(DEBUG, LogChannel::PrePhysicsStepStarted, "VRInputHandler::OnPrePhysicsStep - Callback is firing!");
     
+        // Apply everything the game/HIGGS threads queued since the last step
+        handler->DrainGameEvents();
+        
         // Poll trigger button state each frame
    PollTriggerState();
+        
+        // One snapshot of equipment, grabs, handedness and triggers shared by everything below
+        const FrameContext& frame = BeginFrameContext(deltaTime);
+        
+        // Cached skeleton nodes stay valid until the 3D or the equipment changes
+        NodeCache::GetSingleton()->Validate(frame);
+    
+  // Log periodically to confirm still running
+   ALOG_CHANNEL(DEBUG, LogChannel::PrePhysicsStepHeartbeat, "VRInputHandler::OnPrePhysicsStep - Frame %u, IsListening: %s", 
+            frame.frameNumber, handler->IsListening() ? "YES" : "NO");
+     
+        // Config may have been reloaded since the last step
+        handler->m_scheduler.SetRate(handler->m_combatTrackingTask, combatTrackingRate);
+        handler->m_scheduler.SetReportInterval(schedulerReportInterval);
+        
+        // Timeouts, timers, auto-equip and combat tracking
+        handler->m_scheduler.Run(frame);
+        
+        // Geometry and collisions - here unless the post-VRIK/post-HIGGS phase samples them
+        if (geometryPhase != 1 || !handler->m_postVrikCallbackRegistered)
+            handler->RunPoseTasks(frame);
+    }
+    
+    void VRInputHandler::OnPostVrikPostHiggs()
+    {
+        VRInputHandler* handler = GetSingleton();
+        
+        // Hands are where the player sees them from here until the next frame
+        double currentTime = GetStepClock()->Now();
+        handler->m_lastHandPlacementTime = currentTime;
+        handler->m_hasHandPlacementTime = true;
+        
+        if (geometryPhase != 1)
+            return;
+        
+        ScopedTimer poseTimer(TimedSection::PostVrikPostHiggs);
+        
+        // Velocities come from the interval between pose samples, i.e. between frames
+        float deltaTime = handler->m_hasLastPosePhaseTime ? (float)(currentTime - handler->m_lastPosePhaseTime) : kMinStepInterval;
+        handler->m_lastPosePhaseTime = currentTime;
+        handler->m_hasLastPosePhaseTime = true;
+        if (deltaTime > kMaxStepInterval) deltaTime = kMaxStepInterval;
+        if (deltaTime < kMinStepInterval) deltaTime = kMinStepInterval;
+        
+        // Fresh snapshot - equipment and grabs as of this frame's hand placement, same frame number
+        const FrameContext& frame = RefreshFrameContext(deltaTime);
+        NodeCache::GetSingleton()->Validate(frame);
+        
+        handler->RunPoseTasks(frame);
+    }
+    
+    static void CopyPoint(float* out, const NiPoint3& point)
+    {
+        out[0] = point.x;
+        out[1] = point.y;
+        out[2] = point.z;
+    }
+    
+    static double s_telemetryStartTime = 0.0;
     
-  // Log every 500 frames to confirm still running
-        if (frameCount % 500 == 0)
+    // One TelemetryRecord per pose step while TelemetryRecording=1 (same thread as the trackers)
+    static void RecordStepTelemetry(const FrameContext& frame)
+    {
+        if (!telemetryRecording)
         {
-   _MESSAGE("VRInputHandler::OnPrePhysicsStep - Frame %d, IsListening: %s", 
-            frameCount, handler->IsListening() ? "YES" : "NO");
+            // Switched off by a config reload - hand over whatever is buffered
+            FlushTelemetry();
+            return;
         }
-     
-  // Update cooldown timers
-        if (handler->m_leftHandOnCooldown)
-      {
- handler->m_leftHandCooldownTimer += deltaTime;
-          if (handler->m_leftHandCooldownTimer >= bladeReequipCooldown)
-     {
-                handler->m_leftHandOnCooldown = false;
-       handler->m_leftHandCooldownTimer = 0.0f;
-        _MESSAGE("VRInputHandler: Left hand cooldown expired, can trigger again");
+        
+        if (!IsTelemetryStarted())
+        {
+            s_telemetryStartTime = GetStepClock()->Now();
+            std::string path = GetRuntimeDirectory() + "Data\\SKSE\\Plugins\\FalseEdgeVR_Telemetry.bin";
+            StartTelemetry(path.c_str());
+        }
+        
+        WeaponGeometryTracker* weapons = WeaponGeometryTracker::GetSingleton();
+        ShieldCollisionTracker* shields = ShieldCollisionTracker::GetSingleton();
+        VRInputHandler* handler = VRInputHandler::GetSingleton();
+        EquipManager* equipManager = EquipManager::GetSingleton();
+        
+        TelemetryRecord record = {};
+        record.time = (float)(GetStepClock()->Now() - s_telemetryStartTime);
+        record.frameNumber = frame.frameNumber;
+        record.deltaTime = frame.deltaTime;
+        
+        UInt32 flags = 0;
+        const WeaponGeometryState& geometry = weapons->GetGeometryState();
+        if (geometry.leftHand.isValid)
+        {
+            flags |= kTelemetry_LeftBladeValid;
+            if (geometry.leftHand.isDagger) flags |= kTelemetry_LeftIsDagger;
+            CopyPoint(record.leftBase, geometry.leftHand.basePosition);
+            CopyPoint(record.leftTip, geometry.leftHand.tipPosition);
+            CopyPoint(record.leftBaseVelocity, geometry.leftHand.baseVelocity);
+            CopyPoint(record.leftTipVelocity, geometry.leftHand.tipVelocity);
+        }
+        if (geometry.rightHand.isValid)
+        {
+            flags |= kTelemetry_RightBladeValid;
+            if (geometry.rightHand.isDagger) flags |= kTelemetry_RightIsDagger;
+            CopyPoint(record.rightBase, geometry.rightHand.basePosition);
+            CopyPoint(record.rightTip, geometry.rightHand.tipPosition);
+            CopyPoint(record.rightBaseVelocity, geometry.rightHand.baseVelocity);
+            CopyPoint(record.rightTipVelocity, geometry.rightHand.tipVelocity);
+        }
+        
+        if (shields->HasShieldEquipped())
+        {
+            bool shieldInLeftHand = shields->IsShieldInLeftHand();
+            const ShieldGeometry& shield = shields->GetShieldGeometry(shieldInLeftHand);
+            if (shieldInLeftHand) flags |= kTelemetry_ShieldInLeftHand;
+            if (shield.isValid)
+            {
+                flags |= kTelemetry_ShieldValid;
+                CopyPoint(record.shieldCenter, shield.centerPosition);
+                CopyPoint(record.shieldNormal, shield.normal);
+                CopyPoint(record.shieldVelocity, shield.velocity);
+            }
+        }
+        
+        const BladeCollisionResult& blades = weapons->GetStepCollisionResult();
+        record.bladePairTest = (UInt8)weapons->GetStepPairTest();
+        record.bladeDistance = blades.closestDistance;
+        record.bladeClosingVelocity = blades.closingVelocity;
+        record.bladeTimeToCollision = blades.timeToCollision;
+        if (blades.isSweptImpact) flags |= kTelemetry_BladeSweptImpact;
+        if (blades.tunneledLastStep) flags |= kTelemetry_BladeTunneled;
+        
+        const ShieldCollisionResult& shieldHit = shields->GetStepCollisionResult();
+        record.shieldPairTest = (UInt8)shields->GetStepPairTest();
+        record.shieldDistance = shieldHit.closestDistance;
+        record.shieldClosingVelocity = shieldHit.closingVelocity;
+        record.shieldTimeToCollision = shieldHit.timeToCollision;
+        if (shieldHit.isSweptImpact) flags |= kTelemetry_ShieldSweptImpact;
+        
+        // Collision state machine after this step's decisions
+        if (weapons->AreBladesInContact()) flags |= kTelemetry_BladesInContact;
+        if (weapons->IsCollisionImminent()) flags |= kTelemetry_BladesImminent;
+        if (shields->IsWeaponContactingShield()) flags |= kTelemetry_ShieldContact;
+        if (shields->IsCollisionImminent()) flags |= kTelemetry_ShieldImminent;
+        if (handler->IsHiggsCollisionActive()) flags |= kTelemetry_HiggsCollisionActive;
+        if (handler->IsShieldCollisionActive()) flags |= kTelemetry_ShieldCollisionActive;
+        if (handler->IsHandOnCooldown(true)) flags |= kTelemetry_LeftOnCooldown;
+        if (handler->IsHandOnCooldown(false)) flags |= kTelemetry_RightOnCooldown;
+        if (equipManager->HasPendingReequip(true)) flags |= kTelemetry_PendingReequipLeft;
+        if (equipManager->HasPendingReequip(false)) flags |= kTelemetry_PendingReequipRight;
+        if (handler->IsPlayerInCombat()) flags |= kTelemetry_InCombat;
+        if (handler->IsInCloseCombatMode()) flags |= kTelemetry_CloseCombatMode;
+        if (frame.leftHandedMode) flags |= kTelemetry_LeftHandedMode;
+        record.flags = flags;
+        
+        RecordTelemetry(record);
     }
-  }
- if (handler->m_rightHandOnCooldown)
+    
+    void VRInputHandler::RunPoseTasks(const FrameContext& frame)
     {
-       handler->m_rightHandCooldownTimer += deltaTime;
-if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
-      {
-        handler->m_rightHandOnCooldown = false;
-        handler->m_rightHandCooldownTimer = 0.0f;
-      _MESSAGE("VRInputHandler: Right hand cooldown expired, can trigger again");
-      }
-      }
-
-        // Check for HIGGS collision timeout (grabbed LEFT weapon separating from equipped RIGHT weapon)
-  handler->CheckCollisionTimeout(deltaTime);
-      
-     // Check for shield collision timeout (grabbed RIGHT weapon separating from equipped shield)
-    handler->CheckShieldCollisionTimeout(deltaTime);
-     
-        // Check for pending re-equip after activation (both hands)
-        handler->CheckPendingReequip(deltaTime);
-      
-        // Check for auto-equip of grabbed weapons (player grabbed weapon while other hand has weapon)
-        handler->CheckAutoEquipGrabbedWeapon(deltaTime);
-     
-    // Update combat tracking (in combat, closest target distance)
-   handler->UpdateCombatTracking();
-   
-        // Update shield bash tracking
-      handler->UpdateShieldBashTracking(deltaTime);
-  
-     // ALWAYS update weapon geometry and shield collision tracking
-        // These trackers handle their own equipment checks internally
-    UpdateWeaponGeometry(deltaTime);
-        UpdateShieldCollision(deltaTime);
+        m_poseScheduler.SetReportInterval(schedulerReportInterval);
+        m_poseScheduler.Run(frame);
+        RecordPoseLatency();
+        RecordStepTelemetry(frame);
     }
     
+    void VRInputHandler::RecordPoseLatency()
+    {
+        if (!m_hasHandPlacementTime)
+            return;
+        
+        double now = GetStepClock()->Now();
+        double latencyMs = (now - m_lastHandPlacementTime) * 1000.0;
+        m_poseLatencyTotalMs += latencyMs;
+        if (latencyMs > m_poseLatencyMaxMs)
+            m_poseLatencyMaxMs = latencyMs;
+        m_poseLatencySamples++;
+        
+        if (m_poseLatencySamples == 1)
+            m_poseLatencyWindowStart = now;
+        
+        if (schedulerReportInterval > 0.0f && now - m_poseLatencyWindowStart >= schedulerReportInterval)
+        {
+            ALOG_INFO("VRInputHandler: Pose-to-decision latency (%s): avg=%.3f ms  max=%.3f ms  samples=%u",
+                (geometryPhase == 1 && m_postVrikCallbackRegistered) ? "post-VRIK/post-HIGGS" : "pre-physics step",
+                m_poseLatencyTotalMs / m_poseLatencySamples, m_poseLatencyMaxMs, m_poseLatencySamples);
+            m_poseLatencyTotalMs = 0.0;
+            m_poseLatencyMaxMs = 0.0;
+            m_poseLatencySamples = 0;
+        }
+    }
+    
+
+    // ============================================
+    // Frame Tasks
+    // ============================================
+    // Thin adapters from the scheduler's task signature to the handler and trackers
+
+    static void TaskTimers(const FrameContext& frame, float elapsed)
+    {
+        // Cooldowns, shield bash window/lockout
+        VRInputHandler::GetSingleton()->AdvanceTimers(elapsed);
+    }
+
+    static void TaskReequipDelays(const FrameContext& frame, float elapsed)
+    {
+        // Re-equips scheduled by the collision timeouts
+        VRInputHandler::GetSingleton()->AdvanceReequipTimers(elapsed);
+    }
+
+    static void TaskCollisionTimeout(const FrameContext& frame, float elapsed)
+    {
+        // Grabbed LEFT weapon separating from equipped RIGHT weapon
+        VRInputHandler::GetSingleton()->CheckCollisionTimeout(frame);
+    }
+
+    static void TaskShieldCollisionTimeout(const FrameContext& frame, float elapsed)
+    {
+        // Grabbed RIGHT weapon separating from equipped shield
+        VRInputHandler::GetSingleton()->CheckShieldCollisionTimeout(frame);
+    }
+
+    static void TaskAutoEquip(const FrameContext& frame, float elapsed)
+    {
+        VRInputHandler::GetSingleton()->CheckAutoEquipGrabbedWeapon(frame);
+    }
+
+    static void TaskCombatTracking(const FrameContext& frame, float elapsed)
+    {
+        VRInputHandler::GetSingleton()->UpdateCombatTracking(elapsed);
+    }
+
+    static void TaskWeaponGeometry(const FrameContext& frame, float elapsed)
+    {
+        // The trackers handle their own equipment checks internally
+        UpdateWeaponGeometry(frame);
+    }
+
+    static void TaskShieldCollision(const FrameContext& frame, float elapsed)
+    {
+        UpdateShieldCollision(frame);
+    }
+
+    // Pose scheduler report - how much of the collision pipeline the culling tests saved
+    static void ReportCollisionPipeline()
+    {
+        WeaponGeometryTracker* weapons = WeaponGeometryTracker::GetSingleton();
+        ShieldCollisionTracker* shields = ShieldCollisionTracker::GetSingleton();
+
+        ALOG_INFO("PoseScheduler:   blades: narrowphase run=%u skipped=%u  broadphase tested=%u rejected=%u",
+            weapons->GetNarrowphaseRunCount(), weapons->GetNarrowphaseSkipCount(),
+            weapons->GetBroadphaseTestCount(), weapons->GetBroadphaseRejectCount());
+        ALOG_INFO("PoseScheduler:   shield: broadphase tested=%u rejected=%u",
+            shields->GetBroadphaseTestCount(), shields->GetBroadphaseRejectCount());
+
+        weapons->ResetPipelineStats();
+        shields->ResetPipelineStats();
+    }
+
+    void VRInputHandler::RegisterFrameTasks()
+    {
+        // Rate 0 = every physics step. Budgets are per run, in milliseconds.
+        int collisionTimeout = m_scheduler.AddTask("CollisionTimeout", TaskCollisionTimeout, 0.0f, 0.10f);
+        int shieldTimeout = m_scheduler.AddTask("ShieldCollisionTimeout", TaskShieldCollisionTimeout, 0.0f, 0.10f);
+        int timers = m_scheduler.AddTask("Timers", TaskTimers, 0.0f, 0.05f);
+        int reequipDelays = m_scheduler.AddTask("ReequipDelays", TaskReequipDelays, 0.0f, 0.05f);
+        int autoEquip = m_scheduler.AddTask("AutoEquip", TaskAutoEquip, 0.0f, 0.10f);
+        m_combatTrackingTask = m_scheduler.AddTask("CombatTracking", TaskCombatTracking, combatTrackingRate, 0.10f);
+
+        // Pose-driven tasks - run after m_scheduler in the pre-physics step, or on their own
+        // once VRIK/HIGGS have placed the hands (GeometryPhase=1)
+        int weaponGeometry = m_poseScheduler.AddTask("WeaponGeometry", TaskWeaponGeometry, 0.0f, 0.50f);
+        int shieldCollision = m_poseScheduler.AddTask("ShieldCollision", TaskShieldCollision, 0.0f, 0.50f);
+
+        // Cooldowns expire before the timeouts look at them, as they did when they were
+        // per-step counters. The timeouts schedule the re-equip delays - advance those after
+        // them so a delay shorter than a step still fires in the step that scheduled it.
+        m_scheduler.AddDependency(collisionTimeout, timers);
+        m_scheduler.AddDependency(shieldTimeout, timers);
+        m_scheduler.AddDependency(reequipDelays, collisionTimeout);
+        m_scheduler.AddDependency(reequipDelays, shieldTimeout);
+        m_scheduler.AddDependency(autoEquip, reequipDelays);
+
+        // Entering close combat force-equips whatever auto-equip is holding
+        m_scheduler.AddDependency(m_combatTrackingTask, autoEquip);
+
+        // Weapon-vs-shield reads this step's blade geometry
+        m_poseScheduler.AddDependency(shieldCollision, weaponGeometry);
+
+        // The schedulers' run timing also feeds these latency histograms
+        m_scheduler.SetTimedSection(m_combatTrackingTask, TimedSection::CombatTracking);
+        m_poseScheduler.SetTimedSection(weaponGeometry, TimedSection::WeaponGeometry);
+        m_poseScheduler.SetTimedSection(shieldCollision, TimedSection::ShieldCollision);
+
+        m_scheduler.SetReportInterval(schedulerReportInterval);
+        m_poseScheduler.SetReportInterval(schedulerReportInterval);
+        m_poseScheduler.SetReportCallback(ReportCollisionPipeline);
+    }
 
     void VRInputHandler::PauseTracking(bool pause)
     {
@@ -203,18 +456,18 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
       // This function is kept for compatibility but does nothing
         if (pause)
         {
-            _MESSAGE("VRInputHandler: Menu opened (tracking continues)");
+            ALOG_INFO("VRInputHandler: Menu opened (tracking continues)");
       }
         else
      {
-     _MESSAGE("VRInputHandler: Menu closed");
+     ALOG_INFO("VRInputHandler: Menu closed");
        // Force equipment state refresh when menu closes
  EquipManager::GetSingleton()->UpdateEquipmentState();
             UpdateGrabListening();
   }
     }
 
-    void VRInputHandler::UpdateCombatTracking()
+    void VRInputHandler::UpdateCombatTracking(float elapsed)
     {
         PlayerCharacter* player = *g_thePlayer;
         if (!player)
@@ -233,12 +486,12 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
      // Log combat state changes
         if (m_isInCombat && !wasInCombat)
       {
-     _MESSAGE("VRInputHandler: === PLAYER ENTERED COMBAT ===");
-          _MESSAGE("VRInputHandler:   currentCombatTarget handle: %08X", player->currentCombatTarget);
+     ALOG_INFO("VRInputHandler: === PLAYER ENTERED COMBAT ===");
+          ALOG_INFO("VRInputHandler:   currentCombatTarget handle: %08X", player->currentCombatTarget);
         }
    else if (!m_isInCombat && wasInCombat)
   {
-            _MESSAGE("VRInputHandler: === PLAYER LEFT COMBAT ===");
+            ALOG_INFO("VRInputHandler: === PLAYER LEFT COMBAT ===");
     m_closestTargetDistance = 9999.0f;
           m_closestTargetHandle = 0;
        
@@ -246,7 +499,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
   if (m_closeCombatMode)
             {
    m_closeCombatMode = false;
-     _MESSAGE("VRInputHandler: Exited CLOSE COMBAT MODE (left combat)");
+     ALOG_INFO("VRInputHandler: Exited CLOSE COMBAT MODE (left combat)");
             }
         }
    
@@ -280,13 +533,8 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
         else
             {
           // No combat target - log this periodically for debugging
-         static int noTargetLogCounter = 0;
-  noTargetLogCounter++;
-          if (noTargetLogCounter % 200 == 1)
-        {
-      _MESSAGE("VRInputHandler: In combat but NO COMBAT TARGET! Handle: %08X, InvalidHandle: %08X",
+      ALOG_CHANNEL(DEBUG, LogChannel::CombatNoTarget, "VRInputHandler: In combat but NO COMBAT TARGET! Handle: %08X, InvalidHandle: %08X",
     combatTargetHandle, *g_invalidRefHandle);
-    }
             }
     
    // ============================================
@@ -300,10 +548,10 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
             if (m_closestTargetDistance <= closeCombatEnterDistance)
         {
          m_closeCombatMode = true;
-    _MESSAGE("VRInputHandler: === ENTERED CLOSE COMBAT MODE ===");
-         _MESSAGE("VRInputHandler:   Target distance: %.1f units (threshold: %.1f)", 
+    ALOG_INFO("VRInputHandler: === ENTERED CLOSE COMBAT MODE ===");
+         ALOG_INFO("VRInputHandler:   Target distance: %.1f units (threshold: %.1f)", 
     m_closestTargetDistance, closeCombatEnterDistance);
- _MESSAGE("VRInputHandler:   Collision avoidance DISABLED - auto-equipping any grabbed weapons");
+ ALOG_INFO("VRInputHandler:   Collision avoidance DISABLED - auto-equipping any grabbed weapons");
           
    // Auto-equip any grabbed weapons immediately
     ForceEquipGrabbedWeapons();
@@ -315,15 +563,15 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
  if (m_closestTargetDistance > closeCombatExitDistance)
    {
        m_closeCombatMode = false;
-        _MESSAGE("VRInputHandler: === EXITED CLOSE COMBAT MODE ===");
-             _MESSAGE("VRInputHandler:   Target distance: %.1f units (threshold: %.1f)", 
+        ALOG_INFO("VRInputHandler: === EXITED CLOSE COMBAT MODE ===");
+             ALOG_INFO("VRInputHandler:   Target distance: %.1f units (threshold: %.1f)", 
          m_closestTargetDistance, closeCombatExitDistance);
-      _MESSAGE("VRInputHandler:   Collision avoidance RE-ENABLED");
+      ALOG_INFO("VRInputHandler:   Collision avoidance RE-ENABLED");
    }
             }
        
        // Log combat status periodically (every 2 seconds)
-   m_combatLogTimer += 0.011f; // Approximate frame time at 90fps
+   m_combatLogTimer += elapsed;
   if (m_combatLogTimer >= 2.0f)
             {
          m_combatLogTimer = 0.0f;
@@ -334,7 +582,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
  if (LookupREFRByHandle(m_closestTargetHandle, targetRefr) && targetRefr)
         {
        const char* targetName = CALL_MEMBER_FN(targetRefr.get(), GetReferenceName)();
-          _MESSAGE("VRInputHandler: COMBAT STATUS - Target: %s, Distance: %.1f units (%.1f m), CloseCombat: %s", 
+          ALOG_INFO("VRInputHandler: COMBAT STATUS - Target: %s, Distance: %.1f units (%.1f m), CloseCombat: %s", 
  targetName ? targetName : "Unknown",
            m_closestTargetDistance,
       m_closestTargetDistance / 70.0f,
@@ -343,7 +591,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
    }
        else
                 {
-         _MESSAGE("VRInputHandler: COMBAT STATUS - In combat but no specific target, CloseCombat: %s",
+         ALOG_INFO("VRInputHandler: COMBAT STATUS - In combat but no specific target, CloseCombat: %s",
         m_closeCombatMode ? "YES" : "NO");
       }
             }
@@ -354,7 +602,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
       if (m_closeCombatMode)
             {
     m_closeCombatMode = false;
-      _MESSAGE("VRInputHandler: Exited CLOSE COMBAT MODE (not in combat)");
+      ALOG_INFO("VRInputHandler: Exited CLOSE COMBAT MODE (not in combat)");
       }
     }
     }
@@ -374,7 +622,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
        TESObjectREFR* grabbed = higgsInterface->GetGrabbedObject(true);
             if (grabbed == m_autoEquipWeaponLeft && grabbed->baseForm)
             {
-                _MESSAGE("VRInputHandler: Close combat - force equipping LEFT grabbed weapon");
+                ALOG_INFO("VRInputHandler: Close combat - force equipping LEFT grabbed weapon");
        
      // Suppress pickup sound during internal re-equip
      EquipManager::s_suppressPickupSound = true;
@@ -422,7 +670,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
          }
 
        EquipManager::s_suppressDrawSound = false;
-       _MESSAGE("VRInputHandler: Force equipped weapon to %s game hand", isLeftGameHand ? "LEFT" : "RIGHT");
+       ALOG_INFO("VRInputHandler: Force equipped weapon to %s game hand", isLeftGameHand ? "LEFT" : "RIGHT");
           }
  }
          
@@ -438,7 +686,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
             TESObjectREFR* grabbed = higgsInterface->GetGrabbedObject(false);
             if (grabbed == m_autoEquipWeaponRight && grabbed->baseForm)
        {
-                _MESSAGE("VRInputHandler: Close combat - force equipping RIGHT grabbed weapon");
+                ALOG_INFO("VRInputHandler: Close combat - force equipping RIGHT grabbed weapon");
           
   // Suppress pickup sound during internal re-equip
      EquipManager::s_suppressPickupSound = true;
@@ -470,7 +718,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
        weap->enchantable.enchantment = cachedEnchant;
    }
        EquipManager::s_suppressDrawSound = false;
-                 _MESSAGE("VRInputHandler: Force equipped weapon to %s game hand", isLeftGameHand ? "LEFT" : "RIGHT");
+                 ALOG_INFO("VRInputHandler: Force equipped weapon to %s game hand", isLeftGameHand ? "LEFT" : "RIGHT");
           }
 }
          
@@ -490,7 +738,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
             TESObjectREFR* grabbed = higgsInterface->GetGrabbedObject(offHandVRControllerIsLeft);
             if (grabbed == bladeDropped && grabbed->baseForm)
             {
-                _MESSAGE("VRInputHandler: Close combat - force equipping %s collision-avoidance weapon", offHandIsLeft ? "LEFT" : "RIGHT");
+                ALOG_INFO("VRInputHandler: Close combat - force equipping %s collision-avoidance weapon", offHandIsLeft ? "LEFT" : "RIGHT");
 
                 // Suppress pickup sound during internal re-equip
                 EquipManager::s_suppressPickupSound = true;
@@ -511,7 +759,7 @@ if (handler->m_rightHandCooldownTimer >= shieldReequipCooldown)
                 EquipManager::GetSingleton()->ClearDroppedWeaponRef(offHandIsLeft);
                 EquipManager::GetSingleton()->ClearPendingReequip(offHandIsLeft);
                 m_higgsCollisionActive = false;
-                m_pendingReequip = false;
+                CancelPendingReequip();
             }
         }
         
@@ -524,7 +772,7 @@ if (shieldDropped && higgsInterface)
     TESObjectREFR* grabbed = higgsInterface->GetGrabbedObject(weaponVRControllerIsLeft);
     if (grabbed == shieldDropped && grabbed->baseForm)
     {
-        _MESSAGE("VRInputHandler: Close combat - force equipping %s collision-avoidance weapon", weaponHandIsLeft ? "LEFT" : "RIGHT");
+        ALOG_INFO("VRInputHandler: Close combat - force equipping %s collision-avoidance weapon", weaponHandIsLeft ? "LEFT" : "RIGHT");
 
         // Suppress pickup sound during internal re-equip
         EquipManager::s_suppressPickupSound = true;
@@ -545,7 +793,7 @@ if (shieldDropped && higgsInterface)
         EquipManager::GetSingleton()->ClearDroppedWeaponRef(weaponHandIsLeft);
         EquipManager::GetSingleton()->ClearPendingReequip(weaponHandIsLeft);
         m_shieldCollisionActive = false;
-        m_pendingReequipRight = false;
+        CancelPendingReequipRight();
     }
 }
     }
@@ -562,39 +810,45 @@ if (shieldDropped && higgsInterface)
         // Ignore if lockout is active
      if (m_shieldBashLockoutActive)
         {
-       _MESSAGE("VRInputHandler: Shield bash detected but LOCKOUT is active (%.0f sec remaining)",
-         shieldBashLockoutDuration - m_shieldBashLockoutTimer);
+       ALOG_INFO("VRInputHandler: Shield bash detected but LOCKOUT is active (%.0f sec remaining)",
+         m_timers.Remaining(m_shieldBashLockoutTimer));
   return;
         }
   
         // If this is the first bash, start the window timer
         if (m_shieldBashCount == 0)
      {
-            m_shieldBashWindowTimer = 0.0f;
+            m_timers.Cancel(m_shieldBashWindowTimer);
+            m_shieldBashWindowStart = m_timers.Now();
+            m_shieldBashWindowTimer = m_timers.Schedule(shieldBashWindow, OnShieldBashWindowExpired, this);
         }
   
+        float windowElapsed = (float)(m_timers.Now() - m_shieldBashWindowStart);
         m_shieldBashCount++;
-        _MESSAGE("VRInputHandler: === SHIELD BASH DETECTED === Count: %d/%d (Window: %.1f/%.1f sec)",
-            m_shieldBashCount, shieldBashThreshold, m_shieldBashWindowTimer, shieldBashWindow);
+        ALOG_INFO("VRInputHandler: === SHIELD BASH DETECTED === Count: %d/%d (Window: %.1f/%.1f sec)",
+            m_shieldBashCount, shieldBashThreshold, windowElapsed, shieldBashWindow);
    
      // Check if threshold reached
         if (m_shieldBashCount >= shieldBashThreshold)
  {
-            _MESSAGE("VRInputHandler: *** SHIELD BASH THRESHOLD REACHED *** %d bashes in %.1f seconds!",
-         shieldBashThreshold, m_shieldBashWindowTimer);
-      _MESSAGE("VRInputHandler: *** LOCKOUT ACTIVATED *** Duration: %.0f seconds",
+            ALOG_INFO("VRInputHandler: *** SHIELD BASH THRESHOLD REACHED *** %d bashes in %.1f seconds!",
+         shieldBashThreshold, windowElapsed);
+      ALOG_INFO("VRInputHandler: *** LOCKOUT ACTIVATED *** Duration: %.0f seconds",
       shieldBashLockoutDuration);
      
             // Cast spell on player (Skyrim.esm 0x000AA026)
           const UInt32 SHIELD_BASH_SPELL_FORM_ID = 0x000AA026;
-   _MESSAGE("VRInputHandler: Casting shield bash spell %08X on player", SHIELD_BASH_SPELL_FORM_ID);
+   ALOG_INFO("VRInputHandler: Casting shield bash spell %08X on player", SHIELD_BASH_SPELL_FORM_ID);
   CastSpellOnPlayer(SHIELD_BASH_SPELL_FORM_ID);
 
       // Activate lockout
             m_shieldBashLockoutActive = true;
-         m_shieldBashLockoutTimer = 0.0f;
             m_shieldBashCount = 0;
-     m_shieldBashWindowTimer = 0.0f;
+            m_timers.Cancel(m_shieldBashWindowTimer);
+            m_timers.Cancel(m_shieldBashLockoutTimer);
+            m_timers.Cancel(m_shieldBashLockoutLogTimer);
+            m_shieldBashLockoutTimer = m_timers.Schedule(shieldBashLockoutDuration, OnShieldBashLockoutExpired, this);
+            m_shieldBashLockoutLogTimer = m_timers.Schedule(30.0f, OnShieldBashLockoutLog, this);
         }
     }
 
@@ -604,51 +858,170 @@ if (shieldDropped && higgsInterface)
         // Currently not used
     }
 
-    void VRInputHandler::UpdateShieldBashTracking(float deltaTime)
+    void VRInputHandler::OnShieldBashWindowExpired(void* context)
     {
-        // Update lockout timer if active
-        if (m_shieldBashLockoutActive)
-      {
-     m_shieldBashLockoutTimer += deltaTime;
-  
-        // Log progress every 30 seconds
-            static float lockoutLogTimer = 0.0f;
-   lockoutLogTimer += deltaTime;
-     if (lockoutLogTimer >= 30.0f)
-         {
-         lockoutLogTimer = 0.0f;
-      float remaining = shieldBashLockoutDuration - m_shieldBashLockoutTimer;
-       _MESSAGE("VRInputHandler: Shield bash lockout: %.0f sec remaining (%.0f sec elapsed)",
-   remaining, m_shieldBashLockoutTimer);
-  }
-            
-  if (m_shieldBashLockoutTimer >= shieldBashLockoutDuration)
-  {
-   m_shieldBashLockoutActive = false;
-        m_shieldBashLockoutTimer = 0.0f;
-      lockoutLogTimer = 0.0f;
-   _MESSAGE("VRInputHandler: *** SHIELD BASH LOCKOUT EXPIRED *** Bash tracking resumed");
- }
-       return;
-        }
-     
-   // Update window timer if we have bashes counted
-        if (m_shieldBashCount > 0)
-   {
-     m_shieldBashWindowTimer += deltaTime;
-   
-   // Reset if window expired without reaching threshold
-   if (m_shieldBashWindowTimer >= shieldBashWindow)
+        // Window expired without reaching threshold
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_shieldBashWindowTimer = 0;
+
+        ALOG_INFO("VRInputHandler: Shield bash window expired. Count was %d/%d - resetting",
+            handler->m_shieldBashCount, shieldBashThreshold);
+        handler->m_shieldBashCount = 0;
+    }
+
+    void VRInputHandler::OnShieldBashLockoutExpired(void* context)
     {
-           _MESSAGE("VRInputHandler: Shield bash window expired. Count was %d/%d - resetting",
-   m_shieldBashCount, shieldBashThreshold);
-      m_shieldBashCount = 0;
-     m_shieldBashWindowTimer = 0.0f;
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_shieldBashLockoutActive = false;
+        handler->m_shieldBashLockoutTimer = 0;
+        handler->m_timers.Cancel(handler->m_shieldBashLockoutLogTimer);
+        ALOG_INFO("VRInputHandler: *** SHIELD BASH LOCKOUT EXPIRED *** Bash tracking resumed");
     }
-        }
+
+    void VRInputHandler::OnShieldBashLockoutLog(void* context)
+    {
+        // Log progress every 30 seconds while the lockout lasts
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_shieldBashLockoutLogTimer = 0;
+        if (!handler->m_shieldBashLockoutActive)
+            return;
+
+        float remaining = handler->m_timers.Remaining(handler->m_shieldBashLockoutTimer);
+        ALOG_INFO("VRInputHandler: Shield bash lockout: %.0f sec remaining (%.0f sec elapsed)",
+            remaining, shieldBashLockoutDuration - remaining);
+        handler->m_shieldBashLockoutLogTimer = handler->m_timers.Schedule(30.0f, OnShieldBashLockoutLog, handler);
     }
 
+    // ============================================
+    // Queued Events
+    // ============================================
+    // HIGGS callbacks (and the game event sinks in main.cpp/EquipManager.cpp) only queue a
+    // record; DrainGameEvents applies them at the top of the next physics step.
+
     void VRInputHandler::OnGrabbed(bool isLeftVRController, TESObjectREFR* grabbedRefr)
+    {
+        PushGameEvent(GameEventType::Grabbed, isLeftVRController, 0, grabbedRefr);
+    }
+
+    void VRInputHandler::OnDropped(bool isLeftVRController, TESObjectREFR* droppedRefr)
+    {
+        PushGameEvent(GameEventType::Dropped, isLeftVRController, 0, droppedRefr);
+    }
+
+    void VRInputHandler::OnPulled(bool isLeftVRController, TESObjectREFR* pulledRefr)
+    {
+        PushGameEvent(GameEventType::Pulled, isLeftVRController, 0, pulledRefr);
+    }
+
+    void VRInputHandler::OnCollision(bool isLeftVRController, float mass, float separatingVelocity)
+    {
+        PushGameEvent(GameEventType::Collision, isLeftVRController, 0, nullptr, mass, separatingVelocity);
+    }
+
+    void VRInputHandler::OnStartTwoHanding()
+    {
+        PushGameEvent(GameEventType::StartTwoHanding);
+    }
+
+    void VRInputHandler::OnStopTwoHanding()
+    {
+        PushGameEvent(GameEventType::StopTwoHanding);
+    }
+
+    // Reference behind a queued handle (null if it no longer resolves)
+    static TESObjectREFR* ResolveEventRef(UInt32 refHandle, NiPointer<TESObjectREFR>& holder)
+    {
+        if (refHandle == 0 || refHandle == *g_invalidRefHandle)
+            return nullptr;
+        if (!LookupREFRByHandle(refHandle, holder))
+            return nullptr;
+        return holder.get();
+    }
+
+    void VRInputHandler::DrainGameEvents()
+    {
+        UInt32 dropped = TakeDroppedGameEventCount();
+        if (dropped > 0)
+            ALOG_WARN("VRInputHandler: WARNING - %u game events dropped (queue full), clearing state and resyncing equipment", dropped);
+
+        GameEvent event;
+        while (PopGameEvent(event))
+        {
+            NiPointer<TESObjectREFR> refr;
+            switch (event.type)
+            {
+            case GameEventType::Grabbed:
+                HandleGrabbed(event.isLeft, ResolveEventRef(event.refHandle, refr));
+                break;
+            case GameEventType::Dropped:
+                HandleDropped(event.isLeft, ResolveEventRef(event.refHandle, refr));
+                break;
+            case GameEventType::Pulled:
+                HandlePulled(event.isLeft, ResolveEventRef(event.refHandle, refr));
+                break;
+            case GameEventType::Collision:
+                HandleCollision(event.isLeft, event.mass, event.separatingVelocity);
+                break;
+            case GameEventType::StartTwoHanding:
+                HandleStartTwoHanding();
+                break;
+            case GameEventType::StopTwoHanding:
+                HandleStopTwoHanding();
+                break;
+            case GameEventType::WeaponSwing:
+                OnWeaponSwing(event.isLeft, LookupFormByID(event.formID));
+                break;
+            case GameEventType::PlayerDeath:
+                ALOG_INFO("VRInputHandler: Player died! Clearing all VR tracking state.");
+                ClearAllState();
+                break;
+            case GameEventType::PlayerEquip:
+            {
+                TESForm* item = LookupFormByID(event.formID);
+                PlayerCharacter* player = *g_thePlayer;
+                if (item && player)
+                    EquipManager::GetSingleton()->OnEquip(item, player, event.isLeft);
+                break;
+            }
+            case GameEventType::PlayerUnequip:
+            {
+                TESForm* item = LookupFormByID(event.formID);
+                PlayerCharacter* player = *g_thePlayer;
+                if (item && player)
+                {
+                    // Hand from the tracked state - every earlier equip event has been applied by now
+                    const PlayerEquipState& state = EquipManager::GetSingleton()->GetEquipState();
+                    bool isLeftHand = state.leftHand.form && state.leftHand.form->formID == item->formID;
+                    EquipManager::GetSingleton()->OnUnequip(item, player, isLeftHand);
+                }
+                break;
+            }
+            case GameEventType::MenuClosed:
+                PauseTracking(false);
+                if (timerReportOnMenuClose)
+                    LogHotPathTimers();
+                break;
+            case GameEventType::GameLoaded:
+                ALOG_INFO("VRInputHandler: Game loaded - clearing VR tracking state and updating equipment");
+                ClearAllState();
+                EquipManager::GetSingleton()->UpdateEquipmentState();
+                UpdateGrabListening();
+                break;
+            }
+        }
+
+        // A lost load or death would leave grab, cooldown and timer state from before it, and
+        // lost equip events the tracked equipment. Drops happen while the queue is full, after
+        // the events popped above were queued, so clear once they are handled and resync.
+        if (dropped > 0)
+        {
+            ClearAllState();
+            EquipManager::GetSingleton()->UpdateEquipmentState();
+            UpdateGrabListening();
+        }
+    }
+
+    void VRInputHandler::HandleGrabbed(bool isLeftVRController, TESObjectREFR* grabbedRefr)
     {
       VRInputHandler* handler = GetSingleton();
 
@@ -660,14 +1033,14 @@ if (shieldDropped && higgsInterface)
 
         if (grabbedRefr)
         {
-  _MESSAGE("VRInputHandler: GRAB event - %s VR controller (game %s hand) grabbed object (FormID: %08X)", 
+  ALOG_INFO("VRInputHandler: GRAB event - %s VR controller (game %s hand) grabbed object (FormID: %08X)", 
     vrControllerName, gameHandName, grabbedRefr->formID);
 
    // Get the base form to check what type of object was grabbed
        TESForm* baseForm = grabbedRefr->baseForm;
  if (baseForm)
   {
- _MESSAGE("VRInputHandler:   Base form type: %d, FormID: %08X", 
+ ALOG_INFO("VRInputHandler:   Base form type: %d, FormID: %08X", 
             baseForm->formType, baseForm->formID);
     
       // Check if grabbed object is a weapon
@@ -676,7 +1049,7 @@ if (shieldDropped && higgsInterface)
         // Check if auto-equip feature is enabled
           if (!autoEquipGrabbedWeaponEnabled)
  {
-   _MESSAGE("VRInputHandler: Grabbed weapon but auto-equip is disabled in INI");
+   ALOG_INFO("VRInputHandler: Grabbed weapon but auto-equip is disabled in INI");
    return;
      }
       
@@ -686,7 +1059,7 @@ if (shieldDropped && higgsInterface)
     
        if (isFromCollisionAvoidance)
   {
-      _MESSAGE("VRInputHandler: Grabbed weapon is from collision avoidance - skipping auto-equip");
+      ALOG_INFO("VRInputHandler: Grabbed weapon is from collision avoidance - skipping auto-equip");
     return;
             }
         
@@ -701,8 +1074,8 @@ if (shieldDropped && higgsInterface)
  
 if (otherHandHasWeaponOrShield)
  {
-          _MESSAGE("VRInputHandler: Player grabbed a weapon while other hand has weapon/shield equipped!");
-         _MESSAGE("VRInputHandler: Starting auto-equip timer for %s VR hand (game %s hand)", 
+          ALOG_INFO("VRInputHandler: Player grabbed a weapon while other hand has weapon/shield equipped!");
+         ALOG_INFO("VRInputHandler: Starting auto-equip timer for %s VR hand (game %s hand)", 
            vrControllerName, gameHandName);
   
 // Start auto-equip timer
@@ -724,12 +1097,12 @@ if (otherHandHasWeaponOrShield)
      }
     else
    {
-       _MESSAGE("VRInputHandler: GRAB event - %s VR controller (game %s hand) (null reference)", 
+       ALOG_INFO("VRInputHandler: GRAB event - %s VR controller (game %s hand) (null reference)", 
    vrControllerName, gameHandName);
         }
     }
 
-    void VRInputHandler::OnDropped(bool isLeftVRController, TESObjectREFR* droppedRefr)
+    void VRInputHandler::HandleDropped(bool isLeftVRController, TESObjectREFR* droppedRefr)
     {
    if (!droppedRefr)
             return;
@@ -737,7 +1110,7 @@ if (otherHandHasWeaponOrShield)
     // Convert VR controller to game hand
         bool isLeftGameHand = VRControllerToGameHand(isLeftVRController);
 
-  _MESSAGE("VRInputHandler: DROP event - %s VR controller (game %s hand) dropped object (FormID: %08X)", 
+  ALOG_INFO("VRInputHandler: DROP event - %s VR controller (game %s hand) dropped object (FormID: %08X)", 
             isLeftVRController ? "Left" : "Right",
             isLeftGameHand ? "Left" : "Right",
         droppedRefr->formID);
@@ -754,9 +1127,9 @@ if (otherHandHasWeaponOrShield)
         if (isLeftVRController && handler->m_autoEquipWeaponLeft == droppedRefr)
         {
 isAutoEquipWeapon = true;
-            _MESSAGE("VRInputHandler: === ACCIDENTAL DROP DETECTED (LEFT) ===");
-            _MESSAGE("VRInputHandler:   Weapon was pending auto-equip (grabbed from world)");
-    _MESSAGE("VRInputHandler:   Cause: Player released grip OR physics collision knocked it away");
+            ALOG_INFO("VRInputHandler: === ACCIDENTAL DROP DETECTED (LEFT) ===");
+            ALOG_INFO("VRInputHandler:   Weapon was pending auto-equip (grabbed from world)");
+    ALOG_INFO("VRInputHandler:   Cause: Player released grip OR physics collision knocked it away");
             
    handler->m_autoEquipPendingLeft = false;
             handler->m_autoEquipTimerLeft = 0.0f;
@@ -765,9 +1138,9 @@ isAutoEquipWeapon = true;
         else if (!isLeftVRController && handler->m_autoEquipWeaponRight == droppedRefr)
         {
             isAutoEquipWeapon = true;
-   _MESSAGE("VRInputHandler: === ACCIDENTAL DROP DETECTED (RIGHT) ===");
- _MESSAGE("VRInputHandler:   Weapon was pending auto-equip (grabbed from world)");
-            _MESSAGE("VRInputHandler:   Cause: Player released grip OR physics collision knocked it away");
+   ALOG_INFO("VRInputHandler: === ACCIDENTAL DROP DETECTED (RIGHT) ===");
+ ALOG_INFO("VRInputHandler:   Weapon was pending auto-equip (grabbed from world)");
+            ALOG_INFO("VRInputHandler:   Cause: Player released grip OR physics collision knocked it away");
      
  handler->m_autoEquipPendingRight = false;
             handler->m_autoEquipTimerRight = 0.0f;
@@ -780,10 +1153,10 @@ isAutoEquipWeapon = true;
       if (trackedWeapon && droppedRefr == trackedWeapon)
         {
      isCollisionAvoidanceWeapon = true;
-       _MESSAGE("VRInputHandler: === ACCIDENTAL DROP DETECTED (Collision Avoidance Weapon) ===");
- _MESSAGE("VRInputHandler:   Weapon was grabbed by our collision avoidance system");
-  _MESSAGE("VRInputHandler:   Cause: Player released grip OR physics collision knocked it away");
-            _MESSAGE("VRInputHandler:   Game hand: %s", isLeftGameHand ? "Left" : "Right");
+       ALOG_INFO("VRInputHandler: === ACCIDENTAL DROP DETECTED (Collision Avoidance Weapon) ===");
+ ALOG_INFO("VRInputHandler:   Weapon was grabbed by our collision avoidance system");
+  ALOG_INFO("VRInputHandler:   Cause: Player released grip OR physics collision knocked it away");
+            ALOG_INFO("VRInputHandler:   Game hand: %s", isLeftGameHand ? "Left" : "Right");
    
        // IMMEDIATELY teleport weapon to hand and force re-grab
       if (higgsInterface)
@@ -815,14 +1188,14 @@ NiPoint3 handPos = handNode->m_worldTransform.pos;
     weaponNode->m_worldTransform.pos = handPos;
         }
           
- _MESSAGE("VRInputHandler: Teleported weapon to hand (%.1f, %.1f, %.1f)",
+ ALOG_INFO("VRInputHandler: Teleported weapon to hand (%.1f, %.1f, %.1f)",
                   handPos.x, handPos.y, handPos.z);
    }
     }
          }
       
     // Force HIGGS to grab it immediately
-    _MESSAGE("VRInputHandler: Force re-grabbing with %s VR controller", 
+    ALOG_INFO("VRInputHandler: Force re-grabbing with %s VR controller", 
        isLeftVRController ? "LEFT" : "RIGHT");
     higgsInterface->GrabObject(droppedRefr, isLeftVRController);
     
@@ -843,7 +1216,7 @@ NiPoint3 handPos = handNode->m_worldTransform.pos;
    
         if (otherHandHasWeapon && higgsInterface)
             {
-          _MESSAGE("VRInputHandler: Weapon dropped while other hand has weapon - attempting immediate re-grab");
+          ALOG_INFO("VRInputHandler: Weapon dropped while other hand has weapon - attempting immediate re-grab");
    
             // Check if the hand can grab an object right now
     if (higgsInterface->CanGrabObject(isLeftVRController))
@@ -851,13 +1224,13 @@ NiPoint3 handPos = handNode->m_worldTransform.pos;
          // Use HIGGS to grab the weapon again
         higgsInterface->GrabObject(droppedRefr, isLeftVRController);
          
-       _MESSAGE("VRInputHandler: Re-grab command sent for %s VR controller", 
+       ALOG_INFO("VRInputHandler: Re-grab command sent for %s VR controller", 
            isLeftVRController ? "LEFT" : "RIGHT");
          return;
  }
         else
             {
-        _MESSAGE("VRInputHandler: Cannot re-grab - hand not in grabbable state");
+        ALOG_INFO("VRInputHandler: Cannot re-grab - hand not in grabbable state");
           }
             }
         }
@@ -867,7 +1240,7 @@ NiPoint3 handPos = handNode->m_worldTransform.pos;
         // ============================================
         if (isCollisionAvoidanceWeapon)
         {
-            _MESSAGE("VRInputHandler: Clearing collision avoidance tracking for game %s hand", 
+            ALOG_INFO("VRInputHandler: Clearing collision avoidance tracking for game %s hand", 
        isLeftGameHand ? "Left" : "Right");
   
      // Clear the dropped weapon reference (by game hand)
@@ -885,19 +1258,17 @@ NiPoint3 handPos = handNode->m_worldTransform.pos;
           handler->m_higgsCollisionActive = false;
            handler->m_wasHiggsCollisionActive = false;
       handler->m_timeSinceLastCollision = 0.0f;
-         handler->m_pendingReequip = false;
-           handler->m_pendingReequipTimer = 0.0f;
+         handler->CancelPendingReequip();
             }
          else
   {
           handler->m_shieldCollisionActive = false;
        handler->m_wasShieldCollisionActive = false;
           handler->m_timeSinceLastShieldCollision = 0.0f;
-      handler->m_pendingReequipRight = false;
-  handler->m_pendingReequipRightTimer = 0.0f;
+      handler->CancelPendingReequipRight();
   }
          
- _MESSAGE("VRInputHandler: Cleared all tracking state for game %s hand - weapon was dropped", 
+ ALOG_INFO("VRInputHandler: Cleared all tracking state for game %s hand - weapon was dropped", 
     isLeftGameHand ? "Left" : "Right");
         }
         
@@ -905,11 +1276,11 @@ NiPoint3 handPos = handNode->m_worldTransform.pos;
   if (!isAutoEquipWeapon && !isCollisionAvoidanceWeapon && 
  droppedRefr->baseForm && droppedRefr->baseForm->formType == kFormType_Weapon)
 {
-        _MESSAGE("VRInputHandler: Untracked weapon dropped (not managed by FalseEdgeVR)");
+        ALOG_INFO("VRInputHandler: Untracked weapon dropped (not managed by FalseEdgeVR)");
   }
 }
 
-    void VRInputHandler::OnPulled(bool isLeftVRController, TESObjectREFR* pulledRefr)
+    void VRInputHandler::HandlePulled(bool isLeftVRController, TESObjectREFR* pulledRefr)
     {
 VRInputHandler* handler = GetSingleton();
 
@@ -923,17 +1294,17 @@ VRInputHandler* handler = GetSingleton();
 
    if (pulledRefr)
         {
-            LOG("VRInputHandler: PULL event - %s VR controller (game %s hand) pulled object (FormID: %08X)", 
+            ALOG_WARN("VRInputHandler: PULL event - %s VR controller (game %s hand) pulled object (FormID: %08X)", 
  vrControllerName, gameHandName, pulledRefr->formID);
   }
         else
         {
-     LOG("VRInputHandler: PULL event - %s VR controller (game %s hand) (null reference)", 
+     ALOG_WARN("VRInputHandler: PULL event - %s VR controller (game %s hand) (null reference)", 
          vrControllerName, gameHandName);
         }
     }
 
-    void VRInputHandler::OnCollision(bool isLeftVRController, float mass, float separatingVelocity)
+    void VRInputHandler::HandleCollision(bool isLeftVRController, float mass, float separatingVelocity)
     {
         VRInputHandler* handler = GetSingleton();
 
@@ -981,9 +1352,9 @@ VRInputHandler* handler = GetSingleton();
         bool collisionFromWeaponHand = (isLeftGameHand == weaponHandIsLeft);
         if (collisionFromWeaponHand && hasShield && (weaponHandHasWeapon || weaponHandGrabbedWeapon) && separatingVelocity > 3.0f)
         {
-            _MESSAGE("VRInputHandler: Potential SHIELD BASH - Weapon hit shield! Velocity: %.1f, Mass: %.1f",
+            ALOG_INFO("VRInputHandler: Potential SHIELD BASH - Weapon hit shield! Velocity: %.1f, Mass: %.1f",
                 separatingVelocity, mass);
-            _MESSAGE("VRInputHandler:   Weapon hand equipped: %s, Weapon hand grabbed: %s",
+            ALOG_INFO("VRInputHandler:   Weapon hand equipped: %s, Weapon hand grabbed: %s",
                 weaponHandHasWeapon ? "YES" : "NO", weaponHandGrabbedWeapon ? "YES" : "NO");
             handler->OnShieldBash();
         }
@@ -993,7 +1364,7 @@ VRInputHandler* handler = GetSingleton();
         {
             const char* vrControllerName = isLeftVRController ? "Left" : "Right";
             const char* gameHandName = isLeftGameHand ? "Left" : "Right";
-      LOG("VRInputHandler: COLLISION event - %s VR controller (game %s hand), mass: %.2f, velocity: %.2f", 
+      ALOG_WARN("VRInputHandler: COLLISION event - %s VR controller (game %s hand), mass: %.2f, velocity: %.2f", 
       vrControllerName, gameHandName, mass, separatingVelocity);
         }
     }
@@ -1005,7 +1376,7 @@ VRInputHandler* handler = GetSingleton();
     if (!m_higgsCollisionActive)
      {
    m_higgsCollisionActive = true;
-      _MESSAGE("VRInputHandler: === GRABBED WEAPON (game LEFT hand) TOUCHING EQUIPPED WEAPON ===");
+      ALOG_INFO("VRInputHandler: === GRABBED WEAPON (game LEFT hand) TOUCHING EQUIPPED WEAPON ===");
             }
    m_timeSinceLastCollision = 0.0f;
         }
@@ -1014,13 +1385,13 @@ VRInputHandler* handler = GetSingleton();
             if (!m_shieldCollisionActive)
 {
              m_shieldCollisionActive = true;
-         _MESSAGE("VRInputHandler: === GRABBED WEAPON (game RIGHT hand) TOUCHING SHIELD ===");
+         ALOG_INFO("VRInputHandler: === GRABBED WEAPON (game RIGHT hand) TOUCHING SHIELD ===");
   }
       m_timeSinceLastShieldCollision = 0.0f;
      }
     }
 
-    void VRInputHandler::CheckCollisionTimeout(float deltaTime)
+    void VRInputHandler::CheckCollisionTimeout(const FrameContext& frame)
     {
         // Skip collision avoidance logic if in close combat mode
               // Skip collision avoidance logic if in close combat mode
@@ -1034,8 +1405,8 @@ VRInputHandler* handler = GetSingleton();
         // Determine off-hand based on handedness mode
         // Right-handed: off-hand = LEFT game hand (true)
         // Left-handed: off-hand = RIGHT game hand (false)
-        bool offHandIsLeft = !IsLeftHandedMode();
-        bool offHandVRControllerIsLeft = GameHandToVRController(offHandIsLeft);
+        bool offHandIsLeft = frame.OffHandIsLeft();
+        bool offHandVRControllerIsLeft = frame.GameHandToController(offHandIsLeft);
 
         if (!EquipManager::GetSingleton()->HasPendingReequip(offHandIsLeft))
         {
@@ -1047,15 +1418,15 @@ VRInputHandler* handler = GetSingleton();
 
      // TRIGGER OVERRIDE: If trigger is held on EITHER hand, immediately re-equip the weapon
   // This allows the player to force the weapon back to equipped state
-    bool leftTrig = IsLeftTriggerPressed();
-        bool rightTrig = IsRightTriggerPressed();
+    bool leftTrig = frame.leftTriggerPressed;
+        bool rightTrig = frame.rightTriggerPressed;
         
         if (leftTrig || rightTrig)
         {
  TESObjectREFR* triggerDroppedWeapon = EquipManager::GetSingleton()->GetDroppedWeaponRef(offHandIsLeft);
           if (triggerDroppedWeapon && triggerDroppedWeapon->baseForm)
     {
-     _MESSAGE("VRInputHandler: TRIGGER HELD - forcing immediate re-equip of grabbed weapon (Left=%s, Right=%s)",
+     ALOG_INFO("VRInputHandler: TRIGGER HELD - forcing immediate re-equip of grabbed weapon (Left=%s, Right=%s)",
     leftTrig ? "YES" : "NO", rightTrig ? "YES" : "NO");
             
     // Check if this was a dual-wield same weapon situation
@@ -1065,8 +1436,8 @@ VRInputHandler* handler = GetSingleton();
    {
           // For dual-wield same weapon: DON'T activate (which would add duplicate to inventory)
        // The re-equip will use the existing inventory item via cached FormID
-           _MESSAGE("VRInputHandler: Dual-wield same weapon - SKIPPING activation (will re-equip from existing inventory)");
-        _MESSAGE("VRInputHandler: Deleting spawned weapon (RefID: %08X) from world", triggerDroppedWeapon->formID);
+           ALOG_INFO("VRInputHandler: Dual-wield same weapon - SKIPPING activation (will re-equip from existing inventory)");
+        ALOG_INFO("VRInputHandler: Deleting spawned weapon (RefID: %08X) from world", triggerDroppedWeapon->formID);
          
      // Delete the spawned world object so it doesn't accumulate on the ground
  DeleteWorldObject(triggerDroppedWeapon);
@@ -1074,7 +1445,7 @@ VRInputHandler* handler = GetSingleton();
       else
         {
     // Normal case (different weapons): activate to add to inventory
-         _MESSAGE("VRInputHandler: Activating grabbed weapon to add to inventory (RefID: %08X, BaseID: %08X)...",
+         ALOG_INFO("VRInputHandler: Activating grabbed weapon to add to inventory (RefID: %08X, BaseID: %08X)...",
               triggerDroppedWeapon->formID, triggerDroppedWeapon->baseForm->formID);
       
             PlayerCharacter* player = *g_thePlayer;
@@ -1084,7 +1455,7 @@ VRInputHandler* handler = GetSingleton();
        EquipManager::s_suppressPickupSound = true;
            bool activated = SafeActivate(triggerDroppedWeapon, player, 0, 0, 1, false);
           EquipManager::s_suppressPickupSound = false;
-     _MESSAGE("VRInputHandler: Activate result: %s", activated ? "SUCCESS" : "FAILED");
+     ALOG_INFO("VRInputHandler: Activate result: %s", activated ? "SUCCESS" : "FAILED");
              }
        }
           
@@ -1094,10 +1465,8 @@ VRInputHandler* handler = GetSingleton();
       // Also clear PendingReequip so CheckCollisionTimeout doesn't clear cached FormID
       EquipManager::GetSingleton()->ClearPendingReequip(offHandIsLeft);
    
-         m_pendingReequip = true;
-          m_pendingReequipIsLeft = offHandIsLeft;
-          m_pendingReequipTimer = 0.0f;
-  _MESSAGE("VRInputHandler: Scheduled re-equip for %s hand in %.1f ms (TRIGGER OVERRIDE)", 
+         SchedulePendingReequip(offHandIsLeft);
+  ALOG_INFO("VRInputHandler: Scheduled re-equip for %s hand in %.1f ms (TRIGGER OVERRIDE)", 
            offHandIsLeft ? "left" : "right", reequipDelay * 1000.0f);
       
   // Clear collision state
@@ -1111,7 +1480,7 @@ VRInputHandler* handler = GetSingleton();
         TESObjectREFR* droppedWeapon = EquipManager::GetSingleton()->GetDroppedWeaponRef(offHandIsLeft);
         if (!droppedWeapon)
         {
-            _MESSAGE("CheckCollisionTimeout: Dropped weapon ref is NULL - clearing state");
+            ALOG_INFO("CheckCollisionTimeout: Dropped weapon ref is NULL - clearing state");
             EquipManager::GetSingleton()->ClearPendingReequip(offHandIsLeft);
             EquipManager::GetSingleton()->ClearDroppedWeaponRef(offHandIsLeft);
             EquipManager::GetSingleton()->ClearCachedWeaponFormID(offHandIsLeft);
@@ -1123,7 +1492,7 @@ VRInputHandler* handler = GetSingleton();
 
         if (higgsInterface)
         {
-            TESObjectREFR* higgsHeld = higgsInterface->GetGrabbedObject(offHandVRControllerIsLeft);
+            TESObjectREFR* higgsHeld = frame.GrabbedByController(offHandVRControllerIsLeft);
       if (higgsHeld != droppedWeapon)
    {
             // HIGGS is not holding our weapon - but give it a few frames to actually grab
@@ -1138,15 +1507,15 @@ VRInputHandler* handler = GetSingleton();
         lastDroppedWeapon = droppedWeapon;
             }
             
-      higgsGrabWaitTime += deltaTime;
+      higgsGrabWaitTime += frame.deltaTime;
           
    // Only clear state if HIGGS hasn't grabbed after 0.3 seconds
      // This gives HIGGS time to actually grab the object
      if (higgsGrabWaitTime >= 0.3f)
      {
         // In right-handed mode: off-hand = LEFT, in left-handed mode: off-hand = RIGHT
-   bool offHandIsLeft = !IsLeftHandedMode();
-     _MESSAGE("CheckCollisionTimeout: HIGGS not holding our weapon after 0.3s (held: %p, dropped: %p) - clearing state",
+   bool offHandIsLeft = frame.OffHandIsLeft();
+     ALOG_INFO("CheckCollisionTimeout: HIGGS not holding our weapon after 0.3s (held: %p, dropped: %p) - clearing state",
         higgsHeld, droppedWeapon);
      EquipManager::GetSingleton()->ClearPendingReequip(offHandIsLeft);
          EquipManager::GetSingleton()->ClearDroppedWeaponRef(offHandIsLeft);
@@ -1172,14 +1541,9 @@ VRInputHandler* handler = GetSingleton();
         float currentDistance = GetGrabbedToEquippedDistance(offHandVRControllerIsLeft);
   bool bladesClose = (currentDistance < bladeReequipThreshold);
         
-        static int logCounter = 0;
-   logCounter++;
-if (logCounter % 100 == 0)
-        {
-            _MESSAGE("CheckCollisionTimeout: Distance=%.2f, Threshold=%.2f, BladesClose=%s, Timer=%.3f, Timeout=%.3f",
+            ALOG_CHANNEL(DEBUG, LogChannel::CollisionTimeout, "CheckCollisionTimeout: Distance=%.2f, Threshold=%.2f, BladesClose=%s, Timer=%.3f, Timeout=%.3f",
     currentDistance, bladeReequipThreshold, bladesClose ? "YES" : "NO", 
 m_timeSinceLastCollision, bladeCollisionTimeout);
-        }
    
         if (bladesClose)
         {
@@ -1188,13 +1552,13 @@ m_timeSinceLastCollision, bladeCollisionTimeout);
         }
         else
         {
- m_timeSinceLastCollision += deltaTime;
+ m_timeSinceLastCollision += frame.deltaTime;
         
        if (m_timeSinceLastCollision >= bladeCollisionTimeout)
     {
      m_higgsCollisionActive = false;
-                _MESSAGE("VRInputHandler: === GRABBED WEAPON SAFE TO RE-EQUIP ===");
-   _MESSAGE("VRInputHandler: Time separated: %.3f sec, Distance: %.2f (threshold: %.2f)", 
+                ALOG_INFO("VRInputHandler: === GRABBED WEAPON SAFE TO RE-EQUIP ===");
+   ALOG_INFO("VRInputHandler: Time separated: %.3f sec, Distance: %.2f (threshold: %.2f)", 
    m_timeSinceLastCollision, currentDistance, bladeReequipThreshold);
   
    droppedWeapon = EquipManager::GetSingleton()->GetDroppedWeaponRef(offHandIsLeft);
@@ -1207,8 +1571,8 @@ m_timeSinceLastCollision, bladeCollisionTimeout);
             {
       // For dual-wield same weapon: DON'T activate (which would add duplicate to inventory)
   // The re-equip will use the existing inventory item via cached FormID
-   _MESSAGE("VRInputHandler: Dual-wield same weapon - SKIPPING activation (will re-equip from existing inventory)");
-      _MESSAGE("VRInputHandler: Deleting spawned weapon (RefID: %08X) from world", droppedWeapon->formID);
+   ALOG_INFO("VRInputHandler: Dual-wield same weapon - SKIPPING activation (will re-equip from existing inventory)");
+      ALOG_INFO("VRInputHandler: Deleting spawned weapon (RefID: %08X) from world", droppedWeapon->formID);
            
          // Delete the spawned world object so it doesn't accumulate on the ground
  DeleteWorldObject(droppedWeapon);
@@ -1216,7 +1580,7 @@ m_timeSinceLastCollision, bladeCollisionTimeout);
           else
             {
  // Normal case (different weapons): activate to add to inventory
-         _MESSAGE("VRInputHandler: Activating grabbed weapon to add to inventory (RefID: %08X, BaseID: %08X)...",
+         ALOG_INFO("VRInputHandler: Activating grabbed weapon to add to inventory (RefID: %08X, BaseID: %08X)...",
          droppedWeapon->formID, droppedWeapon->baseForm->formID);
      
                 PlayerCharacter* player = *g_thePlayer;
@@ -1226,105 +1590,151 @@ m_timeSinceLastCollision, bladeCollisionTimeout);
           EquipManager::s_suppressPickupSound = true;
       bool activated = SafeActivate(droppedWeapon, player, 0, 0, 1, false);
            EquipManager::s_suppressPickupSound = false;
-        _MESSAGE("VRInputHandler: Activate result: %s", activated ? "SUCCESS" : "FAILED");
+        ALOG_INFO("VRInputHandler: Activate result: %s", activated ? "SUCCESS" : "FAILED");
       }
             }
         }
         else
     {
-   _MESSAGE("VRInputHandler: WARNING - Dropped weapon ref became invalid before activation!");
+   ALOG_WARN("VRInputHandler: WARNING - Dropped weapon ref became invalid before activation!");
     }
    
  // Clear the dropped weapon ref but KEEP the cached FormID for re-equip!
     // In right-handed mode: off-hand = LEFT, in left-handed mode: off-hand = RIGHT
-    bool offHandIsLeft = !IsLeftHandedMode();
+    bool offHandIsLeft = frame.OffHandIsLeft();
   EquipManager::GetSingleton()->ClearDroppedWeaponRef(offHandIsLeft);
    
     // Also clear PendingReequip so CheckCollisionTimeout doesn't clear cached FormID
         EquipManager::GetSingleton()->ClearPendingReequip(offHandIsLeft);
    
-     m_pendingReequip = true;
-  m_pendingReequipIsLeft = offHandIsLeft;
-     m_pendingReequipTimer = 0.0f;
-  _MESSAGE("VRInputHandler: Scheduled re-equip for %s hand in %.1f ms", 
+     SchedulePendingReequip(offHandIsLeft);
+  ALOG_INFO("VRInputHandler: Scheduled re-equip for %s hand in %.1f ms", 
       offHandIsLeft ? "left" : "right", reequipDelay * 1000.0f);
 }
         }
     }
 
-  void VRInputHandler::CheckPendingReequip(float deltaTime)
+    // ============================================
+    // Timers
+    // ============================================
+
+    void VRInputHandler::StartReequipCooldown(bool isLeftGameHand)
     {
-        if (m_pendingReequip)
+        // Left hand uses the blade cooldown, right hand the shield cooldown
+        if (isLeftGameHand)
         {
-            m_pendingReequipTimer += deltaTime;
-  
-       if (m_pendingReequipTimer >= reequipDelay)
-     {
-     _MESSAGE("VRInputHandler: Re-equipping weapon to %s hand after %.3f ms delay", 
- m_pendingReequipIsLeft ? "left" : "right", m_pendingReequipTimer * 1000.0f);
- 
-              m_pendingReequip = false;
-         m_pendingReequipTimer = 0.0f;
- 
-            if (m_pendingReequipIsLeft)
-      {
+            m_timers.Cancel(m_leftHandCooldownTimer);
+            m_leftHandOnCooldown = true;
+            m_leftHandCooldownTimer = m_timers.Schedule(bladeReequipCooldown, OnLeftCooldownExpired, this);
+        }
+        else
+        {
+            m_timers.Cancel(m_rightHandCooldownTimer);
+            m_rightHandOnCooldown = true;
+            m_rightHandCooldownTimer = m_timers.Schedule(shieldReequipCooldown, OnRightCooldownExpired, this);
+        }
+    }
+
+    void VRInputHandler::OnLeftCooldownExpired(void* context)
+    {
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_leftHandOnCooldown = false;
+        handler->m_leftHandCooldownTimer = 0;
+        ALOG_INFO("VRInputHandler: Left hand cooldown expired, can trigger again");
+    }
+
+    void VRInputHandler::OnRightCooldownExpired(void* context)
+    {
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_rightHandOnCooldown = false;
+        handler->m_rightHandCooldownTimer = 0;
+        ALOG_INFO("VRInputHandler: Right hand cooldown expired, can trigger again");
+    }
+
+    void VRInputHandler::SchedulePendingReequip(bool isLeftGameHand)
+    {
+        m_reequipTimers.Cancel(m_pendingReequipTimer);
+        m_pendingReequip = true;
+        m_pendingReequipIsLeft = isLeftGameHand;
+        m_pendingReequipTimer = m_reequipTimers.Schedule(reequipDelay, OnPendingReequipExpired, this);
+    }
+
+    void VRInputHandler::CancelPendingReequip()
+    {
+        m_reequipTimers.Cancel(m_pendingReequipTimer);
+        m_pendingReequip = false;
+    }
+
+    void VRInputHandler::SchedulePendingReequipRight()
+    {
+        m_reequipTimers.Cancel(m_pendingReequipRightTimer);
+        m_pendingReequipRight = true;
+        m_pendingReequipRightTimer = m_reequipTimers.Schedule(shieldReequipDelay, OnPendingReequipRightExpired, this);
+    }
+
+    void VRInputHandler::CancelPendingReequipRight()
+    {
+        m_reequipTimers.Cancel(m_pendingReequipRightTimer);
+        m_pendingReequipRight = false;
+    }
+
+    void VRInputHandler::OnPendingReequipExpired(void* context)
+    {
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_pendingReequip = false;
+        handler->m_pendingReequipTimer = 0;
+
+        ALOG_INFO("VRInputHandler: Re-equipping weapon to %s hand after %.3f ms delay", 
+            handler->m_pendingReequipIsLeft ? "left" : "right", reequipDelay * 1000.0f);
+
         // Suppress draw sound during collision re-equip
         EquipManager::s_suppressDrawSound = true;
-     EquipManager::GetSingleton()->ForceReequipLeftHand();
-         EquipManager::s_suppressDrawSound = false;
-           m_leftHandOnCooldown = true;
-m_leftHandCooldownTimer = 0.0f;
-  _MESSAGE("VRInputHandler: Started %.0fms cooldown for left hand", bladeReequipCooldown * 1000.0f);
-       }
-       else
-  {
+        if (handler->m_pendingReequipIsLeft)
+            EquipManager::GetSingleton()->ForceReequipLeftHand();
+        else
+            EquipManager::GetSingleton()->ForceReequipRightHand();
+        EquipManager::s_suppressDrawSound = false;
+
+        handler->StartReequipCooldown(handler->m_pendingReequipIsLeft);
+        if (handler->m_pendingReequipIsLeft)
+            ALOG_INFO("VRInputHandler: Started %.0fms cooldown for left hand", bladeReequipCooldown * 1000.0f);
+        else
+            ALOG_INFO("VRInputHandler: Started %.0fms cooldown for right hand (shield)", shieldReequipCooldown * 1000.0f);
+    }
+
+    void VRInputHandler::OnPendingReequipRightExpired(void* context)
+    {
+        VRInputHandler* handler = static_cast<VRInputHandler*>(context);
+        handler->m_pendingReequipRight = false;
+        handler->m_pendingReequipRightTimer = 0;
+
+        bool weaponHandIsLeft = !ShieldCollisionTracker::GetSingleton()->IsShieldInLeftHand();
+        ALOG_INFO("VRInputHandler: Re-equipping weapon to %s hand after %.3f ms delay (shield collision)",
+            weaponHandIsLeft ? "LEFT" : "RIGHT", shieldReequipDelay * 1000.0f);
+
         // Suppress draw sound during shield collision re-equip
         EquipManager::s_suppressDrawSound = true;
-        EquipManager::GetSingleton()->ForceReequipRightHand();
-   EquipManager::s_suppressDrawSound = false;
- m_rightHandOnCooldown = true;
- m_rightHandCooldownTimer = 0.0f;
-          _MESSAGE("VRInputHandler: Started %.0fms cooldown for right hand (shield)", shieldReequipCooldown * 1000.0f);
-        }
-        }
-        }
-  
-        if (m_pendingReequipRight)
-        {
-            m_pendingReequipRightTimer += deltaTime;
-
-            if (m_pendingReequipRightTimer >= shieldReequipDelay)
-            {
-                bool weaponHandIsLeft = !ShieldCollisionTracker::GetSingleton()->IsShieldInLeftHand();
-                _MESSAGE("VRInputHandler: Re-equipping weapon to %s hand after %.3f ms delay (shield collision)",
-                    weaponHandIsLeft ? "LEFT" : "RIGHT", m_pendingReequipRightTimer * 1000.0f);
+        if (weaponHandIsLeft)
+            EquipManager::GetSingleton()->ForceReequipLeftHand();
+        else
+            EquipManager::GetSingleton()->ForceReequipRightHand();
+        EquipManager::s_suppressDrawSound = false;
 
-                m_pendingReequipRight = false;
-                m_pendingReequipRightTimer = 0.0f;
+        handler->StartReequipCooldown(weaponHandIsLeft);
+        ALOG_INFO("VRInputHandler: Started %.0fms cooldown for right hand (shield)", shieldReequipCooldown * 1000.0f);
+    }
 
-                // Suppress draw sound during shield collision re-equip
-                EquipManager::s_suppressDrawSound = true;
-                if (weaponHandIsLeft)
-                    EquipManager::GetSingleton()->ForceReequipLeftHand();
-                else
-                    EquipManager::GetSingleton()->ForceReequipRightHand();
-                EquipManager::s_suppressDrawSound = false;
-                if (weaponHandIsLeft)
-                {
-                    m_leftHandOnCooldown = true;
-                    m_leftHandCooldownTimer = 0.0f;
-                }
-                else
-                {
-                    m_rightHandOnCooldown = true;
-                    m_rightHandCooldownTimer = 0.0f;
-                }
-          _MESSAGE("VRInputHandler: Started %.0fms cooldown for right hand (shield)", shieldReequipCooldown * 1000.0f);
+    void VRInputHandler::AdvanceTimers(float deltaTime)
+    {
+        m_timers.Advance(deltaTime);
     }
-     }
+
+    void VRInputHandler::AdvanceReequipTimers(float deltaTime)
+    {
+        m_reequipTimers.Advance(deltaTime);
     }
 
-    void VRInputHandler::CheckAutoEquipGrabbedWeapon(float deltaTime)
+    void VRInputHandler::CheckAutoEquipGrabbedWeapon(const FrameContext& frame)
     {
         // If in close combat mode, weapons are force-equipped immediately
         // so skip the normal delayed auto-equip logic
@@ -1338,20 +1748,20 @@ m_leftHandCooldownTimer = 0.0f;
       if (m_autoEquipPendingLeft && m_autoEquipWeaponLeft)
    {
       // Left VR controller is holding grabbed weapon - check if RIGHT game hand still has weapon
-            bool isLeftGameHand = VRControllerToGameHand(true);
+            bool isLeftGameHand = frame.ControllerToGameHand(true);
  bool otherHandHasWeapon = isLeftGameHand ? 
    equipState.rightHand.isEquipped : equipState.leftHand.isEquipped;
   
        if (!otherHandHasWeapon)
  {
-             _MESSAGE("VRInputHandler: Auto-equip cancelled for LEFT VR hand - other hand no longer has weapon equipped");
+             ALOG_INFO("VRInputHandler: Auto-equip cancelled for LEFT VR hand - other hand no longer has weapon equipped");
      m_autoEquipPendingLeft = false;
        m_autoEquipTimerLeft = 0.0f;
            m_autoEquipWeaponLeft = nullptr;
    }
-            else if (!higgsInterface || higgsInterface->GetGrabbedObject(true) != m_autoEquipWeaponLeft)
+            else if (!higgsInterface || frame.GrabbedByController(true) != m_autoEquipWeaponLeft)
   {
-       _MESSAGE("VRInputHandler: Auto-equip cancelled for LEFT VR hand - weapon no longer held");
+       ALOG_INFO("VRInputHandler: Auto-equip cancelled for LEFT VR hand - weapon no longer held");
   m_autoEquipPendingLeft = false;
      m_autoEquipTimerLeft = 0.0f;
      m_autoEquipWeaponLeft = nullptr;
@@ -1368,33 +1778,25 @@ m_leftHandCooldownTimer = 0.0f;
        // Blades are close (friction range) - reset timer
    if (m_autoEquipTimerLeft > 0.0f)
       {
-            static bool loggedReset = false;
-     if (!loggedReset)
-  {
-       _MESSAGE("VRInputHandler: Auto-equip timer reset - grabbed weapon near equipped (dist: %.2f < %.2f)",
+       ALOG_CHANNEL(DEBUG, LogChannel::AutoEquipResetLeft, "VRInputHandler: Auto-equip timer reset - grabbed weapon near equipped (dist: %.2f < %.2f)",
          bladeDistance, bladeImminentThreshold);
-              loggedReset = true;
-        }
     }
        m_autoEquipTimerLeft = 0.0f;
      }
        else
            {
             // Blades are far enough apart - increment timer
-         static bool loggedReset = false;
-     loggedReset = false;  // Reset log flag when blades separate
-     
-       m_autoEquipTimerLeft += deltaTime;
+       m_autoEquipTimerLeft += frame.deltaTime;
     
   if (m_autoEquipTimerLeft >= autoEquipGrabbedWeaponDelay)
         {
-     _MESSAGE("VRInputHandler: Auto-equipping grabbed weapon to LEFT game hand after %.1f sec",
+     ALOG_INFO("VRInputHandler: Auto-equipping grabbed weapon to LEFT game hand after %.1f sec",
                    autoEquipGrabbedWeaponDelay);
  
              TESForm* weaponForm = m_autoEquipWeaponLeft->baseForm;
      if (weaponForm)
       {
-   bool isLeftGameHand = VRControllerToGameHand(true);
+   bool isLeftGameHand = frame.ControllerToGameHand(true);
 
             PlayerCharacter* player = *g_thePlayer;
     if (player)
@@ -1403,7 +1805,7 @@ m_leftHandCooldownTimer = 0.0f;
            EquipManager::s_suppressPickupSound = true;
  bool activated = SafeActivate(m_autoEquipWeaponLeft, player, 0, 0, 1, true);
        EquipManager::s_suppressPickupSound = false;
-   _MESSAGE("VRInputHandler: Activate grabbed weapon result: %s", activated ? "SUCCESS" : "FAILED");
+   ALOG_INFO("VRInputHandler: Activate grabbed weapon result: %s", activated ? "SUCCESS" : "FAILED");
  
       if (activated)
       {
@@ -1430,21 +1832,19 @@ m_leftHandCooldownTimer = 0.0f;
           weapEnch->enchantable.enchantment = cachedEnchantAuto;
       }
  EquipManager::s_suppressDrawSound = false;
-   _MESSAGE("VRInputHandler: Equipped weapon to %s game hand (silent)",
+   ALOG_INFO("VRInputHandler: Equipped weapon to %s game hand (silent)",
 isLeftGameHand ? "LEFT" : "RIGHT");
           
         // Start cooldown to prevent immediate collision detection re-triggering
    if (isLeftGameHand)
      {
-         m_leftHandOnCooldown = true;
-    m_leftHandCooldownTimer = 0.0f;
-  _MESSAGE("VRInputHandler: Started %.0fms cooldown for left hand", bladeReequipCooldown * 1000.0f);
+         StartReequipCooldown(true);
+  ALOG_INFO("VRInputHandler: Started %.0fms cooldown for left hand", bladeReequipCooldown * 1000.0f);
        }
         else
   {
-  m_rightHandOnCooldown = true;
-         m_rightHandCooldownTimer = 0.0f;
-             _MESSAGE("VRInputHandler: Started %.0fms cooldown for right hand", bladeReequipCooldown * 1000.0f);
+  StartReequipCooldown(false);
+             ALOG_INFO("VRInputHandler: Started %.0fms cooldown for right hand", bladeReequipCooldown * 1000.0f);
      }
     }
     }
@@ -1462,20 +1862,20 @@ isLeftGameHand ? "LEFT" : "RIGHT");
       if (m_autoEquipPendingRight && m_autoEquipWeaponRight)
         {
       // Right VR controller is holding grabbed weapon - check if LEFT game hand still has weapon
-       bool isLeftGameHand = VRControllerToGameHand(false);
+       bool isLeftGameHand = frame.ControllerToGameHand(false);
    bool otherHandHasWeapon = isLeftGameHand ? 
    equipState.rightHand.isEquipped : equipState.leftHand.isEquipped;
             
   if (!otherHandHasWeapon)
     {
-       _MESSAGE("VRInputHandler: Auto-equipCancelled for RIGHT VR hand - other hand no longer has weapon equipped");
+       ALOG_INFO("VRInputHandler: Auto-equipCancelled for RIGHT VR hand - other hand no longer has weapon equipped");
       m_autoEquipPendingRight = false;
       m_autoEquipTimerRight = 0.0f;
            m_autoEquipWeaponRight = nullptr;
  }
-     else if (!higgsInterface || higgsInterface->GetGrabbedObject(false) != m_autoEquipWeaponRight)
+     else if (!higgsInterface || frame.GrabbedByController(false) != m_autoEquipWeaponRight)
        {
-   _MESSAGE("VRInputHandler: Auto-equipCancelled for RIGHT VR hand - weapon no longer held");
+   ALOG_INFO("VRInputHandler: Auto-equipCancelled for RIGHT VR hand - weapon no longer held");
     m_autoEquipPendingRight = false;
       m_autoEquipTimerRight = 0.0f;
     m_autoEquipWeaponRight = nullptr;
@@ -1491,33 +1891,25 @@ isLeftGameHand ? "LEFT" : "RIGHT");
     // Blades are close (friction range) - reset timer
         if (m_autoEquipTimerRight > 0.0f)
          {
-                 static bool loggedResetRight = false;
-         if (!loggedResetRight)
-      {
-         _MESSAGE("VRInputHandler: Auto-equip timer reset (RIGHT) - grabbed weapon near equipped (dist: %.2f < %.2f)",
+         ALOG_CHANNEL(DEBUG, LogChannel::AutoEquipResetRight, "VRInputHandler: Auto-equip timer reset (RIGHT) - grabbed weapon near equipped (dist: %.2f < %.2f)",
       bladeDistance, bladeImminentThreshold);
-      loggedResetRight = true;
-          }
          }
   m_autoEquipTimerRight = 0.0f;
      }
                 else
        {
      // Blades are far enough apart - increment timer
-       static bool loggedResetRight = false;
-   loggedResetRight = false;  // Reset log flag when blades separate
-           
-          m_autoEquipTimerRight += deltaTime;
+          m_autoEquipTimerRight += frame.deltaTime;
        
       if (m_autoEquipTimerRight >= autoEquipGrabbedWeaponDelay)
               {
-    _MESSAGE("VRInputHandler: Auto-equiping grabbed weapon to RIGHT game hand after %.1f sec",
+    ALOG_INFO("VRInputHandler: Auto-equiping grabbed weapon to RIGHT game hand after %.1f sec",
     autoEquipGrabbedWeaponDelay);
   
           TESForm* weaponForm = m_autoEquipWeaponRight->baseForm;
         if (weaponForm)
        {
-         bool isLeftGameHand = VRControllerToGameHand(false);
+         bool isLeftGameHand = frame.ControllerToGameHand(false);
    
   PlayerCharacter* player = *g_thePlayer;
           if (player)
@@ -1526,7 +1918,7 @@ isLeftGameHand ? "LEFT" : "RIGHT");
          EquipManager::s_suppressPickupSound = true;
       bool activated = SafeActivate(m_autoEquipWeaponRight, player, 0, 0, 1, true);
          EquipManager::s_suppressPickupSound = false;
- _MESSAGE("VRInputHandler: Activate grabbed weapon result: %s", activated ? "SUCCESS" : "FAILED");
+ ALOG_INFO("VRInputHandler: Activate grabbed weapon result: %s", activated ? "SUCCESS" : "FAILED");
      
   if (activated)
    {
@@ -1553,21 +1945,19 @@ isLeftGameHand ? "LEFT" : "RIGHT");
        weapEnch2->enchantable.enchantment = cachedEnchantAuto2;
    }
   EquipManager::s_suppressDrawSound = false;
-           _MESSAGE("VRInputHandler: Equipped weapon to %s game hand (silent)",
+           ALOG_INFO("VRInputHandler: Equipped weapon to %s game hand (silent)",
    isLeftGameHand ? "LEFT" : "RIGHT");
      
        // Start cooldown to prevent immediate collision detection re-triggering
          if (isLeftGameHand)
   {
-            m_leftHandOnCooldown = true;
-           m_leftHandCooldownTimer = 0.0f;
-     _MESSAGE("VRInputHandler: Started %.0fms cooldown for left hand (auto-equip)", bladeReequipCooldown * 1000.0f);
+            StartReequipCooldown(true);
+     ALOG_INFO("VRInputHandler: Started %.0fms cooldown for left hand (auto-equip)", bladeReequipCooldown * 1000.0f);
         }
        else
   {
-           m_rightHandOnCooldown = true;
-    m_rightHandCooldownTimer = 0.0f;
-   _MESSAGE("VRInputHandler: Started %.0fms cooldown for right hand (auto-equip)", bladeReequipCooldown * 1000.0f);
+           StartReequipCooldown(false);
+   ALOG_INFO("VRInputHandler: Started %.0fms cooldown for right hand (auto-equip)", bladeReequipCooldown * 1000.0f);
       }
    }
    }
@@ -1589,8 +1979,13 @@ isLeftGameHand ? "LEFT" : "RIGHT");
     if (!tracker)
       return 9999.0f;
         
-      const BladeGeometry& leftGeom = tracker->GetBladeGeometry(true);
-  const BladeGeometry& rightGeom = tracker->GetBladeGeometry(false);
+        // Last published step - safe to call from any thread
+        WeaponGeometrySnapshot snapshot;
+        if (!tracker->GetSnapshot(snapshot))
+            return 9999.0f;
+        
+      const BladeGeometry& leftGeom = snapshot.geometry.leftHand;
+  const BladeGeometry& rightGeom = snapshot.geometry.rightHand;
  
         if (!leftGeom.isValid || !rightGeom.isValid)
             return 9999.0f;
@@ -1613,11 +2008,9 @@ isLeftGameHand ? "LEFT" : "RIGHT");
 
   float VRInputHandler::GetGrabbedToEquippedDistance(bool isLeftVRController) const
     {
-        // Get the HIGGS grabbed weapon position
-  if (!higgsInterface)
-        return 9999.0f;
-        
-        TESObjectREFR* grabbedWeapon = higgsInterface->GetGrabbedObject(isLeftVRController);
+        // Get the HIGGS grabbed weapon position (as of this step)
+        const FrameContext& frame = GetFrameContext();
+        TESObjectREFR* grabbedWeapon = frame.GrabbedByController(isLeftVRController);
         if (!grabbedWeapon)
     return 9999.0f;
      
@@ -1635,7 +2028,7 @@ isLeftGameHand ? "LEFT" : "RIGHT");
         
         // If left VR controller is grabbing, check against RIGHT hand equipped weapon
         // (Remember: left VR controller = left game hand in standard mode)
-        bool isLeftGameHand = VRControllerToGameHand(isLeftVRController);
+        bool isLeftGameHand = frame.ControllerToGameHand(isLeftVRController);
         const BladeGeometry& equippedGeom = tracker->GetBladeGeometry(!isLeftGameHand);
         
         if (!equippedGeom.isValid)
@@ -1654,33 +2047,33 @@ isLeftGameHand ? "LEFT" : "RIGHT");
         return sqrt(dx*dx + dy*dy + dz*dz);
     }
 
-    void VRInputHandler::OnStartTwoHanding()
+    void VRInputHandler::HandleStartTwoHanding()
     {
-        _MESSAGE("VRInputHandler: TWO-HANDING started");
+        ALOG_INFO("VRInputHandler: TWO-HANDING started");
 
         VRInputHandler* handler = GetSingleton();
         if (handler->IsListening())
         {
-  _MESSAGE("VRInputHandler:   Player is dual wielding and started two-handing a weapon");
+  ALOG_INFO("VRInputHandler:   Player is dual wielding and started two-handing a weapon");
      }
     }
 
-    void VRInputHandler::OnStopTwoHanding()
+    void VRInputHandler::HandleStopTwoHanding()
     {
-        _MESSAGE("VRInputHandler: TWO-HANDING stopped");
+        ALOG_INFO("VRInputHandler: TWO-HANDING stopped");
     }
 
     void VRInputHandler::OnShieldCollisionDetected()
     {
         if (!m_shieldCollisionActive)
      {
-            _MESSAGE("VRInputHandler: === RIGHT HAND WEAPON TOUCHING SHIELD ===");
+            ALOG_INFO("VRInputHandler: === RIGHT HAND WEAPON TOUCHING SHIELD ===");
         }
         m_shieldCollisionActive = true;
       m_timeSinceLastShieldCollision = 0.0f;
     }
 
-    void VRInputHandler::CheckShieldCollisionTimeout(float deltaTime)
+    void VRInputHandler::CheckShieldCollisionTimeout(const FrameContext& frame)
     {
         // Skip collision avoidance logic if in close combat mode
         if (m_closeCombatMode)
@@ -1691,7 +2084,7 @@ isLeftGameHand ? "LEFT" : "RIGHT");
   bool weaponHandIsLeft = !ShieldCollisionTracker::GetSingleton()->IsShieldInLeftHand();
  
 // Get the VR controller that corresponds to the weapon hand
-        bool weaponVRControllerIsLeft = GameHandToVRController(weaponHandIsLeft);
+        bool weaponVRControllerIsLeft = frame.GameHandToController(weaponHandIsLeft);
 
         if (!EquipManager::GetSingleton()->HasPendingReequip(weaponHandIsLeft))
         {
@@ -1704,7 +2097,7 @@ isLeftGameHand ? "LEFT" : "RIGHT");
         TESObjectREFR* droppedWeapon = EquipManager::GetSingleton()->GetDroppedWeaponRef(weaponHandIsLeft);
  if (!droppedWeapon)
         {
-         _MESSAGE("CheckShieldCollisionTimeout: Dropped weapon ref is NULL - clearing state");
+         ALOG_INFO("CheckShieldCollisionTimeout: Dropped weapon ref is NULL - clearing state");
    EquipManager::GetSingleton()->ClearPendingReequip(weaponHandIsLeft);
    EquipManager::GetSingleton()->ClearDroppedWeaponRef(weaponHandIsLeft);
      EquipManager::GetSingleton()->ClearCachedWeaponFormID(weaponHandIsLeft);
@@ -1716,7 +2109,7 @@ isLeftGameHand ? "LEFT" : "RIGHT");
    
   if (higgsInterface)
         {
-     TESObjectREFR* higgsHeld = higgsInterface->GetGrabbedObject(weaponVRControllerIsLeft);
+     TESObjectREFR* higgsHeld = frame.GrabbedByController(weaponVRControllerIsLeft);
  if (higgsHeld != droppedWeapon)
        {
             // HIGGS is not holding our weapon - but give it a few frames to actually grab
@@ -1731,13 +2124,13 @@ isLeftGameHand ? "LEFT" : "RIGHT");
     lastDroppedWeaponShield = droppedWeapon;
  }
       
-      higgsGrabWaitTimeShield += deltaTime;
+      higgsGrabWaitTimeShield += frame.deltaTime;
      
 // Only clear state if HIGGS hasn't grabbed after 0.3 seconds
     // This gives HIGGS time to actually grab the object
 if (higgsGrabWaitTimeShield >= 0.3f)
        {
-        _MESSAGE("CheckShieldCollisionTimeout: HIGGS not holding our weapon after 0.3s (held: %p, ours: %p) - clearing state",
+        ALOG_INFO("CheckShieldCollisionTimeout: HIGGS not holding our weapon after 0.3s (held: %p, ours: %p) - clearing state",
    higgsHeld, droppedWeapon);
          EquipManager::GetSingleton()->ClearPendingReequip(weaponHandIsLeft);
      EquipManager::GetSingleton()->ClearDroppedWeaponRef(weaponHandIsLeft);
@@ -1763,14 +2156,9 @@ static TESObjectREFR* lastDroppedWeaponShield = nullptr;
     float currentDistance = GetCurrentWeaponShieldDistance();
         bool weaponClose = (currentDistance < shieldReequipThreshold);
       
-     static int logCounter = 0;
-  logCounter++;
-        if (logCounter % 100 == 0)
- {
-  _MESSAGE("CheckShieldCollisionTimeout: Distance=%.2f, Threshold=%.2f, WeaponClose=%s, Timer=%.3f, Timeout=%.3f",
+  ALOG_CHANNEL(DEBUG, LogChannel::ShieldCollisionTimeout, "CheckShieldCollisionTimeout: Distance=%.2f, Threshold=%.2f, WeaponClose=%s, Timer=%.3f, Timeout=%.3f",
       currentDistance, shieldReequipThreshold, weaponClose ? "YES" : "NO", 
     m_timeSinceLastShieldCollision, shieldCollisionTimeout);
-    }
         
   if (weaponClose)
     {
@@ -1779,13 +2167,13 @@ static TESObjectREFR* lastDroppedWeaponShield = nullptr;
      }
         else
     {
-m_timeSinceLastShieldCollision += deltaTime;
+m_timeSinceLastShieldCollision += frame.deltaTime;
       
     if (m_timeSinceLastShieldCollision >= shieldCollisionTimeout)
        {
      m_shieldCollisionActive = false;
-       _MESSAGE("VRInputHandler: === %s HAND WEAPON SAFE TO RE-EQUIP ===", weaponHandIsLeft ? "LEFT" : "RIGHT");
-       _MESSAGE("VRInputHandler: Time separated: %.2f sec, Distance: %.2f (threshold: %.2f)", 
+       ALOG_INFO("VRInputHandler: === %s HAND WEAPON SAFE TO RE-EQUIP ===", weaponHandIsLeft ? "LEFT" : "RIGHT");
+       ALOG_INFO("VRInputHandler: Time separated: %.2f sec, Distance: %.2f (threshold: %.2f)", 
  m_timeSinceLastShieldCollision, currentDistance, shieldReequipThreshold);
   
      droppedWeapon = EquipManager::GetSingleton()->GetDroppedWeaponRef(weaponHandIsLeft);
@@ -1798,8 +2186,8 @@ m_timeSinceLastShieldCollision += deltaTime;
             {
       // For dual-wield same weapon: DON'T activate (which would add duplicate to inventory)
   // The re-equip will use the existing inventory item via cached FormID
-   _MESSAGE("VRInputHandler: Dual-wield same weapon - SKIPPING activation (will re-equip from existing inventory)");
-      _MESSAGE("VRInputHandler: Deleting spawned weapon (RefID: %08X) from world", droppedWeapon->formID);
+   ALOG_INFO("VRInputHandler: Dual-wield same weapon - SKIPPING activation (will re-equip from existing inventory)");
+      ALOG_INFO("VRInputHandler: Deleting spawned weapon (RefID: %08X) from world", droppedWeapon->formID);
            
          // Delete the spawned world object so it doesn't accumulate on the ground
  DeleteWorldObject(droppedWeapon);
@@ -1807,7 +2195,7 @@ m_timeSinceLastShieldCollision += deltaTime;
           else
             {
  // Normal case (different weapons): activate to add to inventory
-         _MESSAGE("VRInputHandler: Activating grabbed RIGHT weapon to add to inventory (RefID: %08X, BaseID: %08X)...",
+         ALOG_INFO("VRInputHandler: Activating grabbed RIGHT weapon to add to inventory (RefID: %08X, BaseID: %08X)...",
          droppedWeapon->formID, droppedWeapon->baseForm->formID);
      
                 PlayerCharacter* player = *g_thePlayer;
@@ -1817,13 +2205,13 @@ m_timeSinceLastShieldCollision += deltaTime;
           EquipManager::s_suppressPickupSound = true;
       bool activated = SafeActivate(droppedWeapon, player, 0, 0, 1, false);
            EquipManager::s_suppressPickupSound = false;
-        _MESSAGE("VRInputHandler: Activate result: %s", activated ? "SUCCESS" : "FAILED");
+        ALOG_INFO("VRInputHandler: Activate result: %s", activated ? "SUCCESS" : "FAILED");
       }
             }
         }
         else
     {
-   _MESSAGE("VRInputHandler: WARNING - Dropped weapon ref became invalid before activation!");
+   ALOG_WARN("VRInputHandler: WARNING - Dropped weapon ref became invalid before activation!");
     }
    
       // Clear the dropped weapon ref but KEEP the cached FormID for re-equip!
@@ -1833,24 +2221,24 @@ m_timeSinceLastShieldCollision += deltaTime;
       // Also clear PendingReequip so CheckShieldCollisionTimeout doesn't clear cached FormID
       EquipManager::GetSingleton()->ClearPendingReequip(weaponHandIsLeft);
 
-      m_pendingReequipRight = true;
-      m_pendingReequipRightTimer = 0.0f;
-      _MESSAGE("VRInputHandler: Scheduled re-equip for %s hand in %.1f ms", weaponHandIsLeft ? "LEFT" : "RIGHT", shieldReequipDelay *  1000.0f);
+      SchedulePendingReequipRight();
+      ALOG_INFO("VRInputHandler: Scheduled re-equip for %s hand in %.1f ms", weaponHandIsLeft ? "LEFT" : "RIGHT", shieldReequipDelay *  1000.0f);
   }
         }
     }
 
 float VRInputHandler::GetCurrentWeaponShieldDistance() const
     {
-        // Determine weapon hand based on handedness mode
-        bool weaponHandIsLeft = IsLeftHandedMode();
-     bool weaponVRControllerIsLeft = GameHandToVRController(weaponHandIsLeft);
+        // Determine weapon hand based on handedness mode (as of this step)
+        const FrameContext& frame = GetFrameContext();
+        bool weaponHandIsLeft = frame.leftHandedMode;
+     bool weaponVRControllerIsLeft = frame.GameHandToController(weaponHandIsLeft);
         
  // First, check if we have a HIGGS-grabbed weapon (shield collision case)
    TESObjectREFR* droppedWeapon = EquipManager::GetSingleton()->GetDroppedWeaponRef(weaponHandIsLeft);
-   if (droppedWeapon && higgsInterface)
+   if (droppedWeapon)
   {
-       TESObjectREFR* higgsHeld = higgsInterface->GetGrabbedObject(weaponVRControllerIsLeft);
+       TESObjectREFR* higgsHeld = frame.GrabbedByController(weaponVRControllerIsLeft);
     if (higgsHeld == droppedWeapon)
    {
         // Get position of HIGGS grabbed weapon
@@ -1860,17 +2248,10 @@ float VRInputHandler::GetCurrentWeaponShieldDistance() const
         NiPoint3 weaponPos = weaponNode->m_worldTransform.pos;
        
       // Get shield position from player's left hand
-   PlayerCharacter* player = *g_thePlayer;
-       if (player)
- {
-          NiNode* rootNode = player->GetNiRootNode(0);
-   if (!rootNode)
-        rootNode = player->GetNiRootNode(1);
-           
+        NiNode* rootNode = frame.rootNode;
         if (rootNode)
      {
-    BSFixedString shieldNodeStr("SHIELD");
-         NiAVObject* shieldNode = rootNode->GetObjectByName(&shieldNodeStr.data);
+         NiAVObject* shieldNode = NodeCache::GetSingleton()->Find(rootNode, "SHIELD");
        if (shieldNode)
        {
      NiPoint3 shieldPos = shieldNode->m_worldTransform.pos;
@@ -1880,7 +2261,6 @@ float VRInputHandler::GetCurrentWeaponShieldDistance() const
         float dz = weaponPos.z - shieldPos.z;
         return sqrt(dx*dx + dy*dy + dz*dz);
   }
-   }
    }
     }
     }
@@ -1918,7 +2298,7 @@ shieldCenter.y = (shieldGeom.basePosition.y + shieldGeom.tipPosition.y) * 0.5f;
     }
     void VRInputHandler::ClearAllState()
     {
-   _MESSAGE("VRInputHandler: Clearing all tracking state");
+   ALOG_INFO("VRInputHandler: Clearing all tracking state");
         
         m_higgsCollisionActive = false;
         m_wasHiggsCollisionActive = false;
@@ -1928,15 +2308,19 @@ shieldCenter.y = (shieldGeom.basePosition.y + shieldGeom.tipPosition.y) * 0.5f;
         m_wasShieldCollisionActive = false;
         m_timeSinceLastShieldCollision = 0.0f;
         
+        // Drops every pending cooldown, re-equip and shield bash timer
+        m_timers.Clear();
+        m_reequipTimers.Clear();
+        
         m_pendingReequip = false;
         m_pendingReequipIsLeft = false;
-    m_pendingReequipTimer = 0.0f;
+    m_pendingReequipTimer = 0;
  
         m_pendingReequipRight = false;
-  m_pendingReequipRightTimer = 0.0f;
+  m_pendingReequipRightTimer = 0;
       
-        m_leftHandCooldownTimer = 0.0f;
-        m_rightHandCooldownTimer = 0.0f;
+        m_leftHandCooldownTimer = 0;
+        m_rightHandCooldownTimer = 0;
     m_leftHandOnCooldown = false;
      m_rightHandOnCooldown = false;
         
@@ -1956,9 +2340,10 @@ m_autoEquipTimerRight = 0.0f;
    
         // Clear shield bash tracking completely on death/load
         m_shieldBashCount = 0;
-        m_shieldBashWindowTimer = 0.0f;
+        m_shieldBashWindowTimer = 0;
         m_shieldBashLockoutActive = false;
-        m_shieldBashLockoutTimer = 0.0f;
+        m_shieldBashLockoutTimer = 0;
+        m_shieldBashLockoutLogTimer = 0;
     
       EquipManager::GetSingleton()->ClearDroppedWeaponRef(true);
         EquipManager::GetSingleton()->ClearDroppedWeaponRef(false);
@@ -1967,7 +2352,14 @@ m_autoEquipTimerRight = 0.0f;
         EquipManager::GetSingleton()->ClearCachedWeaponFormID(true);
 EquipManager::GetSingleton()->ClearCachedWeaponFormID(false);
         
-   _MESSAGE("VRInputHandler: All tracking state cleared");
+        // Death/load rebuilds the player's 3D (and a load can bring different weapon meshes)
+        NodeCache::GetSingleton()->Invalidate();
+        WeaponGeometryTracker::GetSingleton()->ClearBladeProfiles();
+        
+        // Once-only diagnostics log again for the new session
+        ResetLogChannels();
+        
+   ALOG_INFO("VRInputHandler: All tracking state cleared");
     }
 
     float VRInputHandler::GetGrabbedWeaponVelocity(bool isLeftGameHand) const
@@ -1976,7 +2368,12 @@ EquipManager::GetSingleton()->ClearCachedWeaponFormID(false);
         if (!tracker)
        return 0.0f;
         
-     const BladeGeometry& geom = tracker->GetBladeGeometry(isLeftGameHand);
+        // Last published step - safe to call from any thread
+        WeaponGeometrySnapshot snapshot;
+        if (!tracker->GetSnapshot(snapshot))
+            return 0.0f;
+        
+     const BladeGeometry& geom = isLeftGameHand ? snapshot.geometry.leftHand : snapshot.geometry.rightHand;
         if (!geom.isValid)
 return 0.0f;
         
@@ -2034,11 +2431,11 @@ vr_1_0_12::VRControllerState_t leftState;
 // Log state changes
             if (s_leftTriggerPressed && !s_leftTriggerWasPressed)
    {
-                _MESSAGE("VRInputHandler: LEFT TRIGGER PRESSED");
+                ALOG_INFO("VRInputHandler: LEFT TRIGGER PRESSED");
             }
        else if (!s_leftTriggerPressed && s_leftTriggerWasPressed)
   {
-      _MESSAGE("VRInputHandler: LEFT TRIGGER RELEASED");
+      ALOG_INFO("VRInputHandler: LEFT TRIGGER RELEASED");
             }
         }
  
@@ -2052,11 +2449,11 @@ vr_1_0_12::VRControllerState_t leftState;
             // Log state changes
       if (s_rightTriggerPressed && !s_rightTriggerWasPressed)
             {
-  _MESSAGE("VRInputHandler: RIGHT TRIGGER PRESSED");
+  ALOG_INFO("VRInputHandler: RIGHT TRIGGER PRESSED");
       }
             else if (!s_rightTriggerPressed && s_rightTriggerWasPressed)
    {
-            _MESSAGE("VRInputHandler: RIGHT TRIGGER RELEASED");
+            ALOG_INFO("VRInputHandler: RIGHT TRIGGER RELEASED");
      }
    }
     }
@@ -2077,7 +2474,7 @@ vr_1_0_12::VRControllerState_t leftState;
     void VRInputHandler::RegisterTriggerCallback()
     {
      // Trigger polling is now done in OnPrePhysicsStep, no separate registration needed
-      _MESSAGE("VRInputHandler: Trigger button tracking initialized (polled in OnPrePhysicsStep)");
+      ALOG_INFO("VRInputHandler: Trigger button tracking initialized (polled in OnPrePhysicsStep)");
     }
 }
 
@@ -4,6 +4,9 @@
 #include "skse64/PapyrusEvents.h"
 #include "higgsinterface001.h"
 #include "EquipManager.h"
+#include "FrameContext.h"
+#include "FrameScheduler.h"
+#include "TimerWheel.h"
 #include "config.h"
 
 namespace FalseEdgeVR
@@ -39,14 +42,14 @@ return isLeftGameHand ? m_leftHandOnCooldown : m_rightHandOnCooldown;
         }
         
         // Check and update auto-equip for grabbed weapons
-    void CheckAutoEquipGrabbedWeapon(float deltaTime);
+    void CheckAutoEquipGrabbedWeapon(const FrameContext& frame);
 
         // Pause/resume VR tracking (used when pause menus are open)
         void PauseTracking(bool pause);
         bool IsPaused() const { return m_paused; }
 
-        // Combat tracking
-        void UpdateCombatTracking();
+        // Combat tracking (elapsed = seconds since the last update; runs below physics rate)
+        void UpdateCombatTracking(float elapsed);
         bool IsPlayerInCombat() const { return m_isInCombat; }
         float GetClosestTargetDistance() const { return m_closestTargetDistance; }
         bool IsInCloseCombatMode() const { return m_closeCombatMode; }
@@ -56,7 +59,6 @@ return isLeftGameHand ? m_leftHandOnCooldown : m_rightHandOnCooldown;
         
         // Shield bash tracking
     void OnShieldBash();
-        void UpdateShieldBashTracking(float deltaTime);
      bool IsShieldBashLockoutActive() const { return m_shieldBashLockoutActive; }
         int GetShieldBashCount() const { return m_shieldBashCount; }
         
@@ -81,20 +83,20 @@ return isLeftGameHand ? m_leftHandOnCooldown : m_rightHandOnCooldown;
         // Register the trigger callback with PapyrusVR
         static void RegisterTriggerCallback();
    
-        // Get the velocity of a grabbed weapon (from geometry tracker)
+        // Get the velocity of a grabbed weapon (from the geometry snapshot - any thread)
  float GetGrabbedWeaponVelocity(bool isLeftGameHand) const;
  
         // Track HIGGS collision state for grabbed weapons (left hand - blade vs blade)
         void OnHiggsCollisionDetected(bool isLeft);
         bool IsHiggsCollisionActive() const { return m_higgsCollisionActive; }
-        void CheckCollisionTimeout(float deltaTime);
+        void CheckCollisionTimeout(const FrameContext& frame);
    
    // Track shield collision state (right hand weapon vs shield)
         void OnShieldCollisionDetected();
         bool IsShieldCollisionActive() const { return m_shieldCollisionActive; }
-        void CheckShieldCollisionTimeout(float deltaTime);
+        void CheckShieldCollisionTimeout(const FrameContext& frame);
         
-        // Get current blade distance (from geometry tracker)
+        // Get current blade distance (from the geometry snapshot - any thread)
         float GetCurrentBladeDistance() const;
         
 // Get distance from HIGGS grabbed weapon to equipped weapon in other hand
@@ -103,8 +105,11 @@ return isLeftGameHand ? m_leftHandOnCooldown : m_rightHandOnCooldown;
      // Get current weapon-shield distance
  float GetCurrentWeaponShieldDistance() const;
      
-        // Check for pending re-equip after activation
-   void CheckPendingReequip(float deltaTime);
+        // Advance the step clock of the cooldown/shield bash timers (fires the ones that expire)
+        void AdvanceTimers(float deltaTime);
+        
+        // Advance the step clock of the pending re-equip delays (fires the ones that expire)
+        void AdvanceReequipTimers(float deltaTime);
       
     private:
         VRInputHandler() = default;
@@ -120,11 +125,79 @@ return isLeftGameHand ? m_leftHandOnCooldown : m_rightHandOnCooldown;
         static void OnStartTwoHanding();
      static void OnStopTwoHanding();
         static void OnPrePhysicsStep(void* world);
+        static void OnPostVrikPostHiggs();
+        
+        // Blade/shield pose sampling and the collision decisions on it (m_poseScheduler),
+        // then the pose-to-decision latency sample
+        void RunPoseTasks(const FrameContext& frame);
+        void RecordPoseLatency();
+        
+        // Queued-event handlers - run from DrainGameEvents on the physics step
+        static void HandleGrabbed(bool isLeft, TESObjectREFR* grabbedRefr);
+        static void HandleDropped(bool isLeft, TESObjectREFR* droppedRefr);
+        static void HandlePulled(bool isLeft, TESObjectREFR* pulledRefr);
+        static void HandleCollision(bool isLeft, float mass, float separatingVelocity);
+        static void HandleStartTwoHanding();
+        static void HandleStopTwoHanding();
+        
+        // Apply the events queued by sinks and HIGGS callbacks since the last step
+        void DrainGameEvents();
+        
+        // Register the per-step subsystems with m_scheduler and m_poseScheduler
+        void RegisterFrameTasks();
+        
+        // Timer helpers - start/cancel a timer together with the flag it drives
+        void StartReequipCooldown(bool isLeftGameHand);
+        void SchedulePendingReequip(bool isLeftGameHand);
+        void CancelPendingReequip();
+        void SchedulePendingReequipRight();
+        void CancelPendingReequipRight();
+        
+        // Timer callbacks (context = the handler)
+        static void OnLeftCooldownExpired(void* context);
+        static void OnRightCooldownExpired(void* context);
+        static void OnPendingReequipExpired(void* context);
+        static void OnPendingReequipRightExpired(void* context);
+        static void OnShieldBashWindowExpired(void* context);
+        static void OnShieldBashLockoutExpired(void* context);
+        static void OnShieldBashLockoutLog(void* context);
     
         bool m_initialized = false;
         bool m_callbacksRegistered = false;
         bool m_isListening = false;
         bool m_paused = false; // When true, per-frame tracking updates are suspended
+        
+        // Step interval bookkeeping (time comes from GetStepClock())
+        static constexpr float kMaxStepInterval = 0.1f;      // Longer gaps (hitch, load) count as this
+        static constexpr float kMinStepInterval = 0.0001f;
+        double m_lastStepTime = 0.0;
+        bool m_hasLastStepTime = false;
+        double m_lastPosePhaseTime = 0.0;      // Last post-VRIK/post-HIGGS run that sampled poses
+        bool m_hasLastPosePhaseTime = false;
+        
+        // Per-step subsystems, their order and rates
+        FrameScheduler m_scheduler;
+        int m_combatTrackingTask = -1;
+        
+        // Pose-driven subsystems (weapon geometry, shield collision), run in the phase set by geometryPhase
+        FrameScheduler m_poseScheduler{ "PoseScheduler" };
+        bool m_postVrikCallbackRegistered = false;
+        
+        // Pose-to-decision latency: time from VRIK/HIGGS placing the hands to the collision
+        // decisions that used those poses
+        double m_lastHandPlacementTime = 0.0;
+        bool m_hasHandPlacementTime = false;
+        double m_poseLatencyTotalMs = 0.0;
+        double m_poseLatencyMaxMs = 0.0;
+        UInt32 m_poseLatencySamples = 0;
+        double m_poseLatencyWindowStart = 0.0;
+        
+        // Cooldowns and shield bash window/lockout, on the step clock
+        TimerWheel m_timers;
+        
+        // Pending re-equip delays. Advanced after the collision timeouts that schedule them, so
+        // a delay shorter than a step still fires in the step that scheduled it.
+        TimerWheel m_reequipTimers;
      
         // Combat tracking state
   bool m_isInCombat = false;
@@ -138,8 +211,10 @@ UInt32 m_closestTargetHandle = 0;
     
         // Shield bash tracking
 int m_shieldBashCount = 0;
-        float m_shieldBashWindowTimer = 0.0f;      // Time since first bash in current window
-      float m_shieldBashLockoutTimer = 0.0f;    // Lockout timer after 3 bashes
+        TimerHandle m_shieldBashWindowTimer = 0;    // Ends the current bash window
+        double m_shieldBashWindowStart = 0.0;       // Step clock at the first bash of the window
+      TimerHandle m_shieldBashLockoutTimer = 0;   // Ends the lockout after 3 bashes
+        TimerHandle m_shieldBashLockoutLogTimer = 0; // Lockout progress log (every 30 sec)
         bool m_shieldBashLockoutActive = false;
         static constexpr float kShieldBashWindow = 6.0f;   // 6 second window for 3 bashes
         static constexpr float kShieldBashLockout = 240.0f;   // 4 minute lockout (240 seconds)
@@ -162,15 +237,15 @@ int m_shieldBashCount = 0;
  // Pending re-equip tracking (for left hand - blade collision)
      bool m_pendingReequip = false;
         bool m_pendingReequipIsLeft = false;
-  float m_pendingReequipTimer = 0.0f;
+  TimerHandle m_pendingReequipTimer = 0;
         
         // Pending re-equip tracking (for right hand - shield collision)
         bool m_pendingReequipRight = false;
-        float m_pendingReequipRightTimer = 0.0f;
+        TimerHandle m_pendingReequipRightTimer = 0;
  
       // Cooldown tracking to prevent rapid unequip/re-equip cycles
-float m_leftHandCooldownTimer = 0.0f;
-        float m_rightHandCooldownTimer = 0.0f;
+TimerHandle m_leftHandCooldownTimer = 0;
+        TimerHandle m_rightHandCooldownTimer = 0;
         bool m_leftHandOnCooldown = false;
         bool m_rightHandOnCooldown = false;
         
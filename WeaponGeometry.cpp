@@ -3,13 +3,220 @@
 #include "EquipManager.h"
 #include "VRInputHandler.h"
 #include "config.h"
+#include "NodeCache.h"
+#include "AsyncLog.h"
+#include "LogChannel.h"
 #include "skse64/GameRTTI.h"
 #include "skse64/NiNodes.h"
+#include "skse64/NiGeometry.h"
 #include <cmath>
 #include <cfloat>
+#include <cstring>
 
 namespace FalseEdgeVR
 {
+    // Blade profile sanity limits (unscaled units) - outside these the bounds are not a blade
+    static const float MIN_PROFILE_BLADE_LENGTH = 5.0f;
+    static const float MAX_PROFILE_BLADE_LENGTH = 250.0f;
+    
+    // Steps to keep retrying the mesh bounds before settling for the reach heuristic,
+    // then seconds between further reads in case the 3D loads later
+    static const UInt8 MAX_PROFILE_MESH_ATTEMPTS = 30;
+    static const float PROFILE_MESH_RETRY_INTERVAL = 5.0f;
+
+    // ============================================
+    // Node-Local Bounds
+    // ============================================
+
+    NiPoint3 LocalToWorld(const NiTransform& frame, const NiPoint3& local)
+    {
+        const NiMatrix33& rot = frame.rot;
+        return NiPoint3(
+            frame.pos.x + (rot.data[0][0] * local.x + rot.data[0][1] * local.y + rot.data[0][2] * local.z) * frame.scale,
+            frame.pos.y + (rot.data[1][0] * local.x + rot.data[1][1] * local.y + rot.data[1][2] * local.z) * frame.scale,
+            frame.pos.z + (rot.data[2][0] * local.x + rot.data[2][1] * local.y + rot.data[2][2] * local.z) * frame.scale);
+    }
+
+    NiPoint3 WorldToLocal(const NiTransform& frame, const NiPoint3& world)
+    {
+        const NiMatrix33& rot = frame.rot;
+        float invScale = (frame.scale > 0.0001f) ? 1.0f / frame.scale : 1.0f;
+        NiPoint3 d(world.x - frame.pos.x, world.y - frame.pos.y, world.z - frame.pos.z);
+        return NiPoint3(
+            (rot.data[0][0] * d.x + rot.data[1][0] * d.y + rot.data[2][0] * d.z) * invScale,
+            (rot.data[0][1] * d.x + rot.data[1][1] * d.y + rot.data[2][1] * d.z) * invScale,
+            (rot.data[0][2] * d.x + rot.data[1][2] * d.y + rot.data[2][2] * d.z) * invScale);
+    }
+
+    static void CollectLocalBounds(NiAVObject* object, const NiTransform& frame, int depth,
+        LocalBoundSphere* outBounds, int capacity, int& count)
+    {
+        if (!object || depth > 8 || count >= capacity)
+            return;
+        
+        if (object->m_name && strstr(object->m_name, "Scb"))
+            return;
+        
+        NiNode* node = object->GetAsNiNode();
+        if (node)
+        {
+            for (UInt32 i = 0; i < node->m_children.m_emptyRunStart; i++)
+                CollectLocalBounds(node->m_children.m_data[i], frame, depth + 1, outBounds, capacity, count);
+            return;
+        }
+        
+        // Leaf geometry - world bound sphere
+        WorldBound worldBound = GetWorldBound(object);
+        if (worldBound.radius <= 0.0f)
+            return;
+        
+        LocalBoundSphere& bound = outBounds[count++];
+        bound.center = WorldToLocal(frame, worldBound.center);
+        bound.radius = (frame.scale > 0.0001f) ? worldBound.radius / frame.scale : worldBound.radius;
+    }
+    
+    int CollectLocalBounds(NiAVObject* root, LocalBoundSphere* outBounds, int capacity)
+    {
+        int count = 0;
+        if (root)
+            CollectLocalBounds(root, root->m_worldTransform, 0, outBounds, capacity, count);
+        return count;
+    }
+    
+    // IEEE half -> float (half-precision vertex positions)
+    static float HalfToFloat(UInt16 half)
+    {
+        UInt32 sign = (UInt32)(half & 0x8000) << 16;
+        UInt32 exponent = (half >> 10) & 0x1F;
+        UInt32 mantissa = half & 0x3FF;
+        UInt32 bits;
+        if (exponent == 0)
+        {
+            // Zero or subnormal - renormalize
+            if (mantissa == 0)
+            {
+                bits = sign;
+            }
+            else
+            {
+                exponent = 113;
+                while (!(mantissa & 0x400))
+                {
+                    mantissa <<= 1;
+                    exponent--;
+                }
+                bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+            }
+        }
+        else if (exponent == 31)
+        {
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        }
+        else
+        {
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    
+    // Vertex descriptor (BSVertexDesc): the low nibble is the vertex stride in 4-byte units and
+    // the attribute flags start at bit 44. Position is the first attribute, three floats with
+    // VF_FULLPREC and three halves without.
+    static const UInt64 VERTEX_DESC_STRIDE_MASK = 0xF;
+    static const int VERTEX_DESC_FLAGS_SHIFT = 44;
+    static const UInt16 VERTEX_FLAG_POSITION = 1 << 0;
+    static const UInt16 VERTEX_FLAG_FULLPREC = 1 << 10;
+    
+    static void CollectLocalVertexExtents(NiAVObject* object, const NiTransform& frame, int depth,
+        NiPoint3& ioMin, NiPoint3& ioMax, bool& ioFound)
+    {
+        if (!object || depth > 8)
+            return;
+        
+        if (object->m_name && strstr(object->m_name, "Scb"))
+            return;
+        
+        NiNode* node = object->GetAsNiNode();
+        if (node)
+        {
+            for (UInt32 i = 0; i < node->m_children.m_emptyRunStart; i++)
+                CollectLocalVertexExtents(node->m_children.m_data[i], frame, depth + 1, ioMin, ioMax, ioFound);
+            return;
+        }
+        
+        // Skinned vertices live in the skin partition, in bone space - only static shapes are read
+        BSTriShape* triShape = object->GetAsBSTriShape();
+        if (!triShape || triShape->m_spSkinInstance || !triShape->geometryData)
+            return;
+        
+        BSGeometryData::VertexData* vertexData = triShape->geometryData->vertexData;
+        if (!vertexData || !vertexData->vertexBlock)
+            return;
+        
+        UInt64 vertexDesc = triShape->vertexDesc;
+        UInt32 stride = (UInt32)(vertexDesc & VERTEX_DESC_STRIDE_MASK) * 4;
+        UInt16 flags = (UInt16)(vertexDesc >> VERTEX_DESC_FLAGS_SHIFT);
+        if (stride == 0 || !(flags & VERTEX_FLAG_POSITION))
+            return;
+        
+        bool fullPrecision = (flags & VERTEX_FLAG_FULLPREC) != 0;
+        const UInt8* vertex = vertexData->vertexBlock;
+        for (UInt32 i = 0; i < triShape->numVertices; i++, vertex += stride)
+        {
+            NiPoint3 position;
+            if (fullPrecision)
+            {
+                memcpy(&position, vertex, sizeof(NiPoint3));
+            }
+            else
+            {
+                UInt16 half[3];
+                memcpy(half, vertex, sizeof(half));
+                position = NiPoint3(HalfToFloat(half[0]), HalfToFloat(half[1]), HalfToFloat(half[2]));
+            }
+            
+            NiPoint3 local = WorldToLocal(frame, LocalToWorld(object->m_worldTransform, position));
+            ioMin.x = (local.x < ioMin.x) ? local.x : ioMin.x;
+            ioMin.y = (local.y < ioMin.y) ? local.y : ioMin.y;
+            ioMin.z = (local.z < ioMin.z) ? local.z : ioMin.z;
+            ioMax.x = (local.x > ioMax.x) ? local.x : ioMax.x;
+            ioMax.y = (local.y > ioMax.y) ? local.y : ioMax.y;
+            ioMax.z = (local.z > ioMax.z) ? local.z : ioMax.z;
+            ioFound = true;
+        }
+    }
+    
+    bool CollectLocalVertexExtents(NiAVObject* root, NiPoint3& outMin, NiPoint3& outMax)
+    {
+        outMin = NiPoint3(FLT_MAX, FLT_MAX, FLT_MAX);
+        outMax = NiPoint3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        bool found = false;
+        if (root)
+            CollectLocalVertexExtents(root, root->m_worldTransform, 0, outMin, outMax, found);
+        return found;
+    }
+    
+    // Keeps the bound that reaches furthest along the blade axis (local +Y of the weapon node).
+    // ioTipOffset gets that bound's far point.
+    static void FindBladeTipExtent(NiAVObject* weaponNode, float& ioTipExtent, NiPoint3& ioTipOffset)
+    {
+        LocalBoundSphere bounds[MAX_LOCAL_BOUNDS];
+        int count = CollectLocalBounds(weaponNode, bounds, MAX_LOCAL_BOUNDS);
+        
+        for (int i = 0; i < count; i++)
+        {
+            const LocalBoundSphere& bound = bounds[i];
+            float extent = bound.center.y + bound.radius;
+            if (extent > ioTipExtent)
+            {
+                ioTipExtent = extent;
+                ioTipOffset = NiPoint3(bound.center.x, extent, bound.center.z);
+            }
+        }
+    }
+
     // ============================================
     // WeaponGeometryTracker Implementation
     // ============================================
@@ -25,7 +232,7 @@ namespace FalseEdgeVR
   if (m_initialized)
         return;
 
-        LOG("WeaponGeometryTracker: Initializing...");
+        ALOG_WARN("WeaponGeometryTracker: Initializing...");
         
 m_geometryState.leftHand.Clear();
         m_geometryState.rightHand.Clear();
@@ -38,41 +245,47 @@ m_geometryState.leftHand.Clear();
         m_collisionThreshold = bladeCollisionThreshold;
       m_imminentThreshold = bladeImminentThreshold;
   
-_MESSAGE("WeaponGeometryTracker: Collision threshold: %.2f, Imminent threshold: %.2f", 
+ALOG_INFO("WeaponGeometryTracker: Collision threshold: %.2f, Imminent threshold: %.2f", 
     m_collisionThreshold, m_imminentThreshold);
    
         m_initialized = true;
-LOG("WeaponGeometryTracker: Initialized successfully");
+ALOG_WARN("WeaponGeometryTracker: Initialized successfully");
     }
 
-    void WeaponGeometryTracker::Update(float deltaTime)
+    void WeaponGeometryTracker::Update(const FrameContext& frame)
     {
-   static int updateCount = 0;
- static bool loggedOnce = false;
-        
         if (!m_initialized)
       return;
 
-     updateCount++;
+        m_lastDeltaTime = frame.deltaTime;
+        m_motionTime += frame.deltaTime;
+        m_stepCollision.Clear();
+        m_stepPairTest = PairTestResult::NotTested;
  
  // Log once to confirm update is being called
-        if (!loggedOnce)
-   {
-       _MESSAGE("WeaponGeometryTracker::Update - First update call!");
-loggedOnce = true;
-        }
+        ALOG_CHANNEL(DEBUG, LogChannel::GeometryFirstUpdate, "WeaponGeometryTracker::Update - First update call!");
 
-        PlayerCharacter* player = *g_thePlayer;
-        if (!player || !player->loadedState)
-    return;
+        if (!frame.HasPlayer())
+        {
+            // No player (main menu, loading) - readers shouldn't keep seeing the last blades
+            m_geometryState.leftHand.Clear();
+            m_geometryState.rightHand.Clear();
+            m_bladesInContact = false;
+            m_collisionImminent = false;
+            m_wasInContact = false;
+            m_wasImminent = false;
+            m_gapLowerBound = -FLT_MAX;
+            PublishSnapshot();
+            return;
+        }
 
       const PlayerEquipState& equipState = EquipManager::GetSingleton()->GetEquipState();
       
         // DIRECT check for shields - more reliable than EquipManager state
-   TESForm* leftEquipped = player->GetEquippedObject(true);
-   TESForm* rightEquipped = player->GetEquippedObject(false);
-        bool leftIsShield = leftEquipped && EquipManager::IsShield(leftEquipped);
- bool rightIsShield = rightEquipped && EquipManager::IsShield(rightEquipped);
+   TESForm* leftEquipped = frame.leftEquipped;
+   TESForm* rightEquipped = frame.rightEquipped;
+        bool leftIsShield = frame.leftIsShield;
+ bool rightIsShield = frame.rightIsShield;
         
         // Check for equipment changes - reset grace period if weapons changed
         // Note: Ignore shields - they are handled by ShieldCollisionTracker
@@ -81,10 +294,10 @@ loggedOnce = true;
     
      if (currentLeftFormID != m_lastLeftWeaponFormID || currentRightFormID != m_lastRightWeaponFormID)
    {
-        _MESSAGE("WeaponGeometryTracker: Equipment changed! Left: %08X->%08X, Right: %08X->%08X",
+        ALOG_INFO("WeaponGeometryTracker: Equipment changed! Left: %08X->%08X, Right: %08X->%08X",
     m_lastLeftWeaponFormID, currentLeftFormID,
     m_lastRightWeaponFormID, currentRightFormID);
-     _MESSAGE("WeaponGeometryTracker: Starting %d frame grace period before collision detection", equipGraceFrames);
+     ALOG_INFO("WeaponGeometryTracker: Starting %d frame grace period before collision detection", equipGraceFrames);
             
             m_lastLeftWeaponFormID = currentLeftFormID;
    m_lastRightWeaponFormID = currentRightFormID;
@@ -97,6 +310,7 @@ m_framesSinceEquipChange = 0;
   m_wasInContact = false;
     m_collisionImminent = false;
             m_wasImminent = false;
+            m_gapLowerBound = -FLT_MAX;
  }
  
         // Increment frame counter
@@ -104,21 +318,17 @@ m_framesSinceEquipChange = 0;
         
    // Check if off-hand has HIGGS-grabbed weapon (from our collision avoidance)
 // Off-hand is LEFT in right-handed mode, RIGHT in left-handed mode
-   bool offHandIsLeft = !IsLeftHandedMode();
-   bool offHandVRControllerIsLeft = GameHandToVRController(offHandIsLeft);
+   bool offHandIsLeft = frame.OffHandIsLeft();
+   bool offHandVRControllerIsLeft = frame.GameHandToController(offHandIsLeft);
    bool offHandHiggsGrabbed = false;
    TESObjectREFR* higgsHeldOffHand = nullptr;
 
    // Debug: Log handedness mode periodically
-   static int handednessLogCounter = 0;
-   handednessLogCounter++;
-   if (handednessLogCounter % 500 == 1)
- {
-       _MESSAGE("WeaponGeometry: IsLeftHandedMode()=%s, offHandIsLeft=%s, offHandVRControllerIsLeft=%s",
-     IsLeftHandedMode() ? "YES" : "NO",
+   ALOG_CHANNEL(DEBUG, LogChannel::GeometryHandedness,
+       "WeaponGeometry: IsLeftHandedMode()=%s, offHandIsLeft=%s, offHandVRControllerIsLeft=%s",
+     frame.leftHandedMode ? "YES" : "NO",
   offHandIsLeft ? "YES" : "NO",
            offHandVRControllerIsLeft ? "YES" : "NO");
-   }
 
    if (EquipManager::GetSingleton()->HasPendingReequip(offHandIsLeft))
    {
@@ -127,36 +337,30 @@ m_framesSinceEquipChange = 0;
        if (higgsHeldOffHand)
        {
            // Check if HIGGS is actually holding it
-           if (higgsInterface)
+           if (frame.GrabbedByController(offHandVRControllerIsLeft) == higgsHeldOffHand)
            {
-               TESObjectREFR* currentlyHeld = higgsInterface->GetGrabbedObject(offHandVRControllerIsLeft);
-               if (currentlyHeld == higgsHeldOffHand)
-               {
-                   offHandHiggsGrabbed = true;
-               }
+               offHandHiggsGrabbed = true;
            }
        }
    }
 
    // Debug logging for HIGGS state
-   static bool loggedHiggsState = false;
-   if (EquipManager::GetSingleton()->HasPendingReequip(offHandIsLeft) && !loggedHiggsState)
+   if (EquipManager::GetSingleton()->HasPendingReequip(offHandIsLeft))
    {
-       _MESSAGE("WeaponGeometry: Pending reequip - DroppedRef: %p, HIGGS holding: %s",
+       ALOG_CHANNEL(DEBUG, LogChannel::GeometryPendingReequip, "WeaponGeometry: Pending reequip - DroppedRef: %p, HIGGS holding: %s",
            higgsHeldOffHand, offHandHiggsGrabbed ? "YES" : "NO");
-       loggedHiggsState = true;
    }
    
    // Update left hand geometry - skip if shield (ShieldCollisionTracker handles that)
    if (leftEquipped && !leftIsShield)
    {
        // Normal equipped weapon
-       UpdateHandGeometry(true, deltaTime);
+       UpdateHandGeometry(true, frame);
    }
    else if (offHandHiggsGrabbed && higgsHeldOffHand && offHandIsLeft)
    {
        // HIGGS-grabbed weapon in left hand - update geometry from the grabbed object
-       UpdateHiggsGrabbedGeometry(true, higgsHeldOffHand, deltaTime);
+       UpdateHiggsGrabbedGeometry(true, higgsHeldOffHand, frame.deltaTime);
    }
    else
    {
@@ -166,12 +370,12 @@ m_framesSinceEquipChange = 0;
    // Update right hand if weapon equipped - skip if shield
    if (rightEquipped && !rightIsShield)
    {
-       UpdateHandGeometry(false, deltaTime);
+       UpdateHandGeometry(false, frame);
    }
    else if (offHandHiggsGrabbed && higgsHeldOffHand && !offHandIsLeft)
    {
        // HIGGS-grabbed weapon in right hand - update geometry from the grabbed object
-       UpdateHiggsGrabbedGeometry(false, higgsHeldOffHand, deltaTime);
+       UpdateHiggsGrabbedGeometry(false, higgsHeldOffHand, frame.deltaTime);
    }
    else
    {
@@ -195,51 +399,55 @@ m_framesSinceEquipChange = 0;
         if (leftGeomValid && rightGeomValid)
   {
             // Log once when both weapons are valid (including HIGGS grabbed)
-        static bool loggedBothValid = false;
-         static bool loggedHiggsTracking = false;
-            
-     if (!loggedBothValid && !offHandHiggsGrabbed)
+     if (!offHandHiggsGrabbed)
   {
-         _MESSAGE("WeaponGeometryTracker: Both hands have valid geometry!");
-     loggedBothValid = true;
+         ALOG_CHANNEL(DEBUG, LogChannel::GeometryBothValid, "WeaponGeometryTracker: Both hands have valid geometry!");
    }
   
-          if (offHandHiggsGrabbed && !loggedHiggsTracking)
+          if (offHandHiggsGrabbed && LOG_CHANNEL_ENABLED(DEBUG, LogChannel::GeometryHiggsTracking))
    {
-       _MESSAGE("WeaponGeometryTracker: Tracking HIGGS-grabbed weapon + equipped weapon");
-   _MESSAGE("  Left (HIGGS):  Base(%.1f, %.1f, %.1f) Tip(%.1f, %.1f, %.1f)",
+       ALOG_DEBUG("WeaponGeometryTracker: Tracking HIGGS-grabbed weapon + equipped weapon");
+   ALOG_DEBUG("  Left (HIGGS):  Base(%.1f, %.1f, %.1f) Tip(%.1f, %.1f, %.1f)",
          m_geometryState.leftHand.basePosition.x,
         m_geometryState.leftHand.basePosition.y,
     m_geometryState.leftHand.basePosition.z,
         m_geometryState.leftHand.tipPosition.x,
     m_geometryState.leftHand.tipPosition.y,
               m_geometryState.leftHand.tipPosition.z);
-        _MESSAGE("Right (Equipped): Base(%.1f, %.1f, %.1f) Tip(%.1f, %.1f, %.1f)",
+        ALOG_DEBUG("  Right (Equipped): Base(%.1f, %.1f, %.1f) Tip(%.1f, %.1f, %.1f)",
            m_geometryState.rightHand.basePosition.x,
        m_geometryState.rightHand.basePosition.y,
    m_geometryState.rightHand.basePosition.z,
   m_geometryState.rightHand.tipPosition.x,
       m_geometryState.rightHand.tipPosition.y,
  m_geometryState.rightHand.tipPosition.z);
-    loggedHiggsTracking = true;
             }
      
    m_wasInContact = m_bladesInContact;
           m_wasImminent = m_collisionImminent;
     
      BladeCollisionResult collision;
- bool detected = CheckBladeCollision(collision);
+            bool narrowphaseSkipped = CanSkipNarrowphase(frame.deltaTime);
+            if (narrowphaseSkipped)
+            {
+                // Blades provably too far apart - collision stays cleared (not touching, not imminent)
+                m_narrowphaseSkips++;
+                m_stepPairTest = PairTestResult::Skipped;
+            }
+            else
+            {
+                CheckBladeCollision(collision);
+                m_narrowphaseRuns++;
+                m_gapLowerBound = (collision.closestDistance < FLT_MAX) ? collision.closestDistance : -FLT_MAX;
+            }
+            m_stepCollision = collision;
    
       // Log distance periodically when HIGGS grabbed
-            static int distanceLogCounter = 0;
    if (offHandHiggsGrabbed)
             {
-      distanceLogCounter++;
- if (distanceLogCounter % 100 == 1)  // Log every 100 frames
-    {
-        _MESSAGE("HIGGS Blade Distance Check: %.2f (touch threshold: %.2f, imminent: %.2f)",
-         collision.closestDistance, m_collisionThreshold, m_imminentThreshold);
-    }
+        ALOG_CHANNEL(DEBUG, LogChannel::GeometryHiggsDistance, "HIGGS Blade Distance Check: %s%.2f (touch threshold: %.2f, imminent: %.2f)",
+         narrowphaseSkipped ? ">= " : "", narrowphaseSkipped ? m_gapLowerBound : collision.closestDistance,
+         m_collisionThreshold, m_imminentThreshold);
     }
     // Update collision state
             m_bladesInContact = collision.isColliding;
@@ -258,13 +466,13 @@ m_collisionCallback(collision);
                 // Log collision event (only on initial contact)
          if (!m_wasInContact)
         {
-        _MESSAGE("WeaponGeometry: === BLADES TOUCHING === (HIGGS grabbed: %s)", 
+        ALOG_INFO("WeaponGeometry: === BLADES TOUCHING === (HIGGS grabbed: %s)", 
   offHandHiggsGrabbed ? "YES" : "NO");
- _MESSAGE("  Collision Point: (%.2f, %.2f, %.2f)",
+ ALOG_INFO("  Collision Point: (%.2f, %.2f, %.2f)",
     collision.collisionPoint.x,
        collision.collisionPoint.y,
   collision.collisionPoint.z);
-   _MESSAGE("  Distance: %.2f", collision.closestDistance);
+   ALOG_INFO("  Distance: %.2f", collision.closestDistance);
  }
 
         // Check for X-POSE every frame while blades are touching
@@ -291,102 +499,66 @@ m_collisionCallback(collision);
       
         if (inGracePeriod)
    {
-     // During grace period, don't trigger - just log once
-         static bool loggedGracePeriod = false;
-            if (!loggedGracePeriod)
-        {
-        _MESSAGE("WeaponGeometryTracker: In grace period (%d/%d frames) - collision detection disabled",
+     // During grace period, don't trigger - just log
+        ALOG_CHANNEL(DEBUG, LogChannel::GeometryGracePeriod, "WeaponGeometryTracker: In grace period (%d/%d frames) - collision detection disabled",
         m_framesSinceEquipChange, equipGraceFrames);
-      loggedGracePeriod = true;
- }
         }
         else if (!m_wasImminent && !m_wasInContact && !offHandHiggsGrabbed && 
             (!offHandOnCooldown || withinBackupOnly))  // Backup threshold bypasses cooldown
     {
- // Reset grace period log flag
-    static bool loggedGracePeriod = false;
-        loggedGracePeriod = false;
-         
         // Check if we're in close combat mode - if so, don't trigger unequip
        if (VRInputHandler::GetSingleton()->IsInCloseCombatMode())
       {
-     static bool loggedCloseCombatSkip = false;
-  if (!loggedCloseCombatSkip)
-    {
-_MESSAGE("WeaponGeometry: Collision imminent but CLOSE COMBAT MODE active - skipping unequip");
-       loggedCloseCombatSkip = true;
- }
+ALOG_CHANNEL(DEBUG, LogChannel::GeometryCloseCombatSkip, "WeaponGeometry: Collision imminent but CLOSE COMBAT MODE active - skipping unequip");
    }
       // Check if trigger is held on EITHER controller - if so, don't trigger unequip
-        else if (VRInputHandler::IsLeftTriggerPressed() || VRInputHandler::IsRightTriggerPressed())
-     {
-  static bool loggedTriggerSkip = false;
- if (!loggedTriggerSkip)
+        else if (frame.AnyTriggerPressed())
      {
-      _MESSAGE("WeaponGeometry: Collision imminent but TRIGGER HELD - skipping unequip (weapon stays equipped)");
-   loggedTriggerSkip = true;
-        }
+      ALOG_CHANNEL(DEBUG, LogChannel::GeometryTriggerSkip, "WeaponGeometry: Collision imminent but TRIGGER HELD - skipping unequip (weapon stays equipped)");
     }
    else
         {
-        // Reset log flags
-static bool loggedCloseCombatSkip = false;
- loggedCloseCombatSkip = false;
-        static bool loggedTriggerSkip = false;
-   loggedTriggerSkip = false;
-    
-     _MESSAGE("WeaponGeometry: COLLISION IMMINENT!%s", withinBackupOnly ? " (BACKUP THRESHOLD - bypassing cooldown)" : "");
-    _MESSAGE("  Distance: %.2f, Time to collision: %.3f sec",
+     ALOG_DEBUG("WeaponGeometry: COLLISION IMMINENT!%s", withinBackupOnly ? " (BACKUP THRESHOLD - bypassing cooldown)" : "");
+    ALOG_DEBUG("  Distance: %.2f, Time to collision: %.3f sec",
          collision.closestDistance,
 collision.timeToCollision);
  
        // Unequip the OFF-HAND weapon and have HIGGS grab it
      // In right-handed mode: off-hand = LEFT game hand
       // In left-handed mode: off-hand = RIGHT game hand
- bool offHandIsLeft = !IsLeftHandedMode();  // Left game hand is off-hand in right-handed mode
-   _MESSAGE("WeaponGeometry: Triggering game %s hand unequip + HIGGS grab to prevent collision!", 
+   ALOG_INFO("WeaponGeometry: Triggering game %s hand unequip + HIGGS grab to prevent collision!", 
      offHandIsLeft ? "LEFT" : "RIGHT");
- EquipManager::GetSingleton()->ForceUnequipAndGrab(offHandIsLeft);
+ EquipManager::GetSingleton()->ForceUnequipAndGrab(offHandIsLeft, frame);
   }
    }
         else if (!m_wasImminent && !m_wasInContact && offHandOnCooldown && !withinBackupOnly && !inGracePeriod)
  {
-        // Log that we skipped due to cooldown (only once per cooldown period)
-     static bool loggedCooldownSkip = false;
-      if (!loggedCooldownSkip)
-           {
-   _MESSAGE("WeaponGeometry: Collision imminent but LEFT hand on cooldown - allowing blades to slide");
-            loggedCooldownSkip = true;
-          }
+        // Log that we skipped due to cooldown
+   ALOG_CHANNEL(DEBUG, LogChannel::GeometryCooldownSkip, "WeaponGeometry: Collision imminent but %s hand on cooldown - allowing blades to slide",
+       offHandIsLeft ? "LEFT" : "RIGHT");
     }
-        else if (!offHandOnCooldown && !inGracePeriod)
-    {
- // Reset the logged flag when cooldown allows triggering again
-static bool loggedCooldownSkip = false;
-     loggedCooldownSkip = false;
-   }
         }
 else
       {
     // Blades no longer colliding or imminent (geometry-based detection)
      if (m_wasInContact)
 {
-    _MESSAGE("WeaponGeometry: === BLADES NO LONGER TOUCHING === (HIGGS grabbed: %s)",
+    ALOG_INFO("WeaponGeometry: === BLADES NO LONGER TOUCHING === (HIGGS grabbed: %s)",
   offHandHiggsGrabbed ? "YES" : "NO");
-     _MESSAGE("  Current distance: %.2f (threshold: %.2f)", 
+     ALOG_INFO("  Current distance: %.2f (threshold: %.2f)", 
          collision.closestDistance, m_collisionThreshold);
     
     // End X-pose and stop blocking when blades separate
   if (m_inXPose)
          {
-_MESSAGE("WeaponGeometry: *** X-POSE ENDED *** (blades separated)");
+ALOG_INFO("WeaponGeometry: *** X-POSE ENDED *** (blades separated)");
       m_inXPose = false;
 }
 
     // Always stop blocking when blades separate (if player is blocking)
         if (IsBlocking())
   {
-            _MESSAGE("WeaponGeometry: Stopping block (blades separated)");
+            ALOG_INFO("WeaponGeometry: Stopping block (blades separated)");
             StopBlocking();
         }
        }
@@ -400,24 +572,21 @@ else
     if (m_geometryState.leftHand.isValid || m_geometryState.rightHand.isValid)
         {
          // One hand has geometry but validation failed
-       static bool loggedInvalidGeom = false;
-          if (!loggedInvalidGeom && (m_geometryState.leftHand.isValid && !leftGeomValid))
+          if (m_geometryState.leftHand.isValid && !leftGeomValid)
   {
-  _MESSAGE("WeaponGeometryTracker: Left hand geometry invalid - bladeLength: %.2f, pos: (%.2f, %.2f, %.2f)",
+  ALOG_CHANNEL(DEBUG, LogChannel::GeometryInvalid, "WeaponGeometryTracker: Left hand geometry invalid - bladeLength: %.2f, pos: (%.2f, %.2f, %.2f)",
           m_geometryState.leftHand.bladeLength,
        m_geometryState.leftHand.basePosition.x,
             m_geometryState.leftHand.basePosition.y,
          m_geometryState.leftHand.basePosition.z);
-      loggedInvalidGeom = true;
      }
-           if (!loggedInvalidGeom && (m_geometryState.rightHand.isValid && !rightGeomValid))
+           else if (m_geometryState.rightHand.isValid && !rightGeomValid)
      {
-       _MESSAGE("WeaponGeometryTracker: Right hand geometry invalid - bladeLength: %.2f, pos: (%.2f, %.2f, %.2f)",
+       ALOG_CHANNEL(DEBUG, LogChannel::GeometryInvalid, "WeaponGeometryTracker: Right hand geometry invalid - bladeLength: %.2f, pos: (%.2f, %.2f, %.2f)",
           m_geometryState.rightHand.bladeLength,
  m_geometryState.rightHand.basePosition.x,
        m_geometryState.rightHand.basePosition.y,
      m_geometryState.rightHand.basePosition.z);
-         loggedInvalidGeom = true;
  }
      }
     
@@ -425,9 +594,23 @@ else
   m_collisionImminent = false;
  m_wasInContact = false;
   m_wasImminent = false;
+            m_gapLowerBound = -FLT_MAX;
         }
+        
+        PublishSnapshot();
   }
 
+    void WeaponGeometryTracker::PublishSnapshot()
+    {
+        WeaponGeometrySnapshot snapshot;
+        snapshot.geometry = m_geometryState;
+        snapshot.lastCollision = m_lastCollision;
+        snapshot.bladesInContact = m_bladesInContact;
+        snapshot.collisionImminent = m_collisionImminent;
+        snapshot.motionTime = m_motionTime;
+        m_snapshot.Publish(snapshot);
+    }
+
     // Update geometry for a HIGGS-grabbed weapon
     void WeaponGeometryTracker::UpdateHiggsGrabbedGeometry(bool isLeftHand, TESObjectREFR* grabbedRef, float deltaTime)
     {
@@ -439,12 +622,7 @@ else
  
         if (!grabbedRef)
         {
-   static bool loggedNoRef = false;
-      if (!loggedNoRef)
-          {
-        _MESSAGE("UpdateHiggsGrabbedGeometry: No grabbed ref!");
-            loggedNoRef = true;
-        }
+        ALOG_CHANNEL(DEBUG, LogChannel::HiggsGeometryInvalid, "UpdateHiggsGrabbedGeometry: No grabbed ref!");
         geometry.isValid = false;
      return;
         }
@@ -453,12 +631,7 @@ else
         NiNode* objectNode = grabbedRef->GetNiNode();
      if (!objectNode)
         {
-    static bool loggedNoNode = false;
-       if (!loggedNoNode)
- {
-        _MESSAGE("UpdateHiggsGrabbedGeometry: No NiNode for grabbed object!");
-           loggedNoNode = true;
-          }
+        ALOG_CHANNEL(DEBUG, LogChannel::HiggsGeometryInvalid, "UpdateHiggsGrabbedGeometry: No NiNode for grabbed object!");
     geometry.isValid = false;
         return;
         }
@@ -469,45 +642,18 @@ else
      
         if (!weapon)
         {
-     static bool loggedNoWeapon = false;
-            if (!loggedNoWeapon)
-            {
-                _MESSAGE("UpdateHiggsGrabbedGeometry: Base form is not a weapon!");
-        loggedNoWeapon = true;
-  }
+            ALOG_CHANNEL(DEBUG, LogChannel::HiggsGeometryInvalid, "UpdateHiggsGrabbedGeometry: Base form is not a weapon!");
             geometry.isValid = false;
        return;
         }
 
-  // Calculate blade positions from the grabbed object's transform
-        float reach = weapon->gameData.reach;
-   float bladeLength = reach * 70.0f;
-   
+        // Blade positions from the weapon's profile, in the dropped reference's own frame
+        const BladeProfile& profile = GetBladeProfile(objectNode, weapon, true);
+        
         // Base position is the object's world position
         geometry.basePosition = objectNode->m_worldTransform.pos;
- 
-        // Get blade direction from object's rotation
-        NiMatrix33& rot = objectNode->m_worldTransform.rot;
-        NiPoint3 bladeDirection(
-            rot.data[0][1],
-  rot.data[1][1],
-     rot.data[2][1]
-        );
-     
-      float dirLength = sqrt(bladeDirection.x * bladeDirection.x +
-            bladeDirection.y * bladeDirection.y +
-            bladeDirection.z * bladeDirection.z);
- if (dirLength > 0.0001f)
-        {
-   bladeDirection.x /= dirLength;
-    bladeDirection.y /= dirLength;
-         bladeDirection.z /= dirLength;
-        }
-
-        // Tip position
-        geometry.tipPosition.x = geometry.basePosition.x + bladeDirection.x * bladeLength;
-        geometry.tipPosition.y = geometry.basePosition.y + bladeDirection.y * bladeLength;
-        geometry.tipPosition.z = geometry.basePosition.z + bladeDirection.z * bladeLength;
+        geometry.tipPosition = LocalToWorld(objectNode->m_worldTransform, profile.tipOffset);
+        geometry.isDagger = profile.isDagger;
     
    // Calculate blade length
         NiPoint3 bladeVector;
@@ -517,36 +663,21 @@ else
         geometry.bladeLength = sqrt(bladeVector.x * bladeVector.x + 
 bladeVector.y * bladeVector.y + 
           bladeVector.z * bladeVector.z);
+        geometry.bladeRadius = GetBladeRadius(weapon);
   
-        // Calculate velocities (units per second)
- if (deltaTime > 0.0f && (geometry.prevTipPosition.x != 0.0f || 
-            geometry.prevTipPosition.y != 0.0f || 
-            geometry.prevTipPosition.z != 0.0f))
-        {
-          geometry.tipVelocity.x = (geometry.tipPosition.x - geometry.prevTipPosition.x) / deltaTime;
-    geometry.tipVelocity.y = (geometry.tipPosition.y - geometry.prevTipPosition.y) / deltaTime;
-        geometry.tipVelocity.z = (geometry.tipPosition.z - geometry.prevTipPosition.z) / deltaTime;
-        
-            geometry.baseVelocity.x = (geometry.basePosition.x - geometry.prevBasePosition.x) / deltaTime;
-   geometry.baseVelocity.y = (geometry.basePosition.y - geometry.prevBasePosition.y) / deltaTime;
-         geometry.baseVelocity.z = (geometry.basePosition.z - geometry.prevBasePosition.z) / deltaTime;
-    }
+        // Filtered velocities from the last two poses (units per second)
+        UpdateBladeMotion(isLeftHand, geometry);
       
         geometry.isValid = true;
         
         // Log periodically to confirm tracking is working
-        static int logCounter = 0;
-logCounter++;
-        if (logCounter % 400 == 1)  // Log every 500 frames
-        {
-            _MESSAGE("HIGGS Grabbed Geometry Update - Base(%.1f, %.1f, %.1f) Tip(%.1f, %.1f, %.1f) Length: %.1f",
+        ALOG_CHANNEL(DEBUG, LogChannel::HiggsGeometryUpdate, "HIGGS Grabbed Geometry Update - Base(%.1f, %.1f, %.1f) Tip(%.1f, %.1f, %.1f) Length: %.1f",
        geometry.basePosition.x, geometry.basePosition.y, geometry.basePosition.z,
      geometry.tipPosition.x, geometry.tipPosition.y, geometry.tipPosition.z,
      geometry.bladeLength);
-        }
     }
 
-    void WeaponGeometryTracker::UpdateHandGeometry(bool isLeftHand, float deltaTime)
+    void WeaponGeometryTracker::UpdateHandGeometry(bool isLeftHand, const FrameContext& frame)
     {
         BladeGeometry& geometry = isLeftHand ? m_geometryState.leftHand : m_geometryState.rightHand;
 
@@ -555,69 +686,39 @@ logCounter++;
         geometry.prevBasePosition = geometry.basePosition;
         
         // Get the weapon node
-        NiAVObject* weaponNode = GetWeaponNode(isLeftHand);
+        NiAVObject* weaponNode = GetWeaponNode(frame.rootNode, isLeftHand);
         if (!weaponNode)
         {
-    static bool loggedLeftFail = false;
-      static bool loggedRightFail = false;
-if (isLeftHand && !loggedLeftFail)
-            {
-    _MESSAGE("WeaponGeometryTracker: Failed to get LEFT weapon node!");
-         loggedLeftFail = true;
-         }
-          else if (!isLeftHand && !loggedRightFail)
-      {
-            _MESSAGE("WeaponGeometryTracker: Failed to get RIGHT weapon node!");
-              loggedRightFail = true;
- }
+            ALOG_CHANNEL(WARN, isLeftHand ? LogChannel::HandNodeFailedLeft : LogChannel::HandNodeFailedRight,
+                "WeaponGeometryTracker: Failed to get %s weapon node!", isLeftHand ? "LEFT" : "RIGHT");
   geometry.isValid = false;
             return;
         }
         
         // Get the equipped weapon form
-        PlayerCharacter* player = *g_thePlayer;
- TESForm* equippedForm = player->GetEquippedObject(isLeftHand);
+ TESForm* equippedForm = frame.Equipped(isLeftHand);
       TESObjectWEAP* weapon = DYNAMIC_CAST(equippedForm, TESForm, TESObjectWEAP);
       
         if (!weapon)
     {
-      static bool loggedLeftNoWeap = false;
-            static bool loggedRightNoWeap = false;
-   if (isLeftHand && !loggedLeftNoWeap)
-     {
- _MESSAGE("WeaponGeometryTracker: LEFT hand - no weapon form (FormID: %08X, Type: %d)", 
+            ALOG_CHANNEL(DEBUG, isLeftHand ? LogChannel::HandNoWeaponLeft : LogChannel::HandNoWeaponRight,
+                "WeaponGeometryTracker: %s hand - no weapon form (FormID: %08X, Type: %d)",
+                isLeftHand ? "LEFT" : "RIGHT",
         equippedForm ? equippedForm->formID : 0,
         equippedForm ? equippedForm->formType : -1);
-  loggedLeftNoWeap = true;
-          }
-      else if (!isLeftHand && !loggedRightNoWeap)
-     {
-                _MESSAGE("WeaponGeometryTracker: RIGHT hand - no weapon form (FormID: %08X, Type: %d)", 
-    equippedForm ? equippedForm->formID : 0,
-         equippedForm ? equippedForm->formType : -1);
-     loggedRightNoWeap = true;
-     }
             geometry.isValid = false;
   return;
         }
  
         // Log success once per hand
-        static bool loggedLeftSuccess = false;
-        static bool loggedRightSuccess = false;
-        if (isLeftHand && !loggedLeftSuccess)
-        {
-_MESSAGE("WeaponGeometryTracker: LEFT hand - Got weapon node and form! Reach: %.2f", weapon->gameData.reach);
- loggedLeftSuccess = true;
-        }
-      else if (!isLeftHand && !loggedRightSuccess)
-    {
-            _MESSAGE("WeaponGeometryTracker: RIGHT hand - Got weapon node and form! Reach: %.2f", weapon->gameData.reach);
-  loggedRightSuccess = true;
-  }
+        ALOG_CHANNEL(DEBUG, isLeftHand ? LogChannel::HandGeometryFoundLeft : LogChannel::HandGeometryFoundRight,
+            "WeaponGeometryTracker: %s hand - Got weapon node and form! Reach: %.2f",
+            isLeftHand ? "LEFT" : "RIGHT", weapon->gameData.reach);
         
         // Calculate blade positions
         geometry.basePosition = CalculateBladeBase(weaponNode, isLeftHand);
         geometry.tipPosition = CalculateBladeTip(weaponNode, weapon, isLeftHand);
+        geometry.isDagger = GetBladeProfile(weaponNode, weapon, false).isDagger;
       
         // Calculate blade length
         NiPoint3 bladeVector;
@@ -627,83 +728,90 @@ _MESSAGE("WeaponGeometryTracker: LEFT hand - Got weapon node and form! Reach: %.
      geometry.bladeLength = sqrt(bladeVector.x * bladeVector.x + 
    bladeVector.y * bladeVector.y + 
          bladeVector.z * bladeVector.z);
+        geometry.bladeRadius = GetBladeRadius(weapon);
   
-        // Calculate velocities (units per second)
-        if (deltaTime > 0.0f && (geometry.prevTipPosition.x != 0.0f || 
-  geometry.prevTipPosition.y != 0.0f || 
-     geometry.prevTipPosition.z != 0.0f))
-  {
-            geometry.tipVelocity.x = (geometry.tipPosition.x - geometry.prevTipPosition.x) / deltaTime;
-            geometry.tipVelocity.y = (geometry.tipPosition.y - geometry.prevTipPosition.y) / deltaTime;
-            geometry.tipVelocity.z = (geometry.tipPosition.z - geometry.prevTipPosition.z) / deltaTime;
-        
-            geometry.baseVelocity.x = (geometry.basePosition.x - geometry.prevBasePosition.x) / deltaTime;
-  geometry.baseVelocity.y = (geometry.basePosition.y - geometry.prevBasePosition.y) / deltaTime;
-         geometry.baseVelocity.z = (geometry.basePosition.z - geometry.prevBasePosition.z) / deltaTime;
-        }
+        // Filtered velocities from the last two poses (units per second)
+        UpdateBladeMotion(isLeftHand, geometry);
       
         geometry.isValid = true;
     }
 
-    NiAVObject* WeaponGeometryTracker::GetWeaponNode(bool isLeftHand)
+    void WeaponGeometryTracker::UpdateBladeMotion(bool isLeftHand, BladeGeometry& geometry)
     {
-        PlayerCharacter* player = *g_thePlayer;
-        if (!player || !player->loadedState)
+        CollisionMath::BladeMotionEstimator& motion = isLeftHand ? m_leftMotion : m_rightMotion;
+        
+        // Geometry was cleared (equip change, hand emptied) - don't difference against a stale pose
+        if (!geometry.HasPreviousPose())
+            motion.Reset();
+        
+        CollisionMath::OneEuroParams params;
+        params.minCutoff = bladeVelocityFilterMinCutoff;
+        params.beta = bladeVelocityFilterBeta;
+        params.derivativeCutoff = bladeVelocityFilterDerivativeCutoff;
+        
+        CollisionMath::BladePose pose;
+        pose.base = ToVec3(geometry.basePosition);
+        pose.tip = ToVec3(geometry.tipPosition);
+        pose.time = m_motionTime;
+        motion.AddPose(pose, params, bladeVelocityFilter);
+        
+        geometry.tipVelocity = ToNiPoint3(motion.tipVelocity);
+        geometry.baseVelocity = ToNiPoint3(motion.baseVelocity);
+    }
+
+    // Conservative advancement: each CheckBladeCollision measures the blade gap exactly, and every step
+    // after it the gap can only have shrunk by how far the blades actually moved. While that lower bound,
+    // minus the most the blades can move by next step, stays beyond the imminent thresholds, no check in
+    // CheckBladeCollision can fire (distance, time-to-collision and swept tests all need the blades
+    // within the backup threshold or a step of contact) and the narrowphase is skipped.
+    bool WeaponGeometryTracker::CanSkipNarrowphase(float deltaTime)
+    {
+        const BladeGeometry& leftBlade = m_geometryState.leftHand;
+        const BladeGeometry& rightBlade = m_geometryState.rightHand;
+        
+        if (!bladeNarrowphaseScheduling || !leftBlade.HasPreviousPose() || !rightBlade.HasPreviousPose())
         {
-        static bool loggedNoPlayer = false;
-      if (!loggedNoPlayer)
-            {
-      _MESSAGE("WeaponGeometryTracker::GetWeaponNode - No player or loadedState!");
-         loggedNoPlayer = true;
- }
-        return nullptr;
+            m_gapLowerBound = -FLT_MAX;
+            return false;
         }
-
-        NiNode* rootNode = player->GetNiRootNode(0); // First person root
-        if (!rootNode)
-{
-        rootNode = player->GetNiRootNode(1); // Third person root
-     }
         
+        float leftMoved = CollisionMath::MaxSegmentDisplacement(
+            ToVec3(leftBlade.prevBasePosition), ToVec3(leftBlade.prevTipPosition),
+            ToVec3(leftBlade.basePosition), ToVec3(leftBlade.tipPosition));
+        float rightMoved = CollisionMath::MaxSegmentDisplacement(
+            ToVec3(rightBlade.prevBasePosition), ToVec3(rightBlade.prevTipPosition),
+            ToVec3(rightBlade.basePosition), ToVec3(rightBlade.tipPosition));
+        
+        m_gapLowerBound -= leftMoved + rightMoved;
+        
+        float nextStepReach = CollisionMath::MaxNextStepDisplacement(leftMoved, bladeMaxAcceleration, deltaTime) +
+            CollisionMath::MaxNextStepDisplacement(rightMoved, bladeMaxAcceleration, deltaTime);
+        return (m_gapLowerBound - nextStepReach) > GetTriggerDistance();
+    }
+
+    NiAVObject* WeaponGeometryTracker::GetWeaponNode(NiNode* rootNode, bool isLeftHand)
+    {
     if (!rootNode)
    {
-            static bool loggedNoRoot = false;
-      if (!loggedNoRoot)
-        {
- _MESSAGE("WeaponGeometryTracker::GetWeaponNode - No root node found!");
-                loggedNoRoot = true;
-            }
+            ALOG_CHANNEL(DEBUG, LogChannel::WeaponNodeNoRoot, "WeaponGeometryTracker::GetWeaponNode - No root node found!");
         return nullptr;
         }
 
         // Log available nodes once for debugging
-        static bool loggedNodes = false;
-  if (!loggedNodes)
+  if (LOG_CHANNEL_ENABLED(DEBUG, LogChannel::WeaponNodeSearch))
         {
-            _MESSAGE("WeaponGeometryTracker: Root node found: %s", rootNode->m_name ? rootNode->m_name : "unnamed");
-     _MESSAGE("WeaponGeometryTracker: Searching for weapon offset nodes...");
-  loggedNodes = true;
+            ALOG_DEBUG("WeaponGeometryTracker: Root node found: %s", rootNode->m_name ? rootNode->m_name : "unnamed");
+     ALOG_DEBUG("WeaponGeometryTracker: Searching for weapon offset nodes...");
       }
 
         const char* nodeName = GetWeaponOffsetNodeName(isLeftHand);
       
-        BSFixedString nodeNameStr(nodeName);
-        NiAVObject* weaponNode = rootNode->GetObjectByName(&nodeNameStr.data);
+        NiAVObject* weaponNode = NodeCache::GetSingleton()->Find(rootNode, nodeName);
         
         if (!weaponNode)
         {
-        static bool loggedLeftNotFound = false;
-         static bool loggedRightNotFound = false;
-   if (isLeftHand && !loggedLeftNotFound)
-            {
-     _MESSAGE("WeaponGeometryTracker: Node '%s' NOT FOUND in skeleton!", nodeName);
-    loggedLeftNotFound = true;
- }
-            else if (!isLeftHand && !loggedRightNotFound)
-      {
-       _MESSAGE("WeaponGeometryTracker: Node '%s' NOT FOUND in skeleton!", nodeName);
-   loggedRightNotFound = true;
-            }
+            ALOG_CHANNEL(DEBUG, isLeftHand ? LogChannel::WeaponNodeNotFoundLeft : LogChannel::WeaponNodeNotFoundRight,
+                "WeaponGeometryTracker: Node '%s' NOT FOUND in skeleton!", nodeName);
         }
         
         return weaponNode;
@@ -741,34 +849,89 @@ return "SHIELD";
         if (!weaponNode || !weapon)
          return NiPoint3(0, 0, 0);
 
-        float reach = weapon->gameData.reach;
-        float bladeLength = reach * 70.0f;
+        const BladeProfile& profile = GetBladeProfile(weaponNode, weapon, false);
+        return LocalToWorld(weaponNode->m_worldTransform, profile.tipOffset);
+    }
+
+    // ============================================
+    // Blade Profiles
+    // ============================================
+
+    const BladeProfile& WeaponGeometryTracker::GetBladeProfile(NiAVObject* weaponNode, TESObjectWEAP* weapon, bool isDroppedReference)
+    {
+        FlatFormIDMap<BladeProfile>& profiles = isDroppedReference ? m_droppedProfiles : m_equippedProfiles;
         
-        NiMatrix33& rot = weaponNode->m_worldTransform.rot;
+        // Steady state: one probe into the flat map
+        BladeProfile* cached = profiles.Find(weapon->formID);
+        if (cached && (cached->fromMesh ||
+            (cached->meshAttempts >= MAX_PROFILE_MESH_ATTEMPTS && m_motionTime < cached->nextMeshAttempt)))
+            return *cached;
         
-        NiPoint3 bladeDirection(
-            rot.data[0][1],
-         rot.data[1][1],
-            rot.data[2][1]
-);
-     
-        float dirLength = sqrt(bladeDirection.x * bladeDirection.x +
-  bladeDirection.y * bladeDirection.y +
-         bladeDirection.z * bladeDirection.z);
-        if (dirLength > 0.0001f)
+        BladeProfile profile = cached ? *cached : BladeProfile();
+        profile.isDagger = (EquipManager::GetWeaponType(weapon) == WeaponType::Dagger);
+        
+        float tipExtent = 0.0f;
+        NiPoint3 tipOffset(0, 0, 0);
+        FindBladeTipExtent(weaponNode, tipExtent, tipOffset);
+        
+        float length = sqrt(tipOffset.x * tipOffset.x + tipOffset.y * tipOffset.y + tipOffset.z * tipOffset.z);
+        float reachLength = weapon->gameData.reach * 70.0f;
+        
+        if (tipExtent > 0.0f && length >= MIN_PROFILE_BLADE_LENGTH && length <= MAX_PROFILE_BLADE_LENGTH)
         {
-  bladeDirection.x /= dirLength;
-     bladeDirection.y /= dirLength;
-        bladeDirection.z /= dirLength;
-    }
+            profile.tipOffset = tipOffset;
+            profile.axis = NiPoint3(tipOffset.x / length, tipOffset.y / length, tipOffset.z / length);
+            profile.length = length;
+            profile.fromMesh = true;
+            
+            ALOG_INFO("WeaponGeometryTracker: Blade profile %08X (%s%s) from mesh - length %.1f (reach guess %.1f), axis (%.2f, %.2f, %.2f)",
+                weapon->formID, isDroppedReference ? "dropped" : "equipped", profile.isDagger ? ", dagger" : "",
+                length, reachLength, profile.axis.x, profile.axis.y, profile.axis.z);
+        }
+        else
+        {
+            // 3D not loaded yet (or no usable bounds) - reach heuristic along local +Y, try again next step
+            profile.tipOffset = NiPoint3(0, reachLength, 0);
+            profile.axis = NiPoint3(0, 1, 0);
+            profile.length = reachLength;
+            
+            if (profile.meshAttempts < MAX_PROFILE_MESH_ATTEMPTS)
+            {
+                profile.meshAttempts++;
+                if (profile.meshAttempts == MAX_PROFILE_MESH_ATTEMPTS)
+                {
+                    ALOG_INFO("WeaponGeometryTracker: Blade profile %08X - no usable mesh bounds, using reach length %.1f (retrying every %.0f s)",
+                        weapon->formID, reachLength, PROFILE_MESH_RETRY_INTERVAL);
+                }
+            }
+            
+            if (profile.meshAttempts >= MAX_PROFILE_MESH_ATTEMPTS)
+                profile.nextMeshAttempt = m_motionTime + PROFILE_MESH_RETRY_INTERVAL;
+        }
         
-        NiPoint3 basePos = CalculateBladeBase(weaponNode, isLeftHand);
+        return profiles.Insert(weapon->formID, profile);
+    }
 
-        return NiPoint3(
-            basePos.x + bladeDirection.x * bladeLength,
-            basePos.y + bladeDirection.y * bladeLength,
-          basePos.z + bladeDirection.z * bladeLength
-  );
+    void WeaponGeometryTracker::ClearBladeProfiles()
+    {
+        m_equippedProfiles.Clear();
+        m_droppedProfiles.Clear();
+    }
+
+    float WeaponGeometryTracker::GetBladeRadius(TESForm* weapon)
+    {
+        switch (EquipManager::GetWeaponType(weapon))
+        {
+        case WeaponType::Dagger:
+            return bladeRadiusDagger;
+        case WeaponType::Axe:
+            return bladeRadiusAxe;
+        case WeaponType::Mace:
+            return bladeRadiusMace;
+        case WeaponType::Sword:
+        default:
+            return bladeRadiusSword;
+        }
     }
 
     const BladeGeometry& WeaponGeometryTracker::GetBladeGeometry(bool isLeftHand) const
@@ -780,7 +943,7 @@ return "SHIELD";
     {
         if (m_geometryState.leftHand.isValid)
         {
-    LOG("WeaponGeometry: Left Hand - Base(%.2f, %.2f, %.2f) Tip(%.2f, %.2f, %.2f) Length: %.2f",
+    ALOG_WARN("WeaponGeometry: Left Hand - Base(%.2f, %.2f, %.2f) Tip(%.2f, %.2f, %.2f) Length: %.2f",
        m_geometryState.leftHand.basePosition.x,
     m_geometryState.leftHand.basePosition.y,
              m_geometryState.leftHand.basePosition.z,
@@ -792,7 +955,7 @@ return "SHIELD";
         
         if (m_geometryState.rightHand.isValid)
         {
-  LOG("WeaponGeometry: Right Hand - Base(%.2f, %.2f, %.2f) Tip(%.2f, %.2f, %.2f) Length: %.2f",
+  ALOG_WARN("WeaponGeometry: Right Hand - Base(%.2f, %.2f, %.2f) Tip(%.2f, %.2f, %.2f) Length: %.2f",
     m_geometryState.rightHand.basePosition.x,
           m_geometryState.rightHand.basePosition.y,
     m_geometryState.rightHand.basePosition.z,
@@ -814,47 +977,67 @@ return "SHIELD";
      if (!m_geometryState.leftHand.isValid || !m_geometryState.rightHand.isValid)
   return false;
      
-        const NiPoint3& leftBase = m_geometryState.leftHand.basePosition;
-        const NiPoint3& leftTip = m_geometryState.leftHand.tipPosition;
-  const NiPoint3& rightBase = m_geometryState.rightHand.basePosition;
-        const NiPoint3& rightTip = m_geometryState.rightHand.tipPosition;
+        const BladeGeometry& leftBlade = m_geometryState.leftHand;
+        const BladeGeometry& rightBlade = m_geometryState.rightHand;
+        
+        // Broadphase: bounding spheres around both blades, swept over a step either side of now.
+        // If even those are further apart than the largest threshold, nothing below can fire -
+        // skip the solvers, velocity interpolation and dagger scaling. The unswept sphere gap is
+        // still a valid lower bound on the blade gap, so report that as the distance.
+        m_broadphaseTests++;
+        if (CollisionMath::BoundingSphereGap(BladeSweptBounds(leftBlade, m_lastDeltaTime),
+                BladeSweptBounds(rightBlade, m_lastDeltaTime)) > GetTriggerDistance())
+        {
+            m_broadphaseRejects++;
+            m_stepPairTest = PairTestResult::Rejected;
+            outResult.closestDistance = CollisionMath::BoundingSphereGap(
+                CollisionMath::CapsuleBounds(ToCapsule(leftBlade), 0.0f),
+                CollisionMath::CapsuleBounds(ToCapsule(rightBlade), 0.0f));
+            return false;
+        }
+        m_stepPairTest = PairTestResult::Narrowphase;
         
+        // Blades are capsules (axis + collision radius). A sword's capsule is its bare axis, as
+        // before; a mace head reaches further than a sword edge without raising thresholds for
+        // every weapon.
         float leftParam, rightParam;
-  NiPoint3 closestLeft, closestRight;
+        CollisionMath::Vec3 axisLeft, axisRight;
         
-        float distance = ClosestDistanceBetweenSegments(
- leftBase, leftTip,
-   rightBase, rightTip,
-     leftParam, rightParam,
- closestLeft, closestRight
-  );
+        float distance = CollisionMath::CapsuleGap(
+            ToCapsule(leftBlade), ToCapsule(rightBlade),
+            leftParam, rightParam, axisLeft, axisRight);
+        
+        // Closest points on the blade axes (used for the separation direction below)
+        NiPoint3 closestLeft = ToNiPoint3(axisLeft);
+        NiPoint3 closestRight = ToNiPoint3(axisRight);
+        
+        // Surface contact points lie one collision radius along the axis-to-axis direction
+        float axisDistance = CollisionMath::Length(axisRight - axisLeft);
+        CollisionMath::Vec3 axisDir = (axisDistance > 0.0001f) ?
+            (axisRight - axisLeft) * (1.0f / axisDistance) : CollisionMath::Vec3();
         
         outResult.closestDistance = distance;
         outResult.leftBladeParameter = leftParam;
     outResult.rightBladeParameter = rightParam;
-        outResult.leftBladeContactPoint = closestLeft;
-    outResult.rightBladeContactPoint = closestRight;
+        outResult.leftBladeContactPoint = ToNiPoint3(axisLeft + axisDir * CollisionRadius(leftBlade));
+    outResult.rightBladeContactPoint = ToNiPoint3(axisRight - axisDir * CollisionRadius(rightBlade));
  
-     outResult.collisionPoint.x = (closestLeft.x + closestRight.x) * 0.5f;
-   outResult.collisionPoint.y = (closestLeft.y + closestRight.y) * 0.5f;
- outResult.collisionPoint.z = (closestLeft.z + closestRight.z) * 0.5f;
+     outResult.collisionPoint.x = (outResult.leftBladeContactPoint.x + outResult.rightBladeContactPoint.x) * 0.5f;
+   outResult.collisionPoint.y = (outResult.leftBladeContactPoint.y + outResult.rightBladeContactPoint.y) * 0.5f;
+ outResult.collisionPoint.z = (outResult.leftBladeContactPoint.z + outResult.rightBladeContactPoint.z) * 0.5f;
         
         // ============================================
-        // DYNAMIC THRESHOLD SCALING based on blade length
+        // DYNAMIC THRESHOLD SCALING for short blades
         // ============================================
-        // Different weapon types have different actual blade lengths
-        // Sword reach ~1.0 = blade length ~70 units
-      // Dagger reach ~0.5-0.7 = blade length ~25-35 units (much shorter!)
-        
-  const float DAGGER_MAX_BLADE_LENGTH = 55.0f;  // Blades shorter than this are daggers
+        // Daggers have much shorter blades (~25-35 units vs ~70 for a sword) and need tighter thresholds.
+        // The dagger flag comes from the weapon's blade profile (weapon type), for equipped and HIGGS grabbed alike.
         
         float leftBladeLen = m_geometryState.leftHand.bladeLength;
     float rightBladeLen = m_geometryState.rightHand.bladeLength;
         float shorterBladeLen = (leftBladeLen < rightBladeLen) ? leftBladeLen : rightBladeLen;
         
-        // Detect if weapons are daggers based on actual blade length (works for both equipped and HIGGS grabbed)
-   bool leftIsDagger = (leftBladeLen > 0.1f && leftBladeLen <= DAGGER_MAX_BLADE_LENGTH);
-bool rightIsDagger = (rightBladeLen > 0.1f && rightBladeLen <= DAGGER_MAX_BLADE_LENGTH);
+   bool leftIsDagger = leftBlade.isDagger;
+bool rightIsDagger = rightBlade.isDagger;
         bool bothDaggers = leftIsDagger && rightIsDagger;
         bool eitherDagger = leftIsDagger || rightIsDagger;
         
@@ -865,12 +1048,12 @@ bool rightIsDagger = (rightBladeLen > 0.1f && rightBladeLen <= DAGGER_MAX_BLADE_
         if (bothDaggers)
         {
         // Dual daggers: use very small thresholds
-            scaleFactor = 0.25f;  // 25% of normal thresholds
+            scaleFactor = daggerPairThresholdScale;  // Default 25% of normal thresholds
         }
         else if (eitherDagger)
         {
   // One dagger + one longer weapon: use moderate thresholds
-            scaleFactor = 0.5f;  // 50% of normal thresholds
+            scaleFactor = daggerMixedThresholdScale;  // Default 50% of normal thresholds
         }
         else
         {
@@ -884,16 +1067,14 @@ bool rightIsDagger = (rightBladeLen > 0.1f && rightBladeLen <= DAGGER_MAX_BLADE_
         float scaledBackupThreshold = bladeImminentThresholdBackup * scaleFactor;
         
   // Debug: Log the scaling periodically
-  static int scaleLogCounter = 0;
- scaleLogCounter++;
-   if (scaleLogCounter % 500 == 1)
+   if (LOG_CHANNEL_ENABLED(DEBUG, LogChannel::GeometryScaling))
        {
-   _MESSAGE("WeaponGeometry: Blade lengths - Left: %.1f, Right: %.1f, Shorter: %.1f",
+   ALOG_DEBUG("WeaponGeometry: Blade lengths - Left: %.1f, Right: %.1f, Shorter: %.1f",
  leftBladeLen, rightBladeLen, shorterBladeLen);
-_MESSAGE("WeaponGeometry: LeftDagger=%s, RightDagger=%s, BothDaggers=%s, ScaleFactor: %.2f",
+ALOG_DEBUG("WeaponGeometry: LeftDagger=%s, RightDagger=%s, BothDaggers=%s, ScaleFactor: %.2f",
        leftIsDagger ? "YES" : "NO", rightIsDagger ? "YES" : "NO",
   bothDaggers ? "YES" : "NO", scaleFactor);
-   _MESSAGE("WeaponGeometry: Scaled thresholds - Collision: %.2f, Imminent: %.2f, Backup: %.2f",
+   ALOG_DEBUG("WeaponGeometry: Scaled thresholds - Collision: %.2f, Imminent: %.2f, Backup: %.2f",
   scaledCollisionThreshold, scaledImminentThreshold, scaledBackupThreshold);
       }
 
@@ -940,10 +1121,45 @@ _MESSAGE("WeaponGeometry: LeftDagger=%s, RightDagger=%s, BothDaggers=%s, ScaleFa
         
         // Closing velocity is the component of relative velocity along separation direction
         float closingVelocity = Dot(relVel, separationDir);
+        outResult.closingVelocity = closingVelocity;
         
         // Estimate time to collision (using scaled threshold)
         outResult.timeToCollision = EstimateTimeToCollisionScaled(distance, closingVelocity, scaledCollisionThreshold);
 
+        // ============================================
+        // CONTINUOUS (SWEPT) COLLISION
+        // ============================================
+        // The linear estimate above only looks along the current closest-point direction, so a fast
+        // swing can carry the blades through each other between two steps. Sweep both blades forward
+        // for an exact time of impact, and back over the last step to catch a crossing we stepped over.
+        bool sweptMode = bladeContinuousCollision && m_lastDeltaTime > 0.0f;
+        if (sweptMode && distance > scaledCollisionThreshold)
+        {
+            // Sweeps run on the blade axes, so contact is the surface threshold plus both collision radii
+            float axisContactDistance = scaledCollisionThreshold + CollisionRadius(leftBlade) + CollisionRadius(rightBlade);
+            float horizon = (bladeTimeToCollisionThreshold > m_lastDeltaTime) ? bladeTimeToCollisionThreshold : m_lastDeltaTime;
+
+            CollisionMath::TimeOfImpactResult impact;
+            if (CollisionMath::SweptSegmentsTimeOfImpact(SweepForward(leftBlade), SweepForward(rightBlade),
+                axisContactDistance, horizon, impact))
+            {
+                outResult.timeToCollision = impact.time;
+                outResult.isSweptImpact = (impact.time <= m_lastDeltaTime);
+            }
+            else if (!impact.exhausted)
+            {
+                outResult.timeToCollision = -1.0f;
+            }
+
+            if (leftBlade.HasPreviousPose() && rightBlade.HasPreviousPose())
+            {
+                CollisionMath::TimeOfImpactResult lastStep;
+                outResult.tunneledLastStep = CollisionMath::SweptSegmentsTimeOfImpact(
+                    SweepLastStep(leftBlade, m_lastDeltaTime), SweepLastStep(rightBlade, m_lastDeltaTime),
+                    axisContactDistance, m_lastDeltaTime, lastStep) && (lastStep.time > 0.0f);
+            }
+        }
+
    // Check collision states using SCALED thresholds
       outResult.isColliding = (distance <= scaledCollisionThreshold);
   
@@ -953,18 +1169,18 @@ _MESSAGE("WeaponGeometry: LeftDagger=%s, RightDagger=%s, BothDaggers=%s, ScaleFa
         // 3. Time to collision is very short AND within a reasonable distance (fast swings!)
         //
         // IMPORTANT: We require a minimum closing velocity to avoid false positives from hand tremor/jitter
-        // A closing velocity of ~50 units/sec means blades are actually moving toward each other intentionally
-      const float MIN_CLOSING_VELOCITY = 50.0f;  // Minimum velocity to consider "approaching"
-        
-      bool withinPrimaryThreshold = (distance <= scaledImminentThreshold) && (closingVelocity >= MIN_CLOSING_VELOCITY);
-        bool withinBackupThreshold = (distance <= scaledBackupThreshold) && (closingVelocity >= MIN_CLOSING_VELOCITY);
+        // ([BladeCollision] MinClosingVelocity). One-Euro filtering roughly halves the jitter at rest, so 50 leaves
+        // more margin than it did on raw velocities.
+      bool withinPrimaryThreshold = (distance <= scaledImminentThreshold) && (closingVelocity >= bladeMinClosingVelocity);
+        bool withinBackupThreshold = (distance <= scaledBackupThreshold) && (closingVelocity >= bladeMinClosingVelocity);
         
  // Fast approach only triggers if BOTH time is short AND distance is within backup threshold
 // This prevents false positives at large distances
    // For daggers (short weapons), DISABLE fast approach entirely - it causes too many false positives
     // because the time-to-collision calculation doesn't account for 3D trajectory well
+     // The swept time of impact follows the real 3D trajectory, so it is safe for daggers too.
      bool fastApproaching = false;
-        if (!bothDaggers)
+        if (!bothDaggers || sweptMode)
   {
      // Only enable fast approach for longer weapons (swords, axes, etc.)
     fastApproaching = (outResult.timeToCollision > 0.0f) && 
@@ -972,143 +1188,54 @@ _MESSAGE("WeaponGeometry: LeftDagger=%s, RightDagger=%s, BothDaggers=%s, ScaleFa
     (distance <= scaledBackupThreshold);
 }
      
-        outResult.isImminent = !outResult.isColliding && (withinPrimaryThreshold || withinBackupThreshold || fastApproaching);
+        outResult.isImminent = !outResult.isColliding &&
+            (withinPrimaryThreshold || withinBackupThreshold || fastApproaching ||
+             outResult.isSweptImpact || outResult.tunneledLastStep);
   
-        // Debug: Log when imminent is triggered
-   if (outResult.isImminent)
+        // Debug: Log when imminent is triggered (true every step of an approach - rate-limited)
+   if (outResult.isImminent && LOG_CHANNEL_ENABLED(DEBUG, LogChannel::GeometryImminent))
         {
-   _MESSAGE("WeaponGeometry: IMMINENT DEBUG - dist=%.2f, scaledImm=%.2f, scaledBackup=%.2f, timeToCol=%.3f, timeThresh=%.3f",
+   ALOG_DEBUG("WeaponGeometry: IMMINENT DEBUG - dist=%.2f, scaledImm=%.2f, scaledBackup=%.2f, timeToCol=%.3f, timeThresh=%.3f",
    distance, scaledImminentThreshold, scaledBackupThreshold, 
         outResult.timeToCollision, bladeTimeToCollisionThreshold);
-           _MESSAGE("WeaponGeometry: IMMINENT DEBUG - primary=%s, backup=%s, fast=%s, closingVel=%.1f",
+           ALOG_DEBUG("WeaponGeometry: IMMINENT DEBUG - primary=%s, backup=%s, fast=%s, swept=%s, tunneled=%s, closingVel=%.1f",
   withinPrimaryThreshold ? "YES" : "NO",
    withinBackupThreshold ? "YES" : "NO",
  fastApproaching ? "YES" : "NO",
+   outResult.isSweptImpact ? "YES" : "NO",
+   outResult.tunneledLastStep ? "YES" : "NO",
    closingVelocity);
-      _MESSAGE("WeaponGeometry: IMMINENT DEBUG - leftBladeLen=%.1f, rightBladeLen=%.1f, scaleFactor=%.2f",
+      ALOG_DEBUG("WeaponGeometry: IMMINENT DEBUG - leftBladeLen=%.1f, rightBladeLen=%.1f, scaleFactor=%.2f",
   m_geometryState.leftHand.bladeLength, m_geometryState.rightHand.bladeLength, scaleFactor);
         }
 
      return outResult.isColliding || outResult.isImminent;
     }
 
-  float WeaponGeometryTracker::EstimateTimeToCollisionScaled(float distance, float closingVelocity, float scaledCollisionThreshold)
+    float WeaponGeometryTracker::EstimateTimeToCollisionScaled(float distance, float closingVelocity, float scaledCollisionThreshold)
     {
-        // If not approaching (velocity <= 0) or already colliding, return -1
-        if (closingVelocity <= 0.0f || distance <= scaledCollisionThreshold)
-  return -1.0f;
-        
-  // Time = distance / velocity
-    float timeToCollision = (distance - scaledCollisionThreshold) / closingVelocity;
-   
-    // Cap at a reasonable maximum (e.g., 2 seconds)
-  if (timeToCollision > 2.0f)
-   return -1.0f;
-      
-        return timeToCollision;
-}
+        return CollisionMath::EstimateTimeToCollision(distance, closingVelocity, scaledCollisionThreshold);
+    }
 
     float WeaponGeometryTracker::EstimateTimeToCollision(float distance, float closingVelocity)
     {
-        // If not approaching (velocity <= 0) or already colliding, return -1
-      if (closingVelocity <= 0.0f || distance <= m_collisionThreshold)
-    return -1.0f;
-        
-  // Time = distance / velocity
- float timeToCollision = (distance - m_collisionThreshold) / closingVelocity;
-   
-        // Cap at a reasonable maximum (e.g., 2 seconds)
-  if (timeToCollision > 2.0f)
-   return -1.0f;
-   
-      return timeToCollision;
+        return CollisionMath::EstimateTimeToCollision(distance, closingVelocity, m_collisionThreshold);
     }
 
     float WeaponGeometryTracker::ClosestDistanceBetweenSegments(
-  const NiPoint3& p1, const NiPoint3& q1,
-    const NiPoint3& p2, const NiPoint3& q2,
-     float& outParam1, float& outParam2,
+        const NiPoint3& p1, const NiPoint3& q1,
+        const NiPoint3& p2, const NiPoint3& q2,
+        float& outParam1, float& outParam2,
         NiPoint3& outClosestPoint1, NiPoint3& outClosestPoint2)
     {
-        NiPoint3 d1, d2, r;
-   d1.x = q1.x - p1.x;
-d1.y = q1.y - p1.y;
-d1.z = q1.z - p1.z;
-        
-    d2.x = q2.x - p2.x;
-   d2.y = q2.y - p2.y;
-     d2.z = q2.z - p2.z;
-   
-        r.x = p1.x - p2.x;
-        r.y = p1.y - p2.y;
-        r.z = p1.z - p2.z;
-     
-        float a = Dot(d1, d1);
- float e = Dot(d2, d2);
- float f = Dot(d2, r);
-        
-        float s, t;
-        
-        if (a <= 0.0001f && e <= 0.0001f)
-        {
-    s = t = 0.0f;
-         outClosestPoint1 = p1;
-    outClosestPoint2 = p2;
-}
-        else if (a <= 0.0001f)
-        {
-s = 0.0f;
-   t = Clamp(f / e, 0.0f, 1.0f);
-        }
-        else
-    {
-       float c = Dot(d1, r);
-            if (e <= 0.0001f)
-   {
- t = 0.0f;
-     s = Clamp(-c / a, 0.0f, 1.0f);
-       }
-    else
-            {
- float b = Dot(d1, d2);
-      float denom = a * e - b * b;
-    
-      if (denom != 0.0f)
-    {
-        s = Clamp((b * f - c * e) / denom, 0.0f, 1.0f);
-     }
-          else
-           {
-         s = 0.0f;
-     }
-    
-         t = (b * s + f) / e;
- 
-if (t < 0.0f)
-{
-         t = 0.0f;
-         s = Clamp(-c / a, 0.0f, 1.0f);
-                }
-    else if (t > 1.0f)
-    {
- t = 1.0f;
-           s = Clamp((b - c) / a, 0.0f, 1.0f);
-           }
-    }
-        }
-        
-     outParam1 = s;
-      outParam2 = t;
-    
-        outClosestPoint1 = PointAlongSegment(p1, q1, s);
-        outClosestPoint2 = PointAlongSegment(p2, q2, t);
-        
-        NiPoint3 diff;
-        diff.x = outClosestPoint1.x - outClosestPoint2.x;
-    diff.y = outClosestPoint1.y - outClosestPoint2.y;
-    diff.z = outClosestPoint1.z - outClosestPoint2.z;
-  
-   return sqrt(diff.x * diff.x + diff.y * diff.y + diff.z * diff.z);
+        CollisionMath::Vec3 closest1, closest2;
+        float distance = CollisionMath::ClosestDistanceBetweenSegments(
+            ToVec3(p1), ToVec3(q1), ToVec3(p2), ToVec3(q2),
+            outParam1, outParam2, closest1, closest2);
+
+        outClosestPoint1 = ToNiPoint3(closest1);
+        outClosestPoint2 = ToNiPoint3(closest2);
+        return distance;
     }
 
 float WeaponGeometryTracker::Dot(const NiPoint3& a, const NiPoint3& b)
@@ -1116,22 +1243,6 @@ float WeaponGeometryTracker::Dot(const NiPoint3& a, const NiPoint3& b)
    return a.x * b.x + a.y * b.y + a.z * b.z;
   }
 
-    float WeaponGeometryTracker::Clamp(float value, float min, float max)
-    {
-   if (value < min) return min;
-      if (value > max) return max;
-  return value;
-    }
-
- NiPoint3 WeaponGeometryTracker::PointAlongSegment(const NiPoint3& start, const NiPoint3& end, float t)
-    {
-        NiPoint3 result;
- result.x = start.x + t * (end.x - start.x);
-        result.y = start.y + t * (end.y - start.y);
-   result.z = start.z + t * (end.z - start.z);
-   return result;
-    }
-
     void WeaponGeometryTracker::CheckXPose(const BladeGeometry& leftBlade, const BladeGeometry& rightBlade)
     {
      // Save previous state
@@ -1142,112 +1253,75 @@ float WeaponGeometryTracker::Dot(const NiPoint3& a, const NiPoint3& b)
        m_inXPose = false;
        if (m_wasInXPose)
    {
-  _MESSAGE("WeaponGeometry: *** X-POSE ENDED *** (blade geometry invalid)");
+  ALOG_INFO("WeaponGeometry: *** X-POSE ENDED *** (blade geometry invalid)");
        }
   return;
         }
 
-        // Get blade direction vectors (from base to tip)
-        NiPoint3 leftDir;
-        leftDir.x = leftBlade.tipPosition.x - leftBlade.basePosition.x;
-        leftDir.y = leftBlade.tipPosition.y - leftBlade.basePosition.y;
-        leftDir.z = leftBlade.tipPosition.z - leftBlade.basePosition.z;
-
-        NiPoint3 rightDir;
-        rightDir.x = rightBlade.tipPosition.x - rightBlade.basePosition.x;
-        rightDir.y = rightBlade.tipPosition.y - rightBlade.basePosition.y;
-        rightDir.z = rightBlade.tipPosition.z - rightBlade.basePosition.z;
-
-     // Normalize the direction vectors
-     float leftLen = sqrt(leftDir.x * leftDir.x + leftDir.y * leftDir.y + leftDir.z * leftDir.z);
-        float rightLen = sqrt(rightDir.x * rightDir.x + rightDir.y * rightDir.y + rightDir.z * rightDir.z);
-
- if (leftLen < 0.001f || rightLen < 0.001f)
- {
-      m_inXPose = false;
-   if (m_wasInXPose)
-    {
-      _MESSAGE("WeaponGeometry: *** X-POSE ENDED *** (blade length too short)");
-     }
-      return;
-   }
-
-        leftDir.x /= leftLen;
-  leftDir.y /= leftLen;
-        leftDir.z /= leftLen;
-
- rightDir.x /= rightLen;
-   rightDir.y /= rightLen;
-    rightDir.z /= rightLen;
-
         // Get player forward direction (Y axis in Skyrim is forward)
         PlayerCharacter* player = *g_thePlayer;
         if (!player)
-{
-        m_inXPose = false;
-     if (m_wasInXPose)
-  {
-    _MESSAGE("WeaponGeometry: *** X-POSE ENDED *** (no player)");
-     }
-  return;
+        {
+            m_inXPose = false;
+            if (m_wasInXPose)
+            {
+                ALOG_INFO("WeaponGeometry: *** X-POSE ENDED *** (no player)");
+            }
+            return;
         }
 
-      NiPoint3 playerForward;
         // Use player's rotation angle (rot.z is heading in radians)
-   float heading = player->rot.z;
-        playerForward.x = sin(heading);
-        playerForward.y = cos(heading);
-   playerForward.z = 0.0f;
-
-   // Calculate dot product between blades (negative = crossing/X shape)
-        float bladeDot = leftDir.x * rightDir.x + leftDir.y * rightDir.y + leftDir.z * rightDir.z;
- 
-      // Calculate angle between blades
-    float bladeAngle = acos(Clamp(bladeDot, -1.0f, 1.0f)) * (180.0f / 3.14159f);
-
-      // Calculate how much each blade is facing forward (dot with player forward)
-float leftForwardDot = leftDir.x * playerForward.x + leftDir.y * playerForward.y;
-    float rightForwardDot = rightDir.x * playerForward.x + rightDir.y * playerForward.y;
-
-        // Check if blades are pointing upward (positive Z component)
-      bool leftPointingUp = leftDir.z > 0.3f;  // At least 30% upward
-        bool rightPointingUp = rightDir.z > 0.3f;
+        CollisionMath::XPoseResult pose;
+        if (!CollisionMath::EvaluateXPose(
+            ToVec3(leftBlade.basePosition), ToVec3(leftBlade.tipPosition),
+            ToVec3(rightBlade.basePosition), ToVec3(rightBlade.tipPosition),
+            player->rot.z, pose))
+        {
+            m_inXPose = false;
+            if (m_wasInXPose)
+            {
+                ALOG_INFO("WeaponGeometry: *** X-POSE ENDED *** (blade length too short)");
+            }
+            return;
+        }
 
-        // X-pose criteria:
-      // 1. Blades are crossing (angle between them is 30-150 degrees - not parallel, not same direction)
-        // 2. Both blades are pointing somewhat upward
- // 3. Blades are roughly facing forward (not pointing backward)
-     bool isCrossing = (bladeAngle > 30.0f && bladeAngle < 150.0f);
-        bool bothPointingUp = leftPointingUp && rightPointingUp;
-        bool facingForward = (leftForwardDot > -0.5f) && (rightForwardDot > -0.5f);
+        const CollisionMath::Vec3& leftDir = pose.leftDir;
+        const CollisionMath::Vec3& rightDir = pose.rightDir;
+        float bladeAngle = pose.bladeAngle;
+        float leftForwardDot = pose.leftForwardDot;
+        float rightForwardDot = pose.rightForwardDot;
+        bool leftPointingUp = pose.leftPointingUp;
+        bool rightPointingUp = pose.rightPointingUp;
+        bool isCrossing = pose.isCrossing;
+        bool facingForward = pose.facingForward;
 
-        m_inXPose = isCrossing && bothPointingUp && facingForward;
+        m_inXPose = pose.isXPose;
 
         // Log state changes
    if (m_inXPose && !m_wasInXPose)
    {
-      _MESSAGE("WeaponGeometry: X-POSE CHECK:");
-  _MESSAGE("  Left blade dir: (%.2f, %.2f, %.2f)", leftDir.x, leftDir.y, leftDir.z);
-   _MESSAGE("  Right blade dir: (%.2f, %.2f, %.2f)", rightDir.x, rightDir.y, rightDir.z);
-         _MESSAGE("  Blade angle: %.1f degrees (crossing: %s)", bladeAngle, isCrossing ? "YES" : "NO");
-   _MESSAGE("  Left pointing up: %s (z=%.2f), Right pointing up: %s (z=%.2f)",
+      ALOG_INFO("WeaponGeometry: X-POSE CHECK:");
+  ALOG_INFO("  Left blade dir: (%.2f, %.2f, %.2f)", leftDir.x, leftDir.y, leftDir.z);
+   ALOG_INFO("  Right blade dir: (%.2f, %.2f, %.2f)", rightDir.x, rightDir.y, rightDir.z);
+         ALOG_INFO("  Blade angle: %.1f degrees (crossing: %s)", bladeAngle, isCrossing ? "YES" : "NO");
+   ALOG_INFO("  Left pointing up: %s (z=%.2f), Right pointing up: %s (z=%.2f)",
  leftPointingUp ? "YES" : "NO", leftDir.z,
       rightPointingUp ? "YES" : "NO" , rightDir.z);
-  _MESSAGE("  Facing forward: %s (leftDot=%.2f, rightDot=%.2f)",
+  ALOG_INFO("  Facing forward: %s (leftDot=%.2f, rightDot=%.2f)",
  facingForward ? "YES" : "NO", leftForwardDot, rightForwardDot);
-      _MESSAGE("WeaponGeometry: *** X-POSE DETECTED! *** Blades crossed facing forward!");
+      ALOG_INFO("WeaponGeometry: *** X-POSE DETECTED! *** Blades crossed facing forward!");
      
          // Start blocking when X-pose begins
        StartBlocking();
       }
    else if (!m_inXPose && m_wasInXPose)
     {
-    _MESSAGE("WeaponGeometry: *** X-POSE ENDED ***");
-  _MESSAGE("  Blade angle: %.1f degrees (crossing: %s)", bladeAngle, isCrossing ? "YES" : "NO");
-       _MESSAGE("  Left pointing up: %s (z=%.2f), Right pointing up: %s (z=%.2f)",
+    ALOG_INFO("WeaponGeometry: *** X-POSE ENDED ***");
+  ALOG_INFO("  Blade angle: %.1f degrees (crossing: %s)", bladeAngle, isCrossing ? "YES" : "NO");
+       ALOG_INFO("  Left pointing up: %s (z=%.2f), Right pointing up: %s (z=%.2f)",
      leftPointingUp ? "YES" : "NO", leftDir.z,
    rightPointingUp ? "YES" : "NO" , rightDir.z);
-  _MESSAGE("  Facing forward: %s (leftDot=%.2f, rightDot=%.2f)",
+  ALOG_INFO("  Facing forward: %s (leftDot=%.2f, rightDot=%.2f)",
  facingForward ? "YES" : "NO", leftForwardDot, rightForwardDot);
      
       // Stop blocking when X-pose ends
@@ -1264,9 +1338,9 @@ float leftForwardDot = leftDir.x * playerForward.x + leftDir.y * playerForward.y
       WeaponGeometryTracker::GetSingleton()->Initialize();
     }
 
-    void UpdateWeaponGeometry(float deltaTime)
+    void UpdateWeaponGeometry(const FrameContext& frame)
     {
-        WeaponGeometryTracker::GetSingleton()->Update(deltaTime);
+        WeaponGeometryTracker::GetSingleton()->Update(frame);
     }
 }
 
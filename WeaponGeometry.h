@@ -7,9 +7,25 @@
 #include "skse64/GameObjects.h"
 #include "config.h"
 #include "EquipManager.h"
+#include "CollisionMath.h"
+#include "BladeMotion.h"
+#include "FormIDMap.h"
+#include "FrameContext.h"
+#include "SeqLock.h"
 
 namespace FalseEdgeVR
 {
+    // NiPoint3 <-> CollisionMath::Vec3 adapters (identical layout, three floats)
+    inline CollisionMath::Vec3 ToVec3(const NiPoint3& p)
+    {
+        return CollisionMath::Vec3(p.x, p.y, p.z);
+    }
+
+    inline NiPoint3 ToNiPoint3(const CollisionMath::Vec3& v)
+    {
+        return NiPoint3(v.x, v.y, v.z);
+    }
+
     // Represents the blade geometry data for a weapon
   struct BladeGeometry
     {
@@ -18,6 +34,8 @@ namespace FalseEdgeVR
  NiPoint3 tipVelocity;  // Velocity of blade tip (units per second)
       NiPoint3 baseVelocity; // Velocity of blade base
         float bladeLength; // Distance from base to tip
+        float bladeRadius;          // Capsule radius around the base-tip axis (per weapon type)
+        bool isDagger;              // Weapon type is dagger (short-blade threshold scaling)
         bool isValid;         // Whether the geometry data is valid
         
     // Previous frame positions for velocity calculation
@@ -33,6 +51,8 @@ namespace FalseEdgeVR
          prevTipPosition = NiPoint3(0, 0, 0);
       prevBasePosition = NiPoint3(0, 0, 0);
          bladeLength = 0.0f;
+            bladeRadius = 0.0f;
+            isDagger = false;
        isValid = false;
     }
         
@@ -40,21 +60,141 @@ namespace FalseEdgeVR
         {
             Clear();
      }
+        
+        // Whether last step's positions are available (not the first frame after a Clear)
+        bool HasPreviousPose() const
+        {
+            return prevTipPosition.x != 0.0f || prevTipPosition.y != 0.0f || prevTipPosition.z != 0.0f;
+        }
+    };
+    
+    // Blade shape of one weapon model in its node's local frame. Built once per FormID from
+    // the bounds of the weapon's 3D, then every step is a lookup plus one transform.
+    struct BladeProfile
+    {
+        NiPoint3 tipOffset;         // Blade tip relative to the node origin (local space, unscaled)
+        NiPoint3 axis;              // Unit direction from the node origin (hilt) to the tip
+        float length = 0.0f;        // Node origin to tip, unscaled
+        bool isDagger = false;      // From the weapon type
+        bool fromMesh = false;      // false = reach * 70 fallback while the 3D isn't loaded
+        UInt8 meshAttempts = 0;     // Failed mesh reads so far (then only every few seconds)
+        float nextMeshAttempt = 0.0f;   // Tracker motion time of the next read once attempts ran out
+    };
+    
+    // Point in a node's local frame -> world space. Columns of rot are the local axes.
+    NiPoint3 LocalToWorld(const NiTransform& frame, const NiPoint3& local);
+    
+    // World space -> a node's local frame (inverse of LocalToWorld)
+    NiPoint3 WorldToLocal(const NiTransform& frame, const NiPoint3& world);
+    
+    // NiAVObject's world bound. NiBound { NiPoint3 center; float radius; } directly follows
+    // m_worldTransform, but this SKSE build only names it as unkE4/unkE8/unkEC (center) and
+    // unkF0 (radius). Zero radius until the engine has updated the object's bounds.
+    struct WorldBound
+    {
+        NiPoint3 center;
+        float radius;
+    };
+    
+    inline WorldBound GetWorldBound(const NiAVObject* object)
+    {
+        return { NiPoint3(object->unkE4, object->unkE8, object->unkEC), object->unkF0 };
+    }
+    
+    // Bound sphere of one piece of leaf geometry, in the local frame of the node it was collected under
+    struct LocalBoundSphere
+    {
+        NiPoint3 center;            // Local space, unscaled
+        float radius;               // Unscaled
     };
     
+    // Most leaf geometries CollectLocalBounds keeps from one model (weapon and shield 3D have a handful)
+    static const int MAX_LOCAL_BOUNDS = 32;
+    
+    // Gathers the world bound spheres of all geometry under root, expressed in root's local frame.
+    // Scabbards ("Scb" nodes) are skipped - they hang off weapon models but are not part of the blade.
+    // Fills at most capacity entries and returns how many; none until the 3D has been loaded and
+    // had its bounds updated.
+    int CollectLocalBounds(NiAVObject* root, LocalBoundSphere* outBounds, int capacity);
+    
+    // Box around the vertices of all unskinned BSTriShape geometry under root, in root's local frame
+    // (unscaled). Scabbards are skipped as above. Shapes without a CPU-side vertex block don't count;
+    // false if none had one.
+    bool CollectLocalVertexExtents(NiAVObject* root, NiPoint3& outMin, NiPoint3& outMax);
+    
+    // Thickness the collision tests add to the blade axis. The thresholds were tuned on
+    // zero-width axes, so a sword's thickness is already inside them; only the part of a
+    // radius beyond SwordRadius (axe and mace heads) adds reach.
+    inline float CollisionRadius(const BladeGeometry& blade)
+    {
+        float extra = blade.bladeRadius - bladeRadiusSword;
+        return (extra > 0.0f) ? extra : 0.0f;
+    }
+    
+    // Blade as a capsule volume (with its collision radius)
+    inline CollisionMath::Capsule ToCapsule(const BladeGeometry& blade)
+    {
+        return { ToVec3(blade.basePosition), ToVec3(blade.tipPosition), CollisionRadius(blade) };
+    }
+    
+    // Blade moving with its current tip/base velocities (for swept collision tests)
+    inline CollisionMath::SweptSegment SweepForward(const BladeGeometry& blade)
+    {
+        return { ToVec3(blade.basePosition), ToVec3(blade.tipPosition),
+                 ToVec3(blade.baseVelocity), ToVec3(blade.tipVelocity) };
+    }
+    
+    // Blade moving from last step's pose to this step's pose over deltaTime
+    inline CollisionMath::SweptSegment SweepLastStep(const BladeGeometry& blade, float deltaTime)
+    {
+        float invDt = 1.0f / deltaTime;
+        return { ToVec3(blade.prevBasePosition), ToVec3(blade.prevTipPosition),
+                 (ToVec3(blade.basePosition) - ToVec3(blade.prevBasePosition)) * invDt,
+                 (ToVec3(blade.tipPosition) - ToVec3(blade.prevTipPosition)) * invDt };
+    }
+    
+    // How far any point of the blade can move within one step either side of now: the larger of
+    // last step's measured displacement (plus the acceleration bound) and its current velocity.
+    // Covers both the "tunneled last step" and the "impact before next step" swept tests.
+    inline float BladeStepMotion(const BladeGeometry& blade, float deltaTime)
+    {
+        float tipSpeed = CollisionMath::Length(ToVec3(blade.tipVelocity));
+        float baseSpeed = CollisionMath::Length(ToVec3(blade.baseVelocity));
+        float motion = ((tipSpeed > baseSpeed) ? tipSpeed : baseSpeed) * deltaTime;
+        if (blade.HasPreviousPose())
+        {
+            float lastMoved = CollisionMath::MaxSegmentDisplacement(
+                ToVec3(blade.prevBasePosition), ToVec3(blade.prevTipPosition),
+                ToVec3(blade.basePosition), ToVec3(blade.tipPosition));
+            float stepBound = CollisionMath::MaxNextStepDisplacement(lastMoved, bladeMaxAcceleration, deltaTime);
+            if (stepBound > motion)
+                motion = stepBound;
+        }
+        return motion;
+    }
+    
+    // Broadphase bounds of a blade, swept over one step either side of now
+    inline CollisionMath::BoundingSphere BladeSweptBounds(const BladeGeometry& blade, float deltaTime)
+    {
+        return CollisionMath::CapsuleBounds(ToCapsule(blade), BladeStepMotion(blade, deltaTime));
+    }
+    
   // Blade collision result data
     struct BladeCollisionResult
     {
         bool isColliding;            // Whether blades are currently colliding
         bool isImminent;        // Whether collision is imminent (close but not touching)
     NiPoint3 collisionPoint;        // World position of collision point
-        NiPoint3 leftBladeContactPoint; // Point on left blade where contact occurs
-        NiPoint3 rightBladeContactPoint;// Point on right blade where contact occurs
-        float closestDistance;          // Closest distance between the two blade segments
+        NiPoint3 leftBladeContactPoint; // Point on left blade surface where contact occurs
+        NiPoint3 rightBladeContactPoint;// Point on right blade surface where contact occurs
+        float closestDistance;          // Gap between the two blade capsule surfaces (negative = overlapping)
         float leftBladeParameter;       // Parameter (0-1) along left blade where closest point is
      float rightBladeParameter;    // Parameter (0-1) along right blade where closest point is
         float relativeVelocity;     // Relative velocity at collision point
+        float closingVelocity;          // Relative velocity along the gap (positive = blades approaching)
         float timeToCollision;          // Estimated time until collision (seconds), -1 if moving apart
+        bool isSweptImpact;             // Swept test: blades reach contact before the next step
+        bool tunneledLastStep;          // Swept test: blades passed through each other during the last step
 
         void Clear()
         {
@@ -67,7 +207,10 @@ namespace FalseEdgeVR
             leftBladeParameter = 0.0f;
             rightBladeParameter = 0.0f;
             relativeVelocity = 0.0f;
+            closingVelocity = 0.0f;
  timeToCollision = -1.0f;
+            isSweptImpact = false;
+            tunneledLastStep = false;
         }
         
         BladeCollisionResult()
@@ -76,12 +219,31 @@ namespace FalseEdgeVR
  }
     };
     
+    // How far a step's pair test (blade vs blade, weapon vs shield) got
+    enum class PairTestResult : UInt8
+    {
+        NotTested,      // One side has no valid geometry
+        Skipped,        // Narrowphase scheduling - the gap bound was still clear of the thresholds
+        Rejected,       // Broadphase - swept bounding spheres further apart than the thresholds
+        Narrowphase,    // Full capsule test ran
+    };
+    
     // Weapon geometry data for both hands
     struct WeaponGeometryState
 {
         BladeGeometry leftHand;
         BladeGeometry rightHand;
     };
+    
+    // One step's finished geometry and collision state, as published for other threads
+    struct WeaponGeometrySnapshot
+    {
+        WeaponGeometryState geometry;
+        BladeCollisionResult lastCollision;
+        bool bladesInContact;
+        bool collisionImminent;
+        float motionTime;               // Step time of the pose (tracker's accumulated step time)
+    };
 
     // Callback type for blade collision events
     typedef void (*BladeCollisionCallback)(const BladeCollisionResult& collision);
@@ -99,23 +261,39 @@ namespace FalseEdgeVR
      void Initialize();
     
         // Update weapon geometry - call this each frame
-        void Update(float deltaTime);
+        void Update(const FrameContext& frame);
         
       // Get current geometry state
+        // Live state, rewritten during Update - physics-step thread only
         const WeaponGeometryState& GetGeometryState() const { return m_geometryState; }
    
-        // Get blade geometry for a specific hand
+        // Get blade geometry for a specific hand (live state, physics-step thread only)
         const BladeGeometry& GetBladeGeometry(bool isLeftHand) const;
+        
+        // Consistent copy of the last finished step's geometry and collision state.
+        // Any thread; false before the first step.
+        bool GetSnapshot(WeaponGeometrySnapshot& outSnapshot) const { return m_snapshot.Read(outSnapshot); }
       
-        // Get the weapon node for a hand
-      NiAVObject* GetWeaponNode(bool isLeftHand);
+        // Get the weapon node for a hand under the player's root node
+      NiAVObject* GetWeaponNode(NiNode* rootNode, bool isLeftHand);
         
-    // Calculate blade tip position based on weapon type and reach
+    // Calculate blade tip position from the weapon's cached blade profile
         NiPoint3 CalculateBladeTip(NiAVObject* weaponNode, TESObjectWEAP* weapon, bool isLeftHand);
+        
+        // Blade profile for a weapon, cached per FormID. Equipped weapons (node = WEAPON/SHIELD
+        // attach node) and dropped references (node = the reference's 3D root) have different
+        // local frames, so they are cached separately.
+        const BladeProfile& GetBladeProfile(NiAVObject* weaponNode, TESObjectWEAP* weapon, bool isDroppedReference);
+        
+        // Forget all cached profiles (ClearAllState on death or load)
+        void ClearBladeProfiles();
  
         // Calculate blade base position (handle/hilt)
         NiPoint3 CalculateBladeBase(NiAVObject* weaponNode, bool isLeftHand);
         
+        // Capsule radius for a weapon (from its weapon type, see [BladeCollision] *Radius)
+        static float GetBladeRadius(TESForm* weapon);
+        
         // ============================================
         // Blade Collision Detection
         // ============================================
@@ -131,6 +309,10 @@ namespace FalseEdgeVR
         
         // Check if collision is imminent (close but not touching)
         bool IsCollisionImminent() const { return m_collisionImminent; }
+        
+        // This step's pair test: its result (cleared if it did not run) and how far it got
+        const BladeCollisionResult& GetStepCollisionResult() const { return m_stepCollision; }
+        PairTestResult GetStepPairTest() const { return m_stepPairTest; }
     
         // Set collision threshold distance (default ~5 units)
         void SetCollisionThreshold(float threshold) { m_collisionThreshold = threshold; }
@@ -140,6 +322,17 @@ namespace FalseEdgeVR
      void SetImminentThreshold(float threshold) { m_imminentThreshold = threshold; }
         float GetImminentThreshold() const { return m_imminentThreshold; }
         
+        // Narrowphase scheduling stats (steps where CheckBladeCollision ran / was skipped)
+        UInt32 GetNarrowphaseRunCount() const { return m_narrowphaseRuns; }
+        UInt32 GetNarrowphaseSkipCount() const { return m_narrowphaseSkips; }
+        
+        // Broadphase stats (blade pairs tested / rejected by the bounding-sphere test)
+        UInt32 GetBroadphaseTestCount() const { return m_broadphaseTests; }
+        UInt32 GetBroadphaseRejectCount() const { return m_broadphaseRejects; }
+        
+        // Start a new stats window (logged with the pose scheduler's report)
+        void ResetPipelineStats() { m_narrowphaseRuns = m_narrowphaseSkips = m_broadphaseTests = m_broadphaseRejects = 0; }
+        
         // Register callback for blade collision events
      void SetCollisionCallback(BladeCollisionCallback callback) { m_collisionCallback = callback; }
         
@@ -153,11 +346,24 @@ namespace FalseEdgeVR
         WeaponGeometryTracker& operator=(const WeaponGeometryTracker&) = delete;
    
         // Update geometry for a single hand (equipped weapon)
-   void UpdateHandGeometry(bool isLeftHand, float deltaTime);
+   void UpdateHandGeometry(bool isLeftHand, const FrameContext& frame);
   
      // Update geometry for a HIGGS-grabbed weapon
   void UpdateHiggsGrabbedGeometry(bool isLeftHand, TESObjectREFR* grabbedRef, float deltaTime);
         
+        // Push this step's pose into the hand's history and set the filtered velocities
+        void UpdateBladeMotion(bool isLeftHand, BladeGeometry& geometry);
+        
+        // Conservative advancement - true if the blades cannot be within the imminent thresholds this step
+        bool CanSkipNarrowphase(float deltaTime);
+        
+        // Largest blade gap at which CheckBladeCollision can report contact or imminent (unscaled thresholds)
+        float GetTriggerDistance() const
+        {
+            float trigger = (m_imminentThreshold > bladeImminentThresholdBackup) ? m_imminentThreshold : bladeImminentThresholdBackup;
+            return (m_collisionThreshold > trigger) ? m_collisionThreshold : trigger;
+        }
+        
       // Check for X-pose (crossed blades facing forward)
         void CheckXPose(const BladeGeometry& leftBlade, const BladeGeometry& rightBlade);
         
@@ -167,11 +373,15 @@ namespace FalseEdgeVR
       // Log geometry state for debugging
   void LogGeometryState();
         
+        // Copy this step's finished state into m_snapshot
+        void PublishSnapshot();
+        
         // ============================================
         // Collision Detection Helpers
         // ============================================
       
         // Calculate closest distance between two line segments (blade edges)
+        // Thin NiPoint3 wrappers over CollisionMath
         float ClosestDistanceBetweenSegments(
   const NiPoint3& p1, const NiPoint3& q1,
      const NiPoint3& p2, const NiPoint3& q2,
@@ -189,14 +399,11 @@ namespace FalseEdgeVR
      // Helper: dot product
         static float Dot(const NiPoint3& a, const NiPoint3& b);
         
-        // Helper: clamp value
-    static float Clamp(float value, float min, float max);
-        
-        // Helper: point along segment
-  static NiPoint3 PointAlongSegment(const NiPoint3& start, const NiPoint3& end, float t);
-        
      WeaponGeometryState m_geometryState;
         BladeCollisionResult m_lastCollision;
+        BladeCollisionResult m_stepCollision;
+        PairTestResult m_stepPairTest = PairTestResult::NotTested;
+        SeqLockSnapshot<WeaponGeometrySnapshot> m_snapshot;
         BladeCollisionCallback m_collisionCallback = nullptr;
 BladeImminentCallback m_imminentCallback = nullptr;
     
@@ -208,6 +415,23 @@ BladeImminentCallback m_imminentCallback = nullptr;
         bool m_inXPose = false;          // Currently in X-pose
      bool m_wasInXPose = false;       // Was in X-pose last frame
         float m_lastUpdateTime = 0.0f;
+        float m_lastDeltaTime = 0.0f;    // Step interval, used as the swept collision horizon
+        float m_motionTime = 0.0f;       // Accumulated step time, timestamps the blade poses
+        
+        // Per-hand previous pose and velocity filter
+        CollisionMath::BladeMotionEstimator m_leftMotion;
+        CollisionMath::BladeMotionEstimator m_rightMotion;
+        
+        // Blade profiles per weapon FormID
+        FlatFormIDMap<BladeProfile> m_equippedProfiles;
+        FlatFormIDMap<BladeProfile> m_droppedProfiles;
+        
+        // Narrowphase scheduling: lower bound on the blade gap since the last CheckBladeCollision
+        float m_gapLowerBound = -FLT_MAX;
+        UInt32 m_narrowphaseRuns = 0;
+        UInt32 m_narrowphaseSkips = 0;
+        UInt32 m_broadphaseTests = 0;
+        UInt32 m_broadphaseRejects = 0;
         // Collision detection parameters (use config values)
         float m_collisionThreshold = 5.0f;  // Will be updated from config
       float m_imminentThreshold = 15.0f;    // Will be updated from config
@@ -223,5 +447,5 @@ BladeImminentCallback m_imminentCallback = nullptr;
     void InitializeWeaponGeometryTracker();
     
     // Convenience function to update weapon geometry (call each frame)
-    void UpdateWeaponGeometry(float deltaTime);
+    void UpdateWeaponGeometry(const FrameContext& frame);
 }
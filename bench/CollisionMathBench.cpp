@@ -0,0 +1,545 @@
+// Benchmark for the per-frame collision math in CollisionMath.h.
+// Runs on plain Linux/Windows without Skyrim: cmake --build <dir> --target bench
+
+#include "CollisionMath.h"
+#include "CollisionMathBatch.h"
+#include "BladeMotion.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace FalseEdgeVR::CollisionMath;
+
+namespace
+{
+    // Keeps results observable so the optimizer cannot drop the work
+    volatile float g_sink = 0.0f;
+
+    struct BladePair
+    {
+        Vec3 p1, q1;    // Left blade base/tip
+        Vec3 p2, q2;    // Right blade base/tip
+    };
+
+    struct ShieldCase
+    {
+        Vec3 base, tip;
+        Vec3 center, normal;
+        float radius;
+    };
+
+    Vec3 RandomPoint(std::mt19937& rng, float extent)
+    {
+        std::uniform_real_distribution<float> dist(-extent, extent);
+        return Vec3(dist(rng), dist(rng), dist(rng));
+    }
+
+    Vec3 RandomDirection(std::mt19937& rng)
+    {
+        return Normalize(RandomPoint(rng, 1.0f));
+    }
+
+    // Blades are 30-110 units long with bases within a ~1m box around the player
+    Vec3 RandomTip(std::mt19937& rng, const Vec3& base)
+    {
+        std::uniform_real_distribution<float> length(30.0f, 110.0f);
+        return base + RandomDirection(rng) * length(rng);
+    }
+
+    // Shield face ellipse in the case's disc plane: semi-axes radius x (0.4-1) * radius
+    PlanarEllipse MakeEllipse(std::mt19937& rng, const Vec3& center, const Vec3& normal, float radius)
+    {
+        Vec3 helper = (std::fabs(normal.z) < 0.9f) ? Vec3(0.0f, 0.0f, 1.0f) : Vec3(1.0f, 0.0f, 0.0f);
+        Vec3 axisU = Normalize(Cross(helper, normal));
+        Vec3 axisV = Cross(normal, axisU);
+        std::uniform_real_distribution<float> aspect(0.4f, 1.0f);
+        return { center, normal, axisU, axisV, radius * aspect(rng), radius };
+    }
+
+    // Brute-force segment to solid ellipse: dense samples along the segment and around the rim
+    float SampledSegmentToEllipse(const Vec3& segStart, const Vec3& segEnd, const PlanarEllipse& ellipse)
+    {
+        const int segmentSamples = 256;
+        const int rimSamples = 512;
+        float best = FLT_MAX;
+        for (int i = 0; i <= segmentSamples; i++)
+        {
+            Vec3 point = PointAlongSegment(segStart, segEnd, (float)i / segmentSamples);
+            Vec3 offset = point - ellipse.center;
+            float height = Dot(offset, ellipse.normal);
+            float candidate;
+            if (PointInEllipse(ellipse, point))
+            {
+                candidate = std::fabs(height);
+            }
+            else
+            {
+                candidate = FLT_MAX;
+                for (int j = 0; j < rimSamples; j++)
+                {
+                    float angle = 2.0f * kPi * (float)j / rimSamples;
+                    Vec3 rim = ellipse.center + ellipse.axisU * (ellipse.radiusU * std::cos(angle))
+                        + ellipse.axisV * (ellipse.radiusV * std::sin(angle));
+                    float d = Length(point - rim);
+                    if (d < candidate)
+                        candidate = d;
+                }
+            }
+            if (candidate < best)
+                best = candidate;
+        }
+        return best;
+    }
+
+    // The pre-analytic ShieldCollisionTracker solver: 11 samples along the segment.
+    // Kept here only as a baseline for cost and accuracy.
+    float SampledSegmentToDisc(
+        const Vec3& segStart, const Vec3& segEnd,
+        const Vec3& discCenter, const Vec3& discNormal, float discRadius,
+        float& outSegmentParam)
+    {
+        const int numSamples = 10;
+        float minDist = FLT_MAX;
+        outSegmentParam = 0.0f;
+        for (int i = 0; i <= numSamples; i++)
+        {
+            float t = (float)i / (float)numSamples;
+            Vec3 segmentPoint = PointAlongSegment(segStart, segEnd, t);
+            float dist = Length(segmentPoint - ClampPointToDisc(segmentPoint, discCenter, discNormal, discRadius));
+            if (dist < minDist)
+            {
+                minDist = dist;
+                outSegmentParam = t;
+            }
+        }
+        return minDist;
+    }
+
+    template <typename Func>
+    void Run(const char* name, size_t iterations, Func&& func)
+    {
+        // Warm up caches and branch predictors
+        for (size_t i = 0; i < iterations / 10; i++)
+            func(i);
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            func(i);
+        auto end = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        std::printf("%-40s %10zu iters %10.2f ns/op\n", name, iterations, ns / (double)iterations);
+    }
+
+    template <typename Func>
+    double TimePerCall(size_t iterations, Func&& func)
+    {
+        for (size_t i = 0; i < iterations / 10; i++)
+            func();
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            func();
+        auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / (double)iterations;
+    }
+
+    // Raw vs One-Euro velocity on a synthetic tip track: 90 Hz, ~1.5 mm tracking jitter,
+    // a 0.5 s out-and-back swing (peak ~1250 units/sec) every 2 s. Prints RMS velocity error, and
+    // how often jitter alone at rest would pass MinClosingVelocity (50) toward a blade along +X.
+    void ReportVelocityFilter()
+    {
+        const float dt = 1.0f / 90.0f;
+        std::mt19937 rng(99);
+        std::normal_distribution<float> jitter(0.0f, 0.15f);
+
+        OneEuroParams params;
+        BladeMotionEstimator raw, filtered;
+        raw.Reset();
+        filtered.Reset();
+
+        double restRaw = 0.0, restFiltered = 0.0, swingRaw = 0.0, swingFiltered = 0.0;
+        int restCount = 0, swingCount = 0;
+        int restRawOver = 0, restFilteredOver = 0;
+        const float minClosingVelocity = 50.0f;
+        for (int i = 0; i < 9000; i++)
+        {
+            float time = (float)i * dt;
+            float phase = std::fmod(time, 2.0f);
+            float x = 0.0f, v = 0.0f;
+            if (phase > 1.5f)
+            {
+                float u = (phase - 1.5f) / 0.5f;
+                x = 100.0f * (1.0f - std::cos(2.0f * kPi * u));
+                v = 100.0f * 2.0f * kPi * std::sin(2.0f * kPi * u) / 0.5f;
+            }
+
+            BladePose pose;
+            pose.tip = Vec3(x + jitter(rng), jitter(rng), jitter(rng));
+            pose.time = time;
+            raw.AddPose(pose, params, false);
+            filtered.AddPose(pose, params, true);
+            if (i < 10)
+                continue;
+
+            float rawError = LengthSquared(raw.tipVelocity - Vec3(v, 0.0f, 0.0f));
+            float filteredError = LengthSquared(filtered.tipVelocity - Vec3(v, 0.0f, 0.0f));
+            if (v == 0.0f)
+            {
+                restRaw += rawError; restFiltered += filteredError; restCount++;
+                restRawOver += (raw.tipVelocity.x >= minClosingVelocity) ? 1 : 0;
+                restFilteredOver += (filtered.tipVelocity.x >= minClosingVelocity) ? 1 : 0;
+            }
+            else
+            {
+                swingRaw += rawError; swingFiltered += filteredError; swingCount++;
+            }
+        }
+
+        std::printf("  velocity RMS error at rest: raw %.1f, filtered %.1f  during swing: raw %.1f, filtered %.1f\n",
+            std::sqrt(restRaw / restCount), std::sqrt(restFiltered / restCount),
+            std::sqrt(swingRaw / swingCount), std::sqrt(swingFiltered / swingCount));
+        std::printf("  rest steps over MinClosingVelocity %.0f: raw %.2f%%, filtered %.2f%%\n", minClosingVelocity,
+            100.0 * restRawOver / restCount, 100.0 * restFilteredOver / restCount);
+    }
+
+    // Conservative-advancement scheduling as WeaponGeometryTracker does it, on a synthetic 90 Hz
+    // session: blades held ~80 units apart with jitter, the right blade swinging into the left
+    // one for 0.5 s every 3 s. Reports how many narrowphase checks were skipped and whether any
+    // skipped step had the blades within the trigger distance (must be 0).
+    void ReportNarrowphaseScheduling()
+    {
+        const float dt = 1.0f / 90.0f;
+        const float triggerDistance = 30.0f;    // bladeImminentThresholdBackup
+        const float maxAcceleration = 20000.0f;
+        std::mt19937 rng(7);
+        std::normal_distribution<float> jitter(0.0f, 0.15f);
+
+        Vec3 prevLeftBase, prevLeftTip, prevRightBase, prevRightTip;
+        float gapLowerBound = -FLT_MAX;
+        int runs = 0, skips = 0, missed = 0;
+        for (int i = 0; i < 27000; i++)
+        {
+            float phase = std::fmod((float)i * dt, 3.0f);
+            float reach = 0.0f;
+            if (phase > 2.5f)
+                reach = 45.0f * (1.0f - std::cos(2.0f * kPi * (phase - 2.5f) / 0.5f));   // up to 90 units
+
+            Vec3 noise(jitter(rng), jitter(rng), jitter(rng));
+            Vec3 leftBase = Vec3(-40.0f, 0.0f, 0.0f) + noise, leftTip = Vec3(-40.0f, 0.0f, 80.0f) + noise;
+            Vec3 rightBase = Vec3(40.0f - reach, 0.0f, 0.0f), rightTip = Vec3(40.0f - reach, 0.0f, 80.0f);
+
+            float s, t;
+            Vec3 c1, c2;
+            float gap = ClosestDistanceBetweenSegments(leftBase, leftTip, rightBase, rightTip, s, t, c1, c2) - 3.0f;
+
+            bool skip = false;
+            if (i > 0)
+            {
+                float leftMoved = MaxSegmentDisplacement(prevLeftBase, prevLeftTip, leftBase, leftTip);
+                float rightMoved = MaxSegmentDisplacement(prevRightBase, prevRightTip, rightBase, rightTip);
+                gapLowerBound -= leftMoved + rightMoved;
+                float nextStepReach = MaxNextStepDisplacement(leftMoved, maxAcceleration, dt) +
+                    MaxNextStepDisplacement(rightMoved, maxAcceleration, dt);
+                skip = (gapLowerBound - nextStepReach) > triggerDistance;
+            }
+
+            if (skip)
+            {
+                skips++;
+                if (gap <= triggerDistance)
+                    missed++;
+            }
+            else
+            {
+                runs++;
+                gapLowerBound = gap;
+            }
+
+            prevLeftBase = leftBase; prevLeftTip = leftTip;
+            prevRightBase = rightBase; prevRightTip = rightTip;
+        }
+
+        std::printf("  narrowphase scheduling: %d run, %d skipped (%.0f%%), %d skipped within trigger distance\n",
+            runs, skips, 100.0f * (float)skips / (float)(runs + skips), missed);
+    }
+
+    // Scalar loop vs SoA batch kernel for N pairs; iterations is the total pair count
+    void RunSegmentBatch(const std::vector<BladePair>& blades, size_t n, size_t iterations)
+    {
+        static SegmentPairBatch<512> batch;
+        batch.Clear();
+        for (size_t i = 0; i < n; i++)
+            batch.Add(blades[i].p1, blades[i].q1, blades[i].p2, blades[i].q2);
+
+        size_t calls = std::max<size_t>(iterations / n, 1);
+
+        double scalarNs = TimePerCall(calls, [&]() {
+            float sum = 0.0f;
+            for (size_t i = 0; i < n; i++)
+            {
+                const BladePair& pair = blades[i];
+                float s, t;
+                Vec3 c1, c2;
+                sum += ClosestDistanceBetweenSegments(pair.p1, pair.q1, pair.p2, pair.q2, s, t, c1, c2);
+            }
+            g_sink = g_sink + sum;
+        });
+
+        double batchNs = TimePerCall(calls, [&]() {
+            ClosestDistanceBetweenSegmentsBatch(batch);
+            g_sink = g_sink + batch.distance[n - 1];
+        });
+
+        // Batch must agree with the scalar path
+        float maxError = 0.0f;
+        for (size_t i = 0; i < n; i++)
+        {
+            const BladePair& pair = blades[i];
+            float s, t;
+            Vec3 c1, c2;
+            float scalar = ClosestDistanceBetweenSegments(pair.p1, pair.q1, pair.p2, pair.q2, s, t, c1, c2);
+            maxError = std::max(maxError, std::fabs(scalar - batch.distance[i]));
+        }
+
+        std::printf("  N=%-4zu scalar %9.1f ns (%6.2f/pair)  batch %9.1f ns (%6.2f/pair)  %5.2fx  max diff %.2g\n",
+            n, scalarNs, scalarNs / (double)n, batchNs, batchNs / (double)n, scalarNs / batchNs, maxError);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t iterations = 2000000;
+    if (argc > 1)
+        iterations = std::strtoull(argv[1], nullptr, 10);
+
+    const size_t numCases = 4096;  // Power of two so (i & mask) picks a case
+    const size_t mask = numCases - 1;
+
+    std::mt19937 rng(1234);
+
+    std::vector<BladePair> blades(numCases);
+    for (BladePair& pair : blades)
+    {
+        pair.p1 = RandomPoint(rng, 50.0f);
+        pair.q1 = RandomTip(rng, pair.p1);
+        pair.p2 = RandomPoint(rng, 50.0f);
+        pair.q2 = RandomTip(rng, pair.p2);
+    }
+
+    std::vector<ShieldCase> shields(numCases);
+    std::uniform_real_distribution<float> radius(10.0f, 30.0f);
+    for (ShieldCase& shield : shields)
+    {
+        shield.base = RandomPoint(rng, 50.0f);
+        shield.tip = RandomTip(rng, shield.base);
+        shield.center = RandomPoint(rng, 50.0f);
+        shield.normal = RandomDirection(rng);
+        shield.radius = radius(rng);
+    }
+
+    // Swings: endpoint speeds up to ~2000 units/sec (a fast VR swing), blades kept rigid-ish
+    std::vector<SweptSegment> sweptLeft(numCases), sweptRight(numCases);
+    std::uniform_real_distribution<float> speed(0.0f, 2000.0f);
+    for (size_t i = 0; i < numCases; i++)
+    {
+        Vec3 leftVelocity = RandomDirection(rng) * speed(rng);
+        Vec3 rightVelocity = RandomDirection(rng) * speed(rng);
+        sweptLeft[i] = { blades[i].p1, blades[i].q1, leftVelocity, leftVelocity + RandomDirection(rng) * 200.0f };
+        sweptRight[i] = { blades[i].p2, blades[i].q2, rightVelocity, rightVelocity + RandomDirection(rng) * 200.0f };
+    }
+
+    std::vector<float> distances(numCases), velocities(numCases);
+    std::uniform_real_distribution<float> distance(0.0f, 100.0f);
+    std::uniform_real_distribution<float> velocity(-200.0f, 800.0f);
+    for (size_t i = 0; i < numCases; i++)
+    {
+        distances[i] = distance(rng);
+        velocities[i] = velocity(rng);
+    }
+
+    std::printf("CollisionMath benchmark (%zu cases)\n", numCases);
+
+    Run("ClosestDistanceBetweenSegments", iterations, [&](size_t i) {
+        const BladePair& pair = blades[i & mask];
+        float s, t;
+        Vec3 c1, c2;
+        g_sink = g_sink + ClosestDistanceBetweenSegments(pair.p1, pair.q1, pair.p2, pair.q2, s, t, c1, c2);
+    });
+
+    Run("Broadphase (swept bounding spheres)", iterations, [&](size_t i) {
+        const BladePair& pair = blades[i & mask];
+        Capsule left = { pair.p1, pair.q1, 1.5f };
+        Capsule right = { pair.p2, pair.q2, 1.5f };
+        g_sink = g_sink + BoundingSphereGap(CapsuleBounds(left, 10.0f), CapsuleBounds(right, 10.0f));
+    });
+
+    // How often the broadphase alone settles a random pair (30 unit trigger, 10 units of motion each)
+    {
+        int rejected = 0, missed = 0;
+        for (const BladePair& pair : blades)
+        {
+            Capsule left = { pair.p1, pair.q1, 1.5f };
+            Capsule right = { pair.p2, pair.q2, 1.5f };
+            float s, t;
+            Vec3 c1, c2;
+            bool reject = BoundingSphereGap(CapsuleBounds(left, 10.0f), CapsuleBounds(right, 10.0f)) > 30.0f;
+            if (reject)
+                rejected++;
+            if (reject && CapsuleGap(left, right, s, t, c1, c2) <= 30.0f)
+                missed++;
+        }
+        std::printf("  broadphase rejects %d/%zu random blade pairs (%d wrongly)\n", rejected, numCases, missed);
+    }
+
+    Run("ClosestDistanceSegmentToDisc", iterations, [&](size_t i) {
+        const ShieldCase& shield = shields[i & mask];
+        float param;
+        Vec3 segmentPoint, discPoint;
+        g_sink = g_sink + ClosestDistanceSegmentToDisc(shield.base, shield.tip,
+            shield.center, shield.normal, shield.radius, param, segmentPoint, discPoint);
+    });
+
+    Run("SampledSegmentToDisc (11 samples)", iterations, [&](size_t i) {
+        const ShieldCase& shield = shields[i & mask];
+        float param;
+        g_sink = g_sink + SampledSegmentToDisc(shield.base, shield.tip,
+            shield.center, shield.normal, shield.radius, param);
+    });
+
+    // Accuracy of the sampled baseline against the exact solver
+    {
+        int sampledWorse = 0;
+        float maxError = 0.0f;
+        for (const ShieldCase& shield : shields)
+        {
+            float param;
+            Vec3 segmentPoint, discPoint;
+            float exact = ClosestDistanceSegmentToDisc(shield.base, shield.tip,
+                shield.center, shield.normal, shield.radius, param, segmentPoint, discPoint);
+            float sampled = SampledSegmentToDisc(shield.base, shield.tip,
+                shield.center, shield.normal, shield.radius, param);
+            if (sampled - exact > 0.01f)
+                sampledWorse++;
+            if (sampled - exact > maxError)
+                maxError = sampled - exact;
+        }
+        std::printf("  sampled overestimates distance in %d/%zu cases, max error %.2f units\n",
+            sampledWorse, numCases, maxError);
+    }
+
+    std::vector<PlanarEllipse> ellipses(numCases);
+    for (size_t i = 0; i < numCases; i++)
+        ellipses[i] = MakeEllipse(rng, shields[i].center, shields[i].normal, shields[i].radius);
+
+    Run("ClosestDistanceSegmentToEllipse", iterations, [&](size_t i) {
+        const ShieldCase& shield = shields[i & mask];
+        float param;
+        Vec3 segmentPoint, ellipsePoint;
+        g_sink = g_sink + ClosestDistanceSegmentToEllipse(shield.base, shield.tip, ellipses[i & mask],
+            param, segmentPoint, ellipsePoint);
+    });
+
+    // A round shield's face takes the exact disc path
+    std::vector<PlanarEllipse> circles(ellipses);
+    for (PlanarEllipse& circle : circles)
+        circle.radiusU = circle.radiusV;
+
+    Run("ClosestDistanceSegmentToEllipse (circle)", iterations, [&](size_t i) {
+        const ShieldCase& shield = shields[i & mask];
+        float param;
+        Vec3 segmentPoint, ellipsePoint;
+        g_sink = g_sink + ClosestDistanceSegmentToEllipse(shield.base, shield.tip, circles[i & mask],
+            param, segmentPoint, ellipsePoint);
+    });
+
+    Run("PointInEllipse", iterations, [&](size_t i) {
+        g_sink = g_sink + (PointInEllipse(ellipses[i & mask], shields[i & mask].tip) ? 1.0f : 0.0f);
+    });
+
+    // Accuracy of the ellipse solver against dense sampling (sampling itself overestimates slightly)
+    {
+        const size_t checked = 512;
+        int overestimates = 0;
+        float maxOver = 0.0f, maxUnder = 0.0f;
+        for (size_t i = 0; i < checked; i++)
+        {
+            float param;
+            Vec3 segmentPoint, ellipsePoint;
+            float solved = ClosestDistanceSegmentToEllipse(shields[i].base, shields[i].tip, ellipses[i],
+                param, segmentPoint, ellipsePoint);
+            float sampled = SampledSegmentToEllipse(shields[i].base, shields[i].tip, ellipses[i]);
+            if (solved - sampled > 0.1f)
+                overestimates++;
+            if (solved - sampled > maxOver)
+                maxOver = solved - sampled;
+            if (sampled - solved > maxUnder)
+                maxUnder = sampled - solved;
+        }
+        std::printf("  ellipse solver above dense sampling by >0.1 in %d/%zu cases, max over %.2f, max under %.2f units\n",
+            overestimates, checked, maxOver, maxUnder);
+    }
+
+    // One 90 Hz step, and the 150 ms TimeToCollisionThreshold horizon
+    Run("SweptSegmentsTimeOfImpact (11 ms)", iterations, [&](size_t i) {
+        TimeOfImpactResult impact;
+        SweptSegmentsTimeOfImpact(sweptLeft[i & mask], sweptRight[i & mask], 5.0f, 0.011f, impact);
+        g_sink = g_sink + impact.time;
+    });
+
+    Run("SweptSegmentsTimeOfImpact (150 ms)", iterations, [&](size_t i) {
+        TimeOfImpactResult impact;
+        SweptSegmentsTimeOfImpact(sweptLeft[i & mask], sweptRight[i & mask], 5.0f, 0.15f, impact);
+        g_sink = g_sink + impact.time;
+    });
+
+    Run("SweptSegmentDiscTimeOfImpact (150 ms)", iterations, [&](size_t i) {
+        const ShieldCase& shield = shields[i & mask];
+        TimeOfImpactResult impact;
+        SweptSegmentDiscTimeOfImpact(sweptLeft[i & mask], shield.center, shield.normal, shield.radius,
+            5.0f, 0.15f, impact);
+        g_sink = g_sink + impact.time;
+    });
+
+    Run("EvaluateXPose", iterations, [&](size_t i) {
+        const BladePair& pair = blades[i & mask];
+        XPoseResult pose;
+        EvaluateXPose(pair.p1, pair.q1, pair.p2, pair.q2, (float)(i & 7), pose);
+        g_sink = g_sink + pose.bladeAngle;
+    });
+
+    Run("EstimateTimeToCollision", iterations, [&](size_t i) {
+        g_sink = g_sink + EstimateTimeToCollision(distances[i & mask], velocities[i & mask], 5.0f);
+    });
+
+    {
+        OneEuroParams params;
+        BladeMotionEstimator motion;
+        motion.Reset();
+        Run("BladeMotionEstimator::AddPose", iterations, [&](size_t i) {
+            const BladePair& pair = blades[i & mask];
+            BladePose pose;
+            pose.base = pair.p1;
+            pose.tip = pair.q1;
+            pose.time = (float)(i & 0xFFFF) * 0.011f;
+            motion.AddPose(pose, params, true);
+            g_sink = g_sink + motion.tipVelocity.x;
+        });
+        ReportVelocityFilter();
+    }
+
+    ReportNarrowphaseScheduling();
+
+    std::printf("ClosestDistanceBetweenSegmentsBatch [%s]\n", BatchInstructionSet());
+    for (size_t n : { 1, 8, 64, 512 })
+        RunSegmentBatch(blades, n, iterations);
+
+    return 0;
+}
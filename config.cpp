@@ -13,6 +13,20 @@ namespace FalseEdgeVR {
 	float bladeCollisionTimeout = 0.9f;       // Time (seconds) without collision before considered separated
 	float bladeTimeToCollisionThreshold = 0.15f; // Time-based collision prediction threshold (150ms)
 	float bladeReequipCooldown = 0.5f;          // Cooldown after re-equip (500ms)
+	bool bladeContinuousCollision = true;       // Swept blade-vs-blade time of impact
+	float bladeRadiusSword = 1.5f;              // Capsule radius for swords (units)
+	float bladeRadiusDagger = 1.0f;             // Capsule radius for daggers (units)
+	float bladeRadiusAxe = 4.0f;                // Capsule radius for axes (units)
+	float bladeRadiusMace = 5.0f;               // Capsule radius for maces (units)
+	float daggerPairThresholdScale = 0.25f;     // Dual daggers: 25% of normal thresholds
+	float daggerMixedThresholdScale = 0.5f;     // Dagger + longer weapon: 50% of normal thresholds
+	bool bladeVelocityFilter = true;            // One-Euro filtered blade velocities
+	float bladeVelocityFilterMinCutoff = 5.0f;  // Hz at rest
+	float bladeVelocityFilterBeta = 0.1f;       // Cutoff increase per unit/sec of blade speed
+	float bladeVelocityFilterDerivativeCutoff = 10.0f; // Hz
+	float bladeMinClosingVelocity = 50.0f;      // Units/sec, as before the filter
+	bool bladeNarrowphaseScheduling = true;     // Conservative-advancement skipping of CheckBladeCollision
+	float bladeMaxAcceleration = 20000.0f;      // Units/sec^2 - well above a hard VR swing
 	float reequipDelay = 0.002f;      // Delay after activating weapon before equipping (2ms)
 	float swingVelocityThreshold = 150.0f;      // Swing velocity threshold (units per second)
 	
@@ -35,6 +49,8 @@ namespace FalseEdgeVR {
 	float shieldReequipDelay = 0.002f;           // Delay after activating weapon before equipping (2ms)
 	float shieldSwingVelocityThreshold = 150.0f; // Swing velocity threshold (units per second)
 	float shieldRadius = 15.0f;                // Shield face detection radius (units)
+	float shieldShapeScale = 0.85f;              // Shield ellipse vs. mesh bounds (bounds overhang the face; vertex extents are used as-is)
+	bool shieldContinuousCollision = true;       // Swept weapon-vs-shield time of impact
 
 	// Shield bash settings - defaults
 	bool shieldBashEnabled = true;   // Enable/disable shield bash tracking feature
@@ -44,6 +60,11 @@ namespace FalseEdgeVR {
 
 	// Equipment change grace period
 	int equipGraceFrames = 20;    // Frames to wait after equipment change before collision detection (~0.22 sec at 90fps)
+	float combatTrackingRate = 10.0f;            // Combat distance changes slowly - 10 Hz is plenty
+	float schedulerReportInterval = 60.0f;       // Timing summary once a minute
+	int geometryPhase = 0;                       // Pre-physics step, as before
+	bool telemetryRecording = false;             // Off - only for threshold tuning
+	bool timerReportOnMenuClose = true;          // On - one short block per menu close
 
 	void loadConfig() 
 	{
@@ -133,6 +154,62 @@ namespace FalseEdgeVR {
 						{
 							swingVelocityThreshold = std::stof(variableValueStr);
 						}
+						else if (variableName == "ContinuousCollision")
+						{
+							bladeContinuousCollision = (std::stoi(variableValueStr) != 0);
+						}
+						else if (variableName == "SwordRadius")
+						{
+							bladeRadiusSword = std::stof(variableValueStr);
+						}
+						else if (variableName == "DaggerRadius")
+						{
+							bladeRadiusDagger = std::stof(variableValueStr);
+						}
+						else if (variableName == "AxeRadius")
+						{
+							bladeRadiusAxe = std::stof(variableValueStr);
+						}
+						else if (variableName == "MaceRadius")
+						{
+							bladeRadiusMace = std::stof(variableValueStr);
+						}
+						else if (variableName == "DaggerPairThresholdScale")
+						{
+							daggerPairThresholdScale = std::stof(variableValueStr);
+						}
+						else if (variableName == "DaggerMixedThresholdScale")
+						{
+							daggerMixedThresholdScale = std::stof(variableValueStr);
+						}
+						else if (variableName == "VelocityFilter")
+						{
+							bladeVelocityFilter = (std::stoi(variableValueStr) != 0);
+						}
+						else if (variableName == "VelocityFilterMinCutoff")
+						{
+							bladeVelocityFilterMinCutoff = std::stof(variableValueStr);
+						}
+						else if (variableName == "VelocityFilterBeta")
+						{
+							bladeVelocityFilterBeta = std::stof(variableValueStr);
+						}
+						else if (variableName == "VelocityFilterDerivativeCutoff")
+						{
+							bladeVelocityFilterDerivativeCutoff = std::stof(variableValueStr);
+						}
+						else if (variableName == "MinClosingVelocity")
+						{
+							bladeMinClosingVelocity = std::stof(variableValueStr);
+						}
+						else if (variableName == "NarrowphaseScheduling")
+						{
+							bladeNarrowphaseScheduling = (std::stoi(variableValueStr) != 0);
+						}
+						else if (variableName == "MaxBladeAcceleration")
+						{
+							bladeMaxAcceleration = std::stof(variableValueStr);
+						}
 					}
 					else if (currentSection == "AutoEquip")
 					{
@@ -207,6 +284,14 @@ namespace FalseEdgeVR {
 						{
 							shieldRadius = std::stof(variableValueStr);
 						}
+						else if (variableName == "ShieldShapeScale")
+						{
+							shieldShapeScale = std::stof(variableValueStr);
+						}
+						else if (variableName == "ContinuousCollision")
+						{
+							shieldContinuousCollision = (std::stoi(variableValueStr) != 0);
+						}
 					}
 					else if (currentSection == "ShieldBash")
 					{
@@ -239,51 +324,65 @@ namespace FalseEdgeVR {
 						{
 							equipGraceFrames = std::stoi(variableValueStr);
 						}
+						else if (variableName == "CombatTrackingRate")
+						{
+							combatTrackingRate = std::stof(variableValueStr);
+						}
+						else if (variableName == "SchedulerReportInterval")
+						{
+							schedulerReportInterval = std::stof(variableValueStr);
+						}
+						else if (variableName == "GeometryPhase")
+						{
+							geometryPhase = std::stoi(variableValueStr);
+						}
+						else if (variableName == "TelemetryRecording")
+						{
+							telemetryRecording = (std::stoi(variableValueStr) != 0);
+						}
+						else if (variableName == "TimerReportOnMenuClose")
+						{
+							timerReportOnMenuClose = (std::stoi(variableValueStr) != 0);
+						}
 					}
 				} 
 			}
-			_MESSAGE("Config loaded successfully.");
-			_MESSAGE("BladeCollision settings:");
-			_MESSAGE("  CollisionThreshold=%.2f, ImminentThreshold=%.2f, ImminentThresholdBackup=%.2f",
+			LOG_INFO("Config loaded successfully.");
+			LOG_INFO("BladeCollision settings:");
+			LOG_INFO("  CollisionThreshold=%.2f, ImminentThreshold=%.2f, ImminentThresholdBackup=%.2f",
 				bladeCollisionThreshold, bladeImminentThreshold, bladeImminentThresholdBackup);
-			_MESSAGE("  ReequipThreshold=%.2f, CollisionTimeout=%.3f, TimeToCollisionThreshold=%.3f",
+			LOG_INFO("  ReequipThreshold=%.2f, CollisionTimeout=%.3f, TimeToCollisionThreshold=%.3f",
 				bladeReequipThreshold, bladeCollisionTimeout, bladeTimeToCollisionThreshold);
-			_MESSAGE("  ReequipCooldown=%.3f, ReequipDelay=%.4f, SwingVelocityThreshold=%.1f",
-				bladeReequipCooldown, reequipDelay, swingVelocityThreshold);
-			_MESSAGE("AutoEquip settings: Enabled=%s, Delay=%.2f",
+			LOG_INFO("  ReequipCooldown=%.3f, ReequipDelay=%.4f, SwingVelocityThreshold=%.1f, ContinuousCollision=%s",
+				bladeReequipCooldown, reequipDelay, swingVelocityThreshold, bladeContinuousCollision ? "true" : "false");
+			LOG_INFO("  SwordRadius=%.1f, DaggerRadius=%.1f, AxeRadius=%.1f, MaceRadius=%.1f, DaggerPairThresholdScale=%.2f, DaggerMixedThresholdScale=%.2f",
+				bladeRadiusSword, bladeRadiusDagger, bladeRadiusAxe, bladeRadiusMace, daggerPairThresholdScale, daggerMixedThresholdScale);
+			LOG_INFO("  VelocityFilter=%s, MinCutoff=%.2f, Beta=%.4f, DerivativeCutoff=%.2f, MinClosingVelocity=%.1f",
+				bladeVelocityFilter ? "true" : "false", bladeVelocityFilterMinCutoff, bladeVelocityFilterBeta,
+				bladeVelocityFilterDerivativeCutoff, bladeMinClosingVelocity);
+			LOG_INFO("  NarrowphaseScheduling=%s, MaxBladeAcceleration=%.0f",
+				bladeNarrowphaseScheduling ? "true" : "false", bladeMaxAcceleration);
+			LOG_INFO("AutoEquip settings: Enabled=%s, Delay=%.2f",
 				autoEquipGrabbedWeaponEnabled ? "true" : "false", autoEquipGrabbedWeaponDelay);
-			_MESSAGE("CloseCombat settings: EnterDistance=%.1f, ExitDistance=%.1f",
+			LOG_INFO("CloseCombat settings: EnterDistance=%.1f, ExitDistance=%.1f",
 				closeCombatEnterDistance, closeCombatExitDistance);
-			_MESSAGE("ShieldCollision settings:");
-			_MESSAGE("  CollisionThreshold=%.2f, ImminentThreshold=%.2f, ImminentThresholdBackup=%.2f",
+			LOG_INFO("ShieldCollision settings:");
+			LOG_INFO("  CollisionThreshold=%.2f, ImminentThreshold=%.2f, ImminentThresholdBackup=%.2f",
 				shieldCollisionThreshold, shieldImminentThreshold, shieldImminentThresholdBackup);
-			_MESSAGE("  ReequipThreshold=%.2f, CollisionTimeout=%.3f, TimeToCollisionThreshold=%.3f",
+			LOG_INFO("  ReequipThreshold=%.2f, CollisionTimeout=%.3f, TimeToCollisionThreshold=%.3f",
 				shieldReequipThreshold, shieldCollisionTimeout, shieldTimeToCollisionThreshold);
-			_MESSAGE("  ReequipCooldown=%.3f, ReequipDelay=%.4f, SwingVelocityThreshold=%.1f, ShieldRadius=%.1f",
-				shieldReequipCooldown, shieldReequipDelay, shieldSwingVelocityThreshold, shieldRadius);
-			_MESSAGE("ShieldBash settings: Enabled=%s, BashThreshold=%d, BashWindow=%.1f, LockoutDuration=%.0f",
+			LOG_INFO("  ReequipCooldown=%.3f, ReequipDelay=%.4f, SwingVelocityThreshold=%.1f, ShieldRadius=%.1f, ContinuousCollision=%s",
+				shieldReequipCooldown, shieldReequipDelay, shieldSwingVelocityThreshold, shieldRadius,
+				shieldContinuousCollision ? "true" : "false");
+			LOG_INFO("  ShieldShapeScale=%.2f", shieldShapeScale);
+			LOG_INFO("ShieldBash settings: Enabled=%s, BashThreshold=%d, BashWindow=%.1f, LockoutDuration=%.0f",
 				shieldBashEnabled ? "true" : "false", shieldBashThreshold, shieldBashWindow, shieldBashLockoutDuration);
-			_MESSAGE("General settings: EquipGraceFrames=%d", equipGraceFrames);
+			LOG_INFO("General settings: EquipGraceFrames=%d, CombatTrackingRate=%.1f, SchedulerReportInterval=%.0f, GeometryPhase=%d, TelemetryRecording=%s, TimerReportOnMenuClose=%s",
+				equipGraceFrames, combatTrackingRate, schedulerReportInterval, geometryPhase, telemetryRecording ? "true" : "false",
+				timerReportOnMenuClose ? "true" : "false");
 			return;
 		}
 		return;
 	}
 
-	void Log(const int msgLogLevel, const char* fmt, ...)
-	{
-		if (msgLogLevel > logging)
-		{
-			return;
-		}
-
-		va_list args;
-		char logBuffer[4096];
-
-		va_start(args, fmt);
-		vsprintf_s(logBuffer, sizeof(logBuffer), fmt, args);
-		va_end(args);
-
-		_MESSAGE(logBuffer);
-	}
-
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "higgsinterface001.h"
 #include "vrikinterface001.h"
 #include "SkyrimVRESLAPI.h"
+#include "Logging.h"
 
 namespace FalseEdgeVR {
 
@@ -33,6 +34,20 @@ namespace FalseEdgeVR {
 	extern float bladeCollisionTimeout;         // Time (seconds) without collision before considered separated
 	extern float bladeTimeToCollisionThreshold; // Time-based collision prediction threshold
 	extern float bladeReequipCooldown;          // Cooldown after re-equip before another unequip can trigger
+	extern bool bladeContinuousCollision;       // Sweep blades between steps for an exact time of impact
+	extern float bladeRadiusSword;              // Capsule radius (blade half-thickness) for swords - the reference the thresholds already include
+	extern float bladeRadiusDagger;             // Capsule radius for daggers
+	extern float bladeRadiusAxe;                // Capsule radius for axes (wide head; the excess over SwordRadius adds reach)
+	extern float bladeRadiusMace;               // Capsule radius for maces (wide head)
+	extern float daggerPairThresholdScale;      // Threshold scale when both weapons are daggers
+	extern float daggerMixedThresholdScale;     // Threshold scale when one weapon is a dagger
+	extern bool bladeVelocityFilter;            // One-Euro filter blade velocities (off = raw one-step difference)
+	extern float bladeVelocityFilterMinCutoff;  // Filter cutoff (Hz) at rest
+	extern float bladeVelocityFilterBeta;       // Cutoff increase per unit/sec of blade speed
+	extern float bladeVelocityFilterDerivativeCutoff; // Cutoff (Hz) for the acceleration estimate
+	extern float bladeMinClosingVelocity;       // Minimum closing velocity to count as "approaching"
+	extern bool bladeNarrowphaseScheduling;     // Skip blade-vs-blade checks while the blades provably can't be close
+	extern float bladeMaxAcceleration;          // Upper bound on blade acceleration (units/sec^2) for the skip look-ahead
 	extern float reequipDelay;                  // Delay after activating weapon before equipping
 	extern float swingVelocityThreshold;     // Swing velocity threshold
 	
@@ -54,7 +69,9 @@ namespace FalseEdgeVR {
 	extern float shieldReequipCooldown;    // Cooldown after re-equip before another unequip can trigger
 	extern float shieldReequipDelay;     // Delay after activating weapon before equipping
 	extern float shieldSwingVelocityThreshold;   // Swing velocity threshold for shield collision
-	extern float shieldRadius;     // Shield face detection radius
+	extern float shieldRadius;     // Shield face detection radius (fallback when the mesh has no usable bounds)
+	extern float shieldShapeScale;               // Shield ellipse size relative to the mesh bounds (when no vertices are readable)
+	extern bool shieldContinuousCollision;       // Sweep the weapon between steps for an exact time of impact
 
 	// Shield bash settings
 	extern bool shieldBashEnabled;   // Enable/disable shield bash tracking feature
@@ -64,21 +81,16 @@ namespace FalseEdgeVR {
 
 	// Equipment change grace period
 	extern int equipGraceFrames;         // Frames to wait after equipment change before collision detection
+	extern float combatTrackingRate;             // Combat target/distance updates per second (0 = every physics step)
+	extern float schedulerReportInterval;        // Seconds between per-subsystem timing summaries in the log (0 = off)
+	extern int geometryPhase;                    // When blade/shield poses are sampled: 0 = pre-physics step, 1 = after VRIK and HIGGS place the hands
+	extern bool telemetryRecording;              // Write one binary TelemetryRecord per pose step to FalseEdgeVR_Telemetry.bin
+	extern bool timerReportOnMenuClose;          // Log hot-path latency percentiles (p50/p95/p99/max) each time a menu closes
 
 	void loadConfig();
-	
-	void Log(const int msgLogLevel, const char* fmt, ...);
-	enum eLogLevels
-	{
-		LOGLEVEL_ERR = 0,
-		LOGLEVEL_WARN,
-		LOGLEVEL_INFO,
-	};
 
 
-#define LOG(fmt, ...) Log(LOGLEVEL_WARN, fmt, ##__VA_ARGS__)
-#define LOG_ERR(fmt, ...) Log(LOGLEVEL_ERR, fmt, ##__VA_ARGS__)
-#define LOG_INFO(fmt, ...) Log(LOGLEVEL_INFO, fmt, ##__VA_ARGS__)
+// Leveled LOG_* / ALOG_* macros (compile-time ceiling + the Logging= level) live in Logging.h
 
 
 }
\ No newline at end of file
@@ -11,6 +11,9 @@
 #include "WeaponGeometry.h"
 #include "ShieldCollision.h"
 #include "ActivateHook.h"
+#include "GameEventQueue.h"
+#include "AsyncLog.h"
+#include "ScopedTimer.h"
 #include "skse64/GameEvents.h"
 #include "skse64/GameMenus.h"
 #include "skse64/PapyrusEvents.h"
@@ -53,13 +56,14 @@ namespace FalseEdgeVR
 					{
 						if (evn->opening)
 						{
-							_MESSAGE("MenuEventHandler: Pausing VR tracking due to menu open: %s", evn->menuName.data);
+							LOG_INFO("MenuEventHandler: Pausing VR tracking due to menu open: %s", evn->menuName.data);
 							VRInputHandler::GetSingleton()->PauseTracking(true);
 						}
 						else
 						{
-							_MESSAGE("MenuEventHandler: Resuming VR tracking due to menu close: %s", evn->menuName.data);
-							VRInputHandler::GetSingleton()->PauseTracking(false);
+							LOG_INFO("MenuEventHandler: Resuming VR tracking due to menu close: %s", evn->menuName.data);
+							// Resync on the physics step, after any equip events the menu queued
+							PushGameEvent(GameEventType::MenuClosed);
 						}
 					}
 				}
@@ -69,9 +73,9 @@ namespace FalseEdgeVR
 			BSFixedString mainMenu("Main Menu");
 			if (evn->menuName == mainMenu && !evn->opening)
 			{
-				_MESSAGE("=== Main Menu Closed - Hot reloading config ===");
+				LOG_INFO("=== Main Menu Closed - Hot reloading config ===");
 				FalseEdgeVR::loadConfig();
-				_MESSAGE("=== Config hot reload complete ===");
+				LOG_INFO("=== Config hot reload complete ===");
 			}
 
 			return kEvent_Continue;
@@ -102,8 +106,8 @@ namespace FalseEdgeVR
 			Actor* actor = DYNAMIC_CAST(evn->source, TESObjectREFR, Actor);
 			if (actor && actor == *g_thePlayer)
 			{
-				_MESSAGE("DeathEventHandler: Player died! Clearing all VR tracking state.");
-				VRInputHandler::GetSingleton()->ClearAllState();
+				LOG_INFO("DeathEventHandler: Player died! Queueing VR tracking state clear.");
+				PushGameEvent(GameEventType::PlayerDeath);
 			}
 
 			return kEvent_Continue;
@@ -140,12 +144,12 @@ namespace FalseEdgeVR
 
 			bool isLeftHand = (evn->slot == SKSEActionEvent::kSlot_Left);
 			
-			_MESSAGE("WeaponSwingEventHandler: WEAPON SWING detected! Hand: %s, Weapon FormID: %08X",
+			ALOG_INFO("WeaponSwingEventHandler: WEAPON SWING detected! Hand: %s, Weapon FormID: %08X",
 				isLeftHand ? "LEFT" : "RIGHT",
 				evn->sourceForm ? evn->sourceForm->formID : 0);
 
-			// Notify VRInputHandler
-			VRInputHandler::GetSingleton()->OnWeaponSwing(isLeftHand, evn->sourceForm);
+			// Notify VRInputHandler (applied on the next physics step)
+			PushGameEvent(GameEventType::WeaponSwing, isLeftHand, evn->sourceForm ? evn->sourceForm->formID : 0);
 
 			return kEvent_Continue;
 		}
@@ -182,11 +186,11 @@ namespace FalseEdgeVR
 			bool isBash = (evn->flags & TESHitEvent::kFlag_Bash) != 0;
 			bool isBlocked = (evn->flags & TESHitEvent::kFlag_Blocked) != 0;
 			
-			_MESSAGE("HitEventHandler: === PLAYER HIT EVENT ===");
-			_MESSAGE("HitEventHandler:   Target: %08X, Source Weapon: %08X", 
+			ALOG_INFO("HitEventHandler: === PLAYER HIT EVENT ===");
+			ALOG_INFO("HitEventHandler:   Target: %08X, Source Weapon: %08X", 
 				evn->target ? evn->target->formID : 0,
 				evn->sourceFormID);
-			_MESSAGE("HitEventHandler:   Flags: PowerAttack=%s, SneakAttack=%s, Bash=%s, Blocked=%s",
+			ALOG_INFO("HitEventHandler:   Flags: PowerAttack=%s, SneakAttack=%s, Bash=%s, Blocked=%s",
 				isPowerAttack ? "YES" : "NO",
 				isSneakAttack ? "YES" : "NO",
 				isBash ? "YES" : "NO",
@@ -201,10 +205,10 @@ namespace FalseEdgeVR
 				
 				bool isLeftHand = (leftEquipped && leftEquipped->formID == sourceForm->formID);
 				
-				_MESSAGE("HitEventHandler:   Hand: %s", isLeftHand ? "LEFT" : "RIGHT");
+				ALOG_INFO("HitEventHandler:   Hand: %s", isLeftHand ? "LEFT" : "RIGHT");
 				
-				// Notify VRInputHandler of the hit/swing
-				VRInputHandler::GetSingleton()->OnWeaponSwing(isLeftHand, sourceForm);
+				// Notify VRInputHandler of the hit/swing (applied on the next physics step)
+				PushGameEvent(GameEventType::WeaponSwing, isLeftHand, sourceForm->formID);
 			}
 
 			return kEvent_Continue;
@@ -222,7 +226,7 @@ namespace FalseEdgeVR
 
 	void SetupReceptors()
 	{
-		_MESSAGE("Building Event Sinks...");
+		LOG_INFO("Building Event Sinks...");
 
 		// Register equip event handler
 		RegisterEquipEventHandler();
@@ -232,52 +236,52 @@ namespace FalseEdgeVR
 		if (eventDispatcher)
 		{
 			eventDispatcher->deathDispatcher.AddEventSink(DeathEventHandler::GetSingleton());
-			_MESSAGE("Death event handler registered");
+			LOG_INFO("Death event handler registered");
 			
 			// Register hit event handler
 			eventDispatcher->unk630.AddEventSink(HitEventHandler::GetSingleton());
-			_MESSAGE("Hit event handler registered");
+			LOG_INFO("Hit event handler registered");
 		}
 		
 		// Register weapon swing event handler (SKSE action events)
 		g_actionEventDispatcher.AddEventSink(WeaponSwingEventHandler::GetSingleton());
-		_MESSAGE("Weapon swing event handler registered");
+		LOG_INFO("Weapon swing event handler registered");
 		
 		// Register menu event handler for hot reloading config
 		MenuManager* menuManager = MenuManager::GetSingleton();
 		if (menuManager)
 		{
 			menuManager->MenuOpenCloseEventDispatcher()->AddEventSink(MenuEventHandler::GetSingleton());
-			_MESSAGE("Menu event handler registered (config hot reload on main menu close)");
+			LOG_INFO("Menu event handler registered (config hot reload on main menu close)");
 		}
 	}
 
 	// Called after HIGGS interface is available
 	void InitializeVRSystems()
 	{
-		_MESSAGE("=== Initializing VR Systems ===");
+		LOG_INFO("=== Initializing VR Systems ===");
 		
 		// Initialize VR input handling (HIGGS callbacks) - NOW higgsInterface is available
-		_MESSAGE("Calling InitializeVRInput...");
+		LOG_INFO("Calling InitializeVRInput...");
 		InitializeVRInput();
-		_MESSAGE("InitializeVRInput complete");
+		LOG_INFO("InitializeVRInput complete");
 		
 		// Initialize weapon geometry tracking
-		_MESSAGE("Calling InitializeWeaponGeometryTracker...");
+		LOG_INFO("Calling InitializeWeaponGeometryTracker...");
 		InitializeWeaponGeometryTracker();
-		_MESSAGE("InitializeWeaponGeometryTracker complete");
+		LOG_INFO("InitializeWeaponGeometryTracker complete");
 		
 		// Initialize shield collision tracking
-		_MESSAGE("Calling InitializeShieldCollisionTracker...");
+		LOG_INFO("Calling InitializeShieldCollisionTracker...");
 		InitializeShieldCollisionTracker();
-		_MESSAGE("InitializeShieldCollisionTracker complete");
+		LOG_INFO("InitializeShieldCollisionTracker complete");
 		
 		// Update grab listening based on current equipment
-		_MESSAGE("Calling UpdateGrabListening...");
+		LOG_INFO("Calling UpdateGrabListening...");
 		VRInputHandler::GetSingleton()->UpdateGrabListening();
-		_MESSAGE("UpdateGrabListening complete");
+		LOG_INFO("UpdateGrabListening complete");
 		
-		_MESSAGE("=== VR Systems initialized successfully ===");
+		LOG_INFO("=== VR Systems initialized successfully ===");
 	}
 
 	extern "C" {
@@ -289,7 +293,7 @@ namespace FalseEdgeVR
 
 			std::string logMsg("FalseEdgeVR: ");
 			logMsg.append(FalseEdgeVR::MOD_VERSION_STR);
-			_MESSAGE(logMsg.c_str());
+			LOG_INFO("%s", logMsg.c_str());
 
 			// populate info structure
 			info->infoVersion = PluginInfo::kInfoVersion;
@@ -301,17 +305,17 @@ namespace FalseEdgeVR
 
 			std::string skseVers = "SKSE Version: ";
 			skseVers += std::to_string(skse->runtimeVersion);
-			_MESSAGE(skseVers.c_str());
+			LOG_INFO("%s", skseVers.c_str());
 
 			if (skse->isEditor)
 			{
-				_MESSAGE("loaded in editor, marking as incompatible");
+				LOG_INFO("loaded in editor, marking as incompatible");
 
 				return false;
 			}
 			else if (skse->runtimeVersion < CURRENT_RELEASE_RUNTIME)
 			{
-				_MESSAGE("unsupported runtime version %08X", skse->runtimeVersion);
+				LOG_INFO("unsupported runtime version %08X", skse->runtimeVersion);
 
 				return false;
 			}
@@ -364,7 +368,7 @@ namespace FalseEdgeVR
 
 						g_localTrampoline.SetBase(TRAMPOLINE_SIZE, local);
 
-						_MESSAGE("Using new SKSEVR trampoline interface memory pool alloc for codegen buffers.");
+						LOG_INFO("Using new SKSEVR trampoline interface memory pool alloc for codegen buffers.");
 					}
 					else  // otherwise if using an older SKSEVR version, fall back to old code
 					{
@@ -381,7 +385,7 @@ namespace FalseEdgeVR
 							return;
 						}
 
-						_MESSAGE("Using legacy SKSE trampoline creation.");
+						LOG_INFO("Using legacy SKSE trampoline creation.");
 					}
 
 					FalseEdgeVR::GameLoad();
@@ -399,11 +403,11 @@ namespace FalseEdgeVR
 					higgsInterface = HiggsPluginAPI::GetHiggsInterface001(g_pluginHandle, g_messaging);
 					if (higgsInterface)
 					{
-						_MESSAGE("Got HIGGS interface. Buildnumber: %d", higgsInterface->GetBuildNumber());
+						LOG_INFO("Got HIGGS interface. Buildnumber: %d", higgsInterface->GetBuildNumber());
 					}
 					else
 					{
-						_MESSAGE("Did not get HIGGS interface - VR collision features will be disabled");
+						LOG_INFO("Did not get HIGGS interface - VR collision features will be disabled");
 					}
 
 					// Get VRIK interface
@@ -415,22 +419,22 @@ namespace FalseEdgeVR
 						{
 							ShowErrorBoxAndTerminate("[CRITICAL] VRIK's older versions are not compatible. Make sure you have VRIK version 0.8.4 or higher.");
 						}
-						_MESSAGE("Got VRIK interface. Buildnumber: %d", vrikBuildNumber);
+						LOG_INFO("Got VRIK interface. Buildnumber: %d", vrikBuildNumber);
 					}
 					else
 					{
-						_MESSAGE("Did not get VRIK interface");
+						LOG_INFO("Did not get VRIK interface");
 					}
 
 					// Get SkyrimVRESL interface
 					skyrimVRESLInterface = SkyrimVRESLPluginAPI::GetSkyrimVRESLInterface001(g_pluginHandle, g_messaging);
 					if (skyrimVRESLInterface)
 					{
-						_MESSAGE("Got SkyrimVRESL interface");
+						LOG_INFO("Got SkyrimVRESL interface");
 					}
 					else
 					{
-						_MESSAGE("Did not get SkyrimVRESL interface");
+						LOG_INFO("Did not get SkyrimVRESL interface");
 					}
 
 					// NOW initialize VR systems that depend on HIGGS
@@ -440,18 +444,11 @@ namespace FalseEdgeVR
 				{
 					if ((bool)(msg->data) == true)
 					{
-						_MESSAGE("PostLoadGame: Clearing VR tracking state and updating equipment...");
-						
-						// Clear all VR tracking state first (old references are now invalid)
-						VRInputHandler::GetSingleton()->ClearAllState();
+						// Tracking state belongs to the physics step - clear it and resync equipment there
+						LOG_INFO("PostLoadGame: Queueing VR tracking state clear and equipment update");
+						PushGameEvent(GameEventType::GameLoaded);
 						
 						FalseEdgeVR::PostLoadGame();
-						
-						// Update equipment state after loading a save
-						EquipManager::GetSingleton()->UpdateEquipmentState();
-						VRInputHandler::GetSingleton()->UpdateGrabListening();
-						
-						_MESSAGE("PostLoadGame: Complete");
 					}
 				}
 			}
@@ -459,6 +456,12 @@ namespace FalseEdgeVR
 
 		bool SKSEPlugin_Load(const SKSEInterface* skse) {	// Called by SKSE to load this plugin
 
+			// Writer for ASYNC_MESSAGE (physics-step and event-sink logging)
+			StartAsyncLog();
+
+			// Tick rate reference for the hot-path latency histograms
+			StartHotPathTimers();
+
 			g_task = (SKSETaskInterface*)skse->QueryInterface(kInterface_Task);
 
 			g_papyrus = (SKSEPapyrusInterface*)skse->QueryInterface(kInterface_Papyrus);
@@ -468,7 +471,7 @@ namespace FalseEdgeVR
 
 			g_vrInterface = (SKSEVRInterface*)skse->QueryInterface(kInterface_VR);
 			if (!g_vrInterface) {
-				_MESSAGE("[CRITICAL] Couldn't get SKSE VR interface. You probably have an outdated SKSE version.");
+				LOG_ERROR("[CRITICAL] Couldn't get SKSE VR interface. You probably have an outdated SKSE version.");
 				return false;
 			}
 